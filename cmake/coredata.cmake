@@ -67,6 +67,7 @@ function(ivw_private_setup_core_data)
 
     set("${mod}_dependencies"    ""   CACHE INTERNAL "Module dependencies")
     set("${mod}_protected"       ON   PARENT_SCOPE)
+    set("${mod}_threadSafe"      OFF  PARENT_SCOPE)
     set("${mod}_enableByDefault" ON   PARENT_SCOPE)
     set("${mod}_disabled"        OFF  PARENT_SCOPE)
     set("${mod}_disabledReason"  ""   PARENT_SCOPE)
@@ -124,6 +124,11 @@ function(ivw_private_generate_module_registration_file mod)
     else()
         set(module_protected "ProtectedModule::off")
     endif()
+    if(${${mod}_threadSafe})
+        set(module_thread_safe "ThreadSafeModule::on")
+    else()
+        set(module_thread_safe "ThreadSafeModule::off")
+    endif()
 
     ivw_private_generate_license_header(MOD ${mod} RETVAL module_license_vector)
     string(CONCAT fuction_args
@@ -137,7 +142,8 @@ function(ivw_private_generate_module_registration_file mod)
         "        ${module_alias_vector}, // List of aliases\n"
         "        // List of license information\n"
         "        ${module_license_vector},\n"
-        "        ${module_protected} // protected"
+        "        ${module_protected}, // protected\n"
+        "        ${module_thread_safe} // thread safe"
     )
     string(REPLACE "__LINEBREAK__" "\\n\"\n        \"" fuction_args "${fuction_args}")
     string(REPLACE "__SEMICOLON__" ";" fuction_args "${fuction_args}")
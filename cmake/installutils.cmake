@@ -332,6 +332,7 @@ function(ivw_install_module)
         "set(${mod}_udependencies ${${mod}_udependencies})\n"
         "set(${mod}_dependenciesversion ${${mod}_dependenciesversion})\n"
         "set(${mod}_protected ${${mod}_protected})\n"
+        "set(${mod}_threadSafe ${${mod}_threadSafe})\n"
         "set(${mod}_aliases ${${mod}_aliases})\n"
     )
 
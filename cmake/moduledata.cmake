@@ -88,14 +88,16 @@ function(ivw_private_setup_module_data)
     set("${mod}_sharedLibHpp" "${sharedLibHpp}"       PARENT_SCOPE) # Shared lib Header for file generation
 
     # Check of there is a depends.cmake
-    # Optionally defines: dependencies, aliases, protected, EnableByDefault
+    # Optionally defines: dependencies, aliases, protected, threadSafe, EnableByDefault
     # Save dependencies to INVIWO<NAME>MODULE_dependencies
     # Save aliases to INVIWO<NAME>MODULE_aliases
     # Save protected to INVIWO<NAME>MODULE_protected
+    # Save threadSafe to INVIWO<NAME>MODULE_threadSafe
     # Save EnableByDefault to INVIWO<NAME>MODULE_EnableByDefault
     set(dependencies "")
     set(aliases "")
     set(protected OFF)
+    set(threadSafe OFF)
     set(EnableByDefault OFF)
     set(Disabled OFF)
     set(DisabledReason "")
@@ -111,6 +113,7 @@ function(ivw_private_setup_module_data)
     list(PREPEND dependencies InviwoCoreModule)
     set("${mod}_dependencies"    ${dependencies}    CACHE INTERNAL "Module dependencies")
     set("${mod}_protected"       ${protected}       PARENT_SCOPE)
+    set("${mod}_threadSafe"      ${threadSafe}      PARENT_SCOPE)
     set("${mod}_enableByDefault" ${EnableByDefault} PARENT_SCOPE)
     set("${mod}_disabled"        ${Disabled}        PARENT_SCOPE)
     set("${mod}_disabledReason"  ${DisabledReason}  PARENT_SCOPE)
@@ -60,6 +60,7 @@
 #include <vector>
 #include <memory>
 #include <filesystem>
+#include <functional>
 
 namespace inviwo {
 
@@ -300,10 +301,32 @@ public:
 
     InviwoApplication* getInviwoApplication() const;
 
+    /**
+     * Run the registrations that were deferred since the module was constructed while a
+     * DeferModuleRegistrations was alive. Later registrations run directly. Has to be called on
+     * the main thread.
+     * @see ModuleManager::registerModules
+     */
+    void commitRegistrations();
+
 protected:
     InviwoApplication* app_;  // reference to the app that we belong to
 
 private:
+    /**
+     * Run the registration with the application directly, or queue it until commitRegistrations
+     * if the registrations are deferred.
+     */
+    void registerOrDefer(std::function<void()> registration);
+
+    /**
+     * Keep ownership of the object and register it in the factory, the object is dropped if
+     * the factory rejects it.
+     */
+    template <typename Factory, typename T>
+    void registerOwned(Factory* factory, std::unique_ptr<T> object,
+                       std::vector<std::unique_ptr<T>>& owned);
+
     template <typename T>
     std::vector<T*> uniqueToPtr(std::vector<std::unique_ptr<T>>& v) {
         std::vector<T*> res;
@@ -359,6 +382,26 @@ private:
     std::vector<std::unique_ptr<Settings>> ownedSettings_;
     std::vector<Settings*> settings_;
     std::vector<std::unique_ptr<DataVisualizer>> dataVisualizers_;
+
+    bool deferRegistrations_;
+    std::vector<std::function<void()>> deferredRegistrations_;
+};
+
+/**
+ * While an instance is alive, InviwoModules constructed on the current thread defer their
+ * registrations with the application until InviwoModule::commitRegistrations is called. The
+ * ModuleManager uses this to construct thread safe modules on the thread pool, and then commits
+ * the registrations on the main thread.
+ * @see ThreadSafeModule
+ */
+class IVW_CORE_API DeferModuleRegistrations {
+public:
+    DeferModuleRegistrations();
+    DeferModuleRegistrations(const DeferModuleRegistrations&) = delete;
+    DeferModuleRegistrations& operator=(const DeferModuleRegistrations&) = delete;
+    DeferModuleRegistrations(DeferModuleRegistrations&&) = delete;
+    DeferModuleRegistrations& operator=(DeferModuleRegistrations&&) = delete;
+    ~DeferModuleRegistrations();
 };
 
 template <typename T>
@@ -425,30 +468,42 @@ template <typename BaseRepr>
 void InviwoModule::registerRepresentationConverter(
     std::unique_ptr<RepresentationConverter<BaseRepr>> converter) {
 
-    if (auto metaFactory = util::getRepresentationConverterMetaFactory(app_)) {
-        if (auto factory = metaFactory->getConverterFactory<BaseRepr>()) {
-            if (factory->registerObject(converter.get())) {
-                representationConvertersUnRegFunctors_.push_back(
-                    [factory, conv = converter.get()]() { factory->unRegisterObject(conv); });
-                representationConverters_.push_back(std::move(converter));
+    auto* conv = converter.get();
+    representationConverters_.push_back(std::move(converter));
+    registerOrDefer([this, conv]() {
+        if (auto metaFactory = util::getRepresentationConverterMetaFactory(app_)) {
+            if (auto factory = metaFactory->getConverterFactory<BaseRepr>()) {
+                if (factory->registerObject(conv)) {
+                    representationConvertersUnRegFunctors_.push_back(
+                        [factory, conv]() { factory->unRegisterObject(conv); });
+                    return;
+                }
             }
         }
-    }
+        std::erase_if(representationConverters_,
+                      [conv](const auto& item) { return item.get() == conv; });
+    });
 }
 
 template <typename BaseRepr>
 void InviwoModule::registerRepresentationFactoryObject(
     std::unique_ptr<RepresentationFactoryObject<BaseRepr>> representation) {
 
-    if (auto metaFactory = util::getRepresentationMetaFactory(app_)) {
-        if (auto factory = metaFactory->getRepresentationFactory<BaseRepr>()) {
-            if (factory->registerObject(representation.get())) {
-                representationUnRegFunctors_.push_back(
-                    [factory, repr = representation.get()]() { factory->unRegisterObject(repr); });
-                representationFactoryObjects_.push_back(std::move(representation));
+    auto* repr = representation.get();
+    representationFactoryObjects_.push_back(std::move(representation));
+    registerOrDefer([this, repr]() {
+        if (auto metaFactory = util::getRepresentationMetaFactory(app_)) {
+            if (auto factory = metaFactory->getRepresentationFactory<BaseRepr>()) {
+                if (factory->registerObject(repr)) {
+                    representationUnRegFunctors_.push_back(
+                        [factory, repr]() { factory->unRegisterObject(repr); });
+                    return;
+                }
             }
         }
-    }
+        std::erase_if(representationFactoryObjects_,
+                      [repr](const auto& item) { return item.get() == repr; });
+    });
 }
 
 }  // namespace inviwo
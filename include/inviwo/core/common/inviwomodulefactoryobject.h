@@ -46,6 +46,10 @@ class InviwoApplication;
 // A protected module does not participate in runtime reloading
 enum class ProtectedModule : bool { on, off };
 
+// A thread safe module can be constructed on the thread pool concurrently with other thread safe
+// modules, see ModuleManager::registerModules
+enum class ThreadSafeModule : bool { on, off };
+
 class IVW_CORE_API InviwoModuleFactoryObject {
 public:
     InviwoModuleFactoryObject(std::string_view name, Version version, std::string_view description,
@@ -53,7 +57,8 @@ public:
                               std::vector<std::string> dependencies,
                               std::vector<Version> dependenciesVersion,
                               std::vector<std::string> aliases, std::vector<LicenseInfo> licenses,
-                              ProtectedModule protectedModule);
+                              ProtectedModule protectedModule,
+                              ThreadSafeModule threadSafeModule = ThreadSafeModule::off);
     virtual ~InviwoModuleFactoryObject() = default;
     InviwoModuleFactoryObject(const InviwoModuleFactoryObject&) = delete;
     InviwoModuleFactoryObject& operator=(const InviwoModuleFactoryObject&) = delete;
@@ -76,6 +81,8 @@ public:
     std::vector<LicenseInfo> licenses;
     // A protected module does not participate in runtime reloading
     ProtectedModule protectedModule;
+    // A thread safe module can be constructed concurrently with other thread safe modules
+    ThreadSafeModule threadSafeModule;
 };
 
 template <typename T>
@@ -86,7 +93,7 @@ public:
         const std::filesystem::path& srcPath, Version inviwoCoreVersion,
         std::vector<std::string> dependencies, std::vector<Version> dependenciesVersion,
         std::vector<std::string> aliases, std::vector<LicenseInfo> licenses,
-        ProtectedModule protectedModule);
+        ProtectedModule protectedModule, ThreadSafeModule threadSafeModule = ThreadSafeModule::off);
 
     virtual std::unique_ptr<InviwoModule> create(InviwoApplication* app) override {
         return std::make_unique<T>(app);
@@ -109,10 +116,11 @@ InviwoModuleFactoryObjectTemplate<T>::InviwoModuleFactoryObjectTemplate(
     const std::filesystem::path& srcPath, Version inviwoCoreVersion,
     std::vector<std::string> dependencies, std::vector<Version> dependenciesVersion,
     std::vector<std::string> aliases, std::vector<LicenseInfo> licenses,
-    ProtectedModule protectedModule)
+    ProtectedModule protectedModule, ThreadSafeModule threadSafeModule)
     : InviwoModuleFactoryObject(name, version, description, srcPath, inviwoCoreVersion,
                                 std::move(dependencies), std::move(dependenciesVersion),
-                                std::move(aliases), std::move(licenses), protectedModule) {}
+                                std::move(aliases), std::move(licenses), protectedModule,
+                                threadSafeModule) {}
 
 /**
  * \brief Topological sort to make sure that we load modules in correct order
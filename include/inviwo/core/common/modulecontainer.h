@@ -32,6 +32,7 @@
 
 #include <inviwo/core/common/version.h>
 
+#include <chrono>
 #include <memory>
 #include <filesystem>
 #include <string>
@@ -69,6 +70,12 @@ public:
     void load(bool runtimeReload);
     void unload();
 
+    /**
+     * The time spent in the last call to load, i.e. loading the library and creating the factory
+     * object. Zero for modules that were not loaded from a library.
+     */
+    std::chrono::nanoseconds loadTime() const { return loadTime_; }
+
     InviwoModuleFactoryObject& factoryObject() const;
 
     bool dependsOn(std::string_view identifier) const;
@@ -101,6 +108,8 @@ private:
     std::unique_ptr<InviwoModuleFactoryObject> factoryObject_;
     std::unique_ptr<InviwoModule> module_;
 
+    std::chrono::nanoseconds loadTime_{0};
+
     std::vector<ModuleContainer*> transitiveDependencies;
     std::vector<ModuleContainer*> transitiveDependents;
 };
@@ -36,7 +36,9 @@
 #include <inviwo/core/common/runtimemoduleregistration.h>
 #include <inviwo/core/common/modulecontainer.h>
 
+#include <chrono>
 #include <set>
+#include <string>
 #include <vector>
 #include <memory>
 #include <span>
@@ -47,6 +49,19 @@ namespace inviwo {
 
 class InviwoModule;
 
+/**
+ * The time spent on each step of registering a module
+ * @see ModuleManager::getModuleTimings
+ */
+struct IVW_CORE_API ModuleTiming {
+    std::string identifier;
+    std::chrono::nanoseconds load{0};          ///< Loading the library, runtime modules only
+    std::chrono::nanoseconds construction{0};  ///< Constructing the InviwoModule
+    std::chrono::nanoseconds capabilities{0};  ///< Retrieving and printing the capabilities
+
+    std::chrono::nanoseconds total() const { return load + construction + capabilities; }
+};
+
 /**
  * Manages finding, loading, unloading, reloading of Inviwo modules
  */
@@ -126,6 +141,14 @@ public:
 
     size_t size() const { return inviwoModules_.size(); }
 
+    /**
+     * The time spent loading, constructing, and retrieving the capabilities of each registered
+     * module, in registration order. A module that is reloaded replaces its previous entry and a
+     * module that is unregistered is removed. A summary is logged after each call to
+     * registerModules.
+     */
+    const std::vector<ModuleTiming>& getModuleTimings() const { return timings_; }
+
     template <class T>
     T* getModuleByType() const;
     InviwoModule* getModuleByIdentifier(std::string_view identifier) const;
@@ -148,7 +171,8 @@ public:
     static std::function<bool(std::string_view)> getEnabledFilter();
     void reloadModules();
 
-    // This is a hack to avoid having to add more arguments to the InviwoModule constructor
+    // This is a hack to avoid having to add more arguments to the InviwoModule constructor.
+    // The locator is per thread since thread safe modules are constructed concurrently.
     void setModuleLocator(std::function<std::filesystem::path(const InviwoModule&)> moduleLocator);
     std::filesystem::path locateModule(const InviwoModule&) const;
 
@@ -156,6 +180,9 @@ private:
     bool checkDependencies(const InviwoModuleFactoryObject& obj) const;
     std::vector<std::string> deregisterDependentModules(
         const std::vector<std::string>& toDeregister);
+    ModuleTiming* findTiming(std::string_view identifier);
+    void recordTiming(ModuleTiming timing);
+    void eraseTiming(std::string_view identifier);
 
     InviwoApplication* app_;
 
@@ -163,8 +190,7 @@ private:
     Dispatcher<void()> onModulesWillUnregister_;  ///< Called before modules have been unregistered
 
     std::vector<ModuleContainer> inviwoModules_;
-
-    std::function<std::filesystem::path(const InviwoModule&)> moduleLocator_;
+    std::vector<ModuleTiming> timings_;
 };
 
 template <class T>
@@ -37,7 +37,10 @@
 #include <inviwo/core/resourcemanager/resource.h>
 
 #include <inviwo/core/util/demangle.h>
+#include <inviwo/core/util/threadutil.h>
 
+#include <chrono>
+#include <future>
 #include <typeindex>
 #include <mutex>
 #include <unordered_map>
@@ -46,6 +49,36 @@
 
 namespace inviwo {
 
+namespace detail {
+
+/**
+ * Estimated size of the data in bytes, used for the conversion statistics. Returns 0 for data
+ * types without a size or dimensions and a format.
+ */
+template <typename T>
+size_t dataSizeInBytes(const T& data) {
+    if constexpr (requires { data.getSizeInBytes(); }) {
+        return data.getSizeInBytes();
+    } else if constexpr (requires { data.getDimensions().length(); data.getDataFormat(); }) {
+        const auto dims = data.getDimensions();
+        size_t size = data.getDataFormat()->getSizeInBytes();
+        for (int i = 0; i < static_cast<int>(dims.length()); ++i) {
+            size *= static_cast<size_t>(dims[i]);
+        }
+        return size;
+    } else {
+        return 0;
+    }
+}
+
+/**
+ * Prepare a thread pool thread for a representation conversion, i.e. activate the thread local
+ * render context, since the conversion might involve OpenGL.
+ */
+IVW_CORE_API void prepareConversionThread();
+
+}  // namespace detail
+
 /**
  * \defgroup datastructures Datastructures
  */
@@ -114,6 +147,18 @@ public:
     template <typename T>
     std::shared_ptr<const T> getRepresentationShared() const;
 
+    /**
+     * Request a representation of type T without blocking. If there is a valid representation of
+     * type T the returned future is ready immediately, otherwise the conversion is done on the
+     * thread pool, in the same way as in getRepresentation. Calls to getRepresentation while the
+     * conversion is running will wait for it and then use the converted representation.
+     * Exceptions thrown by the conversion are rethrown by the future.
+     * @note The Data object has to outlive the conversion, i.e. keep a shared_ptr to it until the
+     * future is ready.
+     */
+    template <typename T>
+    std::shared_future<std::shared_ptr<const T>> requestRepresentation() const;
+
     /**
      * Get an editable representation. This will invalidate all other representations.
      * They will now have to be updated from this one before use.
@@ -133,6 +178,13 @@ public:
     template <typename T>
     bool hasRepresentation() const;
 
+    /**
+     * Check if there is a valid representation of type T, i.e. if getRepresentation<T>() can
+     * return it without converting or updating it.
+     */
+    template <typename T>
+    bool hasValidRepresentation() const;
+
     /**
      * Check if the Data object has any representation.
      * @return true if any representation exist, false otherwise.
@@ -256,20 +308,26 @@ std::shared_ptr<T> Data<Self, Repr>::getReprInternal(D& data) {
 
         const auto lastValidType = data.lastValidRepresentation_->getTypeIndex();
         if (auto package = factory->getRepresentationConverter(lastValidType, requestedType)) {
+            const auto bytes = detail::dataSizeInBytes(data);
             for (auto converter : package->getConverters()) {
                 const auto dstType = converter->getConverterID().second;
                 const auto srcRepr = data.lastValidRepresentation_;
+                const auto start = std::chrono::steady_clock::now();
 
                 if (auto dstRepr = data.findRepr(dstType)) {
                     converter->update(srcRepr, dstRepr);
                     data.lastValidRepresentation_ = dstRepr;
                     data.lastValidRepresentation_->setValid(true);
+                    factory->addStatistics(converter->getConverterID(), false, bytes,
+                                           std::chrono::steady_clock::now() - start);
                 } else {  // No representation found, create it
                     dstRepr = converter->createFrom(srcRepr);
                     if (!dstRepr) {
                         throw ConverterException("Converter failed to create",
                                                  IVW_CONTEXT_CUSTOM("Data"));
                     }
+                    factory->addStatistics(converter->getConverterID(), true, bytes,
+                                           std::chrono::steady_clock::now() - start);
                     data.lastValidRepresentation_ = data.addRepresentationInternal(dstRepr);
                 }
             }
@@ -300,6 +358,25 @@ std::shared_ptr<const T> Data<Self, Repr>::getRepresentationShared() const {
     return getReprInternal<const T>(*static_cast<const Self*>(this));
 }
 
+template <typename Self, typename Repr>
+template <typename T>
+std::shared_future<std::shared_ptr<const T>> Data<Self, Repr>::requestRepresentation() const {
+    {
+        std::scoped_lock lock(mutex_);
+        if (auto repr = findRepr(std::type_index{typeid(T)}); repr && repr->isValid()) {
+            std::promise<std::shared_ptr<const T>> promise;
+            promise.set_value(std::dynamic_pointer_cast<const T>(repr));
+            return promise.get_future().share();
+        }
+    }
+
+    return util::dispatchPool([self = static_cast<const Self*>(this)]() {
+               detail::prepareConversionThread();
+               return self->template getRepresentationShared<T>();
+           })
+        .share();
+}
+
 template <typename Self, typename Repr>
 template <typename T>
 const T* Data<Self, Repr>::getRepresentation() const {
@@ -323,6 +400,14 @@ bool Data<Self, Repr>::hasRepresentation() const {
     return util::has_key(representations_, std::type_index{typeid(T)});
 }
 
+template <typename Self, typename Repr>
+template <typename T>
+bool Data<Self, Repr>::hasValidRepresentation() const {
+    std::scoped_lock lock(mutex_);
+    const auto repr = findRepr(std::type_index{typeid(T)});
+    return repr && repr->isValid();
+}
+
 template <typename Self, typename Repr>
 void Data<Self, Repr>::invalidateAllOther(const Repr* repr) {
     std::scoped_lock lock(mutex_);
@@ -36,9 +36,13 @@
 #include <inviwo/core/util/glmmatext.h>
 #include <inviwo/core/datastructures/datamapper.h>
 #include <inviwo/core/util/dispatcher.h>
+#include <inviwo/core/util/threadutil.h>
 
 #include <glm/common.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <future>
 #include <iterator>
 #include <vector>
 #include <bitset>
@@ -70,6 +74,13 @@ struct IVW_CORE_API Histogram1D {
 
     Statistics dataStats;
     Statistics histStats;
+
+    /**
+     * Fraction of the data included in the histogram. Less than 1 for the approximate histograms
+     * published during a progressive calculation.
+     * @see HistogramCache
+     */
+    double coverage{1.0};
 };
 
 namespace util {
@@ -78,90 +89,256 @@ IVW_CORE_API std::vector<double> calculatePercentiles(const std::vector<size_t>&
                                                       size_t sum);
 IVW_CORE_API Statistics calculateHistogramStats(const std::vector<size_t>& hist);
 
+/**
+ * Strides to use for a progressive histogram calculation of data with @p size elements. Large data
+ * first gets a pass using roughly @p minSamples elements, followed by passes where the stride is
+ * decreased by a factor of 7, ending with a pass over all the data using stride 1. Odd strides are
+ * used to avoid aliasing with the power of two dimensions common for volumes.
+ * Data with less than 7 * @p minSamples elements will only get a single pass.
+ */
+IVW_CORE_API std::vector<size_t> progressiveHistogramStrides(size_t size,
+                                                             size_t minSamples = size_t{1} << 20);
+
+namespace detail {
+
+/**
+ * Accumulates histograms and statistics for a range of data. Partial results calculated for
+ * separate parts of the data can be combined using merge, which is used to calculate histograms
+ * in parallel.
+ */
 template <typename T>
-std::vector<Histogram1D> calculateHistograms(std::span<const T> data, const DataMapper& dataMap,
-                                             size_t bins) {
+struct HistogramAccumulator {
     // a double type with the same extent as T
     using D = typename util::same_extent<T, double>::type;
-    // a size_t type with same extent as T
-    using I = typename util::same_extent<T, size_t>::type;
+    static constexpr size_t extent = util::rank<T>::value > 0 ? util::extent<T>::value : 1;
+    // number of independent accumulators used for scalar data to allow vectorization
+    static constexpr size_t lanes = 8;
+    // number of elements to process per block, the block is traversed twice, first for the
+    // statistics and then for the binning, and should fit in cache.
+    static constexpr size_t blockSize = 4096;
 
-    constexpr size_t extent = util::rank<T>::value > 0 ? util::extent<T>::value : 1;
+    HistogramAccumulator(const DataMapper& dataMap, size_t bins)
+        : rangeMin{dataMap.dataRange.x}
+        , rangeScaleFactor{static_cast<double>(bins - 1) /
+                           (dataMap.dataRange.y - dataMap.dataRange.x)}
+        , maxBin{bins - 1} {
+        for (auto& hist : hists) hist.resize(bins, 0);
+    }
 
-    // check whether number of bins exceeds the data range only if it is an integral type
-    if constexpr (!std::is_floating_point_v<util::value_type_t<T>>) {
-        bins =
-            std::min(bins, static_cast<std::size_t>(dataMap.dataRange.y - dataMap.dataRange.x + 1));
+    void add(std::span<const T> data) {
+        for (size_t offset = 0; offset < data.size(); offset += blockSize) {
+            const auto block = data.subspan(offset, std::min(blockSize, data.size() - offset));
+            addStats(block);
+            addBins(block);
+        }
+        count += data.size();
     }
 
-    std::array<std::vector<size_t>, extent> hists;
-    for (size_t i = 0; i < extent; ++i) {
-        hists[i].resize(bins, 0);
+    /**
+     * Add every stride:th element of data, starting with the first one.
+     */
+    void add(std::span<const T> data, size_t stride) {
+        if (stride <= 1) {
+            add(data);
+            return;
+        }
+        std::vector<T> block;
+        block.reserve(blockSize);
+        for (size_t i = 0; i < data.size(); i += stride) {
+            block.push_back(data[i]);
+            if (block.size() == blockSize) {
+                add(block);
+                block.clear();
+            }
+        }
+        add(block);
+    }
+
+    void merge(const HistogramAccumulator& other) {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+        sum += other.sum;
+        sum2 += other.sum2;
+        count += other.count;
+        for (size_t channel = 0; channel < extent; ++channel) {
+            std::transform(hists[channel].begin(), hists[channel].end(),
+                           other.hists[channel].begin(), hists[channel].begin(), std::plus<>{});
+            underflow[channel] += other.underflow[channel];
+            overflow[channel] += other.overflow[channel];
+        }
+    }
+
+    std::vector<Histogram1D> finalize(const DataMapper& dataMap) const {
+        const auto dcount = static_cast<double>(count);
+        const auto mean = sum / dcount;
+        const auto stddev = glm::sqrt((dcount * sum2 - sum * sum) / (dcount * (dcount - D{1})));
+
+        std::vector<Histogram1D> histograms;
+
+        for (size_t channel = 0; channel < extent; ++channel) {
+            const auto maxBinCount =
+                *std::max_element(hists[channel].begin(), hists[channel].end());
+
+            histograms.push_back(Histogram1D{
+                .counts = hists[channel],
+                .totalCounts = count,
+                .maxCount = maxBinCount,
+                .dataMap = dataMap,
+                .underflow = underflow[channel],
+                .overflow = overflow[channel],
+                .dataStats = {.min = util::glmcomp(min, channel),
+                              .max = util::glmcomp(max, channel),
+                              .mean = util::glmcomp(mean, channel),
+                              .standardDeviation = util::glmcomp(stddev, channel),
+                              .percentiles =
+                                  calculatePercentiles(hists[channel], dataMap.dataRange, count)},
+                .histStats = calculateHistogramStats(hists[channel]),
+            });
+        }
+
+        return histograms;
+    }
+
+    void addStats(std::span<const T> block) {
+        if constexpr (extent == 1) {
+            // Use independent accumulators without dependencies between them such that the
+            // compiler can vectorize the loop.
+            std::array<double, lanes> lmin;
+            std::array<double, lanes> lmax;
+            std::array<double, lanes> lsum{};
+            std::array<double, lanes> lsum2{};
+            lmin.fill(min);
+            lmax.fill(max);
+
+            const size_t end = block.size() - block.size() % lanes;
+            for (size_t i = 0; i < end; i += lanes) {
+                for (size_t l = 0; l < lanes; ++l) {
+                    const auto val = static_cast<double>(block[i + l]);
+                    lmin[l] = val < lmin[l] ? val : lmin[l];
+                    lmax[l] = val > lmax[l] ? val : lmax[l];
+                    lsum[l] += val;
+                    lsum2[l] += val * val;
+                }
+            }
+            for (size_t i = end; i < block.size(); ++i) {
+                const auto val = static_cast<double>(block[i]);
+                lmin[0] = val < lmin[0] ? val : lmin[0];
+                lmax[0] = val > lmax[0] ? val : lmax[0];
+                lsum[0] += val;
+                lsum2[0] += val * val;
+            }
+            for (size_t l = 0; l < lanes; ++l) {
+                min = glm::min(min, lmin[l]);
+                max = glm::max(max, lmax[l]);
+                sum += lsum[l];
+                sum2 += lsum2[l];
+            }
+        } else {
+            for (const auto& item : block) {
+                const auto val = static_cast<D>(item);
+                min = glm::min(min, val);
+                max = glm::max(max, val);
+                sum += val;
+                sum2 += val * val;
+            }
+        }
     }
 
-    D min(std::numeric_limits<double>::max());
-    D max(std::numeric_limits<double>::lowest());
-    D sum(0);
-    D sum2(0);
-    size_t count(0);
+    void addBins(std::span<const T> block) {
+        // Classify the bin position before converting it to an index, converting negative or
+        // non-finite values to size_t is undefined. NaN values are not counted in any bin.
+        const auto binEnd = static_cast<double>(maxBin + 1);
+        for (const auto& item : block) {
+            const auto pos = (static_cast<D>(item) - rangeMin) * rangeScaleFactor;
+            for (size_t channel = 0; channel < extent; ++channel) {
+                const double p = util::glmcomp(pos, channel);
+                if (p <= -1.0) {
+                    ++underflow[channel];
+                } else if (p < binEnd) {
+                    ++hists[channel][static_cast<size_t>(p)];
+                } else if (p >= binEnd) {
+                    ++overflow[channel];
+                }
+            }
+        }
+    }
+
+    const D rangeMin;
+    const D rangeScaleFactor;
+    const size_t maxBin;
 
+    std::array<std::vector<size_t>, extent> hists;
+    D min{std::numeric_limits<double>::max()};
+    D max{std::numeric_limits<double>::lowest()};
+    D sum{0};
+    D sum2{0};
+    size_t count{0};
     std::array<size_t, extent> underflow{0};
     std::array<size_t, extent> overflow{0};
+};
 
-    const D rangeMin(dataMap.dataRange.x);
-    const D rangeScaleFactor(static_cast<double>(bins - 1) /
-                             (dataMap.dataRange.y - dataMap.dataRange.x));
+}  // namespace detail
 
-    const size_t maxBin = bins - 1;
+/**
+ * Calculate a histogram for each channel of data. Large data is split into chunks that are
+ * processed in parallel on the thread pool, with a histogram per chunk that are merged in order at
+ * the end. The chunks only depend on the size of the data, hence the result is identical whether
+ * the chunks are processed in parallel or not. NaN values are ignored in the bins, min, and max.
+ * If @p stride is larger than one, only every stride:th element is used, resulting in an
+ * approximate histogram with Histogram1D::coverage set to the fraction of elements used.
+ */
+template <typename T>
+std::vector<Histogram1D> calculateHistograms(std::span<const T> data, const DataMapper& dataMap,
+                                             size_t bins, size_t stride = 1) {
+    // check whether number of bins exceeds the data range only if it is an integral type
+    if constexpr (!std::is_floating_point_v<util::value_type_t<T>>) {
+        bins =
+            std::min(bins, static_cast<std::size_t>(dataMap.dataRange.y - dataMap.dataRange.x + 1));
+    }
 
-    for (const auto& item : data) {
-        const auto val = static_cast<D>(item);
+    // Chunks should be large enough to amortize the merging of the per chunk histograms
+    constexpr size_t minChunkSize = size_t{1} << 20;
 
-        min = glm::min(min, val);
-        max = glm::max(max, val);
-        sum += val;
-        sum2 += val * val;
-        count++;
+    stride = std::max(stride, size_t{1});
+    const auto samples = (data.size() + stride - 1) / stride;
 
-        const auto ind = static_cast<I>((val - rangeMin) * rangeScaleFactor);
-        for (size_t channel = 0; channel < extent; ++channel) {
-            const auto v = util::glmcomp(ind, channel);
-            if (v < 0) {
-                ++underflow[channel];
-            } else if (v > maxBin) {
-                ++overflow[channel];
-            } else {
-                ++hists[channel][v];
+    detail::HistogramAccumulator<T> accumulator(dataMap, bins);
+
+    if (samples < 2 * minChunkSize) {
+        accumulator.add(data, stride);
+    } else {
+        const auto chunks = samples / minChunkSize;
+        const auto accumulate = [&](size_t chunkIndex) {
+            const auto start = (samples * chunkIndex) / chunks;
+            const auto end = (samples * (chunkIndex + 1)) / chunks;
+            const auto chunk = data.subspan(start * stride, (end - start - 1) * stride + 1);
+            detail::HistogramAccumulator<T> partial(dataMap, bins);
+            partial.add(chunk, stride);
+            return partial;
+        };
+
+        if (util::getPoolSize() == 0) {
+            for (size_t chunkIndex = 0; chunkIndex < chunks; ++chunkIndex) {
+                accumulator.merge(accumulate(chunkIndex));
+            }
+        } else {
+            std::vector<std::future<detail::HistogramAccumulator<T>>> futures;
+            for (size_t chunkIndex = 0; chunkIndex < chunks; ++chunkIndex) {
+                futures.push_back(util::dispatchPool(accumulate, chunkIndex));
+            }
+            for (auto& future : futures) {
+                util::getThreadPool().wait(future);
+                accumulator.merge(future.get());
             }
         }
     }
 
-    const auto dcount = static_cast<double>(count);
-    const auto mean = sum / dcount;
-    const auto stddev = glm::sqrt((dcount * sum2 - sum * sum) / (dcount * (dcount - D{1})));
-
-    std::vector<Histogram1D> histograms;
-
-    for (size_t channel = 0; channel < extent; ++channel) {
-        const auto maxBinCount = *std::max_element(hists[channel].begin(), hists[channel].end());
-
-        histograms.push_back(Histogram1D{
-            .counts = hists[channel],
-            .totalCounts = count,
-            .maxCount = maxBinCount,
-            .dataMap = dataMap,
-            .underflow = underflow[channel],
-            .overflow = overflow[channel],
-            .dataStats = {.min = util::glmcomp(min, channel),
-                          .max = util::glmcomp(max, channel),
-                          .mean = util::glmcomp(mean, channel),
-                          .standardDeviation = util::glmcomp(stddev, channel),
-                          .percentiles =
-                              calculatePercentiles(hists[channel], dataMap.dataRange, count)},
-            .histStats = calculateHistogramStats(hists[channel]),
-        });
+    auto histograms = accumulator.finalize(dataMap);
+    if (!data.empty()) {
+        for (auto& histogram : histograms) {
+            histogram.coverage = static_cast<double>(samples) / static_cast<double>(data.size());
+        }
     }
-
     return histograms;
 }
 
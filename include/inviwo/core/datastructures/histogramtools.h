@@ -39,11 +39,30 @@
 
 namespace inviwo {
 
+/**
+ * Caches the histograms of some data and calculates them in the background on request. The
+ * histograms can be calculated progressively, where approximate histograms from a subsample of the
+ * data are published first and then refined by subsequent passes. All the callbacks are invoked
+ * on the main thread for each refinement, with Histogram1D::coverage indicating the fraction of
+ * the data used. The strides only reduce the binning work, the calculate function has to have
+ * access to all of the data already for the first pass.
+ */
 class IVW_CORE_API HistogramCache {
 public:
     using Callback = void(const std::vector<Histogram1D>&);
+    /**
+     * Calculates histograms using every stride:th element of the data
+     */
+    using ProgressiveCalculate = std::vector<Histogram1D>(size_t stride);
 
-    enum class Progress { Done, Calculating, NoData };
+    /**
+     * Done: the histograms are calculated and whenDone has been called.
+     * Calculating: the histograms are being calculated, whenDone will be called later.
+     * Approximate: whenDone has been called with approximate histograms, and will be called again
+     * with refined histograms.
+     * NoData: there is no data to calculate histograms for.
+     */
+    enum class Progress { Done, Calculating, Approximate, NoData };
     struct Result {
         DispatcherHandle<Callback> handle = nullptr;
         Progress progress = Progress::NoData;
@@ -59,11 +78,23 @@ public:
     Result calculateHistograms(const std::function<std::vector<Histogram1D>()>& calculate,
                                const std::function<Callback>& whenDone) const;
 
+    /**
+     * Calculate the histograms progressively, @p calculate is called once for each of the
+     * @p strides in order and the result of each pass is published to the callbacks. The last
+     * stride should be 1 to end up with the exact histograms.
+     * @see util::progressiveHistogramStrides
+     */
+    Result calculateHistograms(const std::function<ProgressiveCalculate>& calculate,
+                               const std::vector<size_t>& strides,
+                               const std::function<Callback>& whenDone) const;
+
     void forEach(const std::function<void(const Histogram1D&, size_t)>&) const;
     void discard(const std::function<std::vector<Histogram1D>()>& calculate);
+    void discard(const std::function<ProgressiveCalculate>& calculate,
+                 const std::vector<size_t>& strides);
 
 private:
-    enum class Status { Valid, Calculating, NotSet };
+    enum class Status { Valid, Approximate, Calculating, NotSet };
     struct State {
         std::mutex mutex;
         std::vector<Histogram1D> histograms;
@@ -46,6 +46,8 @@ public:
         std::shared_ptr<const LayerDisk> source) const override;
     virtual void update(std::shared_ptr<const LayerDisk> source,
                         std::shared_ptr<LayerRAM> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 }  // namespace inviwo
@@ -32,6 +32,7 @@
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/util/exception.h>
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -44,6 +45,56 @@ public:
     using Exception::Exception;
 };
 
+/**
+ * An estimate of the cost of a conversion, used to pick the cheapest path of converters between two
+ * representations. All amounts are relative to the size of the source data, i.e. a converter that
+ * reads all of the source and writes a copy of it touches 2 bytes per source byte.
+ * @see RepresentationConverter::getCost
+ */
+struct IVW_CORE_API ConversionCost {
+    double bytesTouched = 2.0;     ///< Bytes read and written per byte of source data
+    double copies = 1.0;           ///< Number of new copies of the data that are allocated
+    double deviceTransfers = 0.0;  ///< Number of transfers to or from a device or disk
+
+    /// Relative weight of allocating a copy compared to touching the same number of bytes
+    static constexpr double copyWeight = 1.0;
+    /// Relative weight of a device transfer compared to touching the same number of bytes
+    static constexpr double transferWeight = 8.0;
+
+    /**
+     * The combined cost, in bytes touched per byte of source data
+     */
+    constexpr double total() const {
+        return bytesTouched + copyWeight * copies + transferWeight * deviceTransfers;
+    }
+
+    /// No copies or transfers, for converters that share the data of the source
+    static constexpr ConversionCost shared() { return {0.0, 0.0, 0.0}; }
+    /// A full copy in host memory
+    static constexpr ConversionCost copy() { return {2.0, 1.0, 0.0}; }
+    /// A full copy between host memory and a device, or disk
+    static constexpr ConversionCost transfer() { return {2.0, 1.0, 1.0}; }
+};
+
+/**
+ * Counters for the conversions done by one RepresentationConverter
+ * @see RepresentationConverterFactory::getStatistics
+ */
+struct IVW_CORE_API ConversionStatistics {
+    size_t created = 0;                ///< Number of representations created using createFrom
+    size_t updated = 0;                ///< Number of representations updated using update
+    size_t bytes = 0;                  ///< Estimated number of source bytes converted
+    std::chrono::nanoseconds time{0};  ///< Time spent in createFrom and update
+
+    ConversionStatistics& operator+=(const ConversionStatistics& rhs) {
+        created += rhs.created;
+        updated += rhs.updated;
+        bytes += rhs.bytes;
+        time += rhs.time;
+        return *this;
+    }
+};
+
 /**
  * A base type for all RepresentationConverters
  * @see RepresentationConverter
@@ -73,6 +124,12 @@ public:
     virtual std::shared_ptr<BaseRepr> createFrom(std::shared_ptr<const BaseRepr> source) const = 0;
     virtual void update(std::shared_ptr<const BaseRepr> source,
                         std::shared_ptr<BaseRepr> destination) const = 0;
+
+    /**
+     * The estimated cost of a conversion, used by the RepresentationConverterFactory to pick the
+     * cheapest path between two representations. The default is a full copy in host memory.
+     */
+    virtual ConversionCost getCost() const { return ConversionCost::copy(); }
 };
 
 /**
@@ -115,6 +172,11 @@ public:
     using ConverterList = std::vector<const RepresentationConverter<BaseRepr>*>;
 
     size_t steps() const;
+    /**
+     * The sum of the total costs of all the converters in the package
+     * @see ConversionCost::total
+     */
+    double cost() const;
     ConverterID getConverterID() const;
 
     void addConverter(const RepresentationConverter<BaseRepr>* converter);
@@ -139,6 +201,15 @@ size_t RepresentationConverterPackage<BaseRepr>::steps() const {
     return converters_.size();
 }
 
+template <typename BaseRepr>
+double RepresentationConverterPackage<BaseRepr>::cost() const {
+    double sum = 0.0;
+    for (auto* converter : converters_) {
+        sum += converter->getCost().total();
+    }
+    return sum;
+}
+
 template <typename BaseRepr>
 auto RepresentationConverterPackage<BaseRepr>::getConverterID() const -> ConverterID {
     return ConverterID(converters_.front()->getConverterID().first,
@@ -35,11 +35,15 @@
 
 #include <warn/push>
 #include <warn/ignore/all>
+#include <chrono>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <typeindex>
 #include <unordered_set>
 #include <unordered_map>
+#include <utility>
 #include <warn/pop>
 
 namespace inviwo {
@@ -72,6 +76,7 @@ public:
     using PackageMap =
         std::unordered_multimap<ConverterID,
                                 std::unique_ptr<RepresentationConverterPackage<BaseRepr>>>;
+    using StatisticsMap = std::unordered_map<ConverterID, ConversionStatistics>;
     RepresentationConverterFactory() = default;
     virtual ~RepresentationConverterFactory() = default;
 
@@ -83,20 +88,44 @@ public:
     bool registerObject(RepresentationConverter<BaseRepr>* representationConverter);
     bool unRegisterObject(RepresentationConverter<BaseRepr>* representationConverter);
 
-    // Get best converter
+    /**
+     * Get the cheapest package of converters from one representation to an other. The cost of a
+     * package is the sum of the costs of its converters, @see RepresentationConverter::getCost.
+     * Among packages of equal cost the one with the fewest steps is used.
+     */
     const RepresentationConverterPackage<BaseRepr>* getRepresentationConverter(ConverterID);
     const RepresentationConverterPackage<BaseRepr>* getRepresentationConverter(std::type_index from,
                                                                                std::type_index to);
 
+    /**
+     * Record a conversion done by the converter with the given id, called by Data when converting
+     * representations.
+     * @param id the id of the converter
+     * @param created true if a representation was created, false if one was updated
+     * @param bytes the estimated size of the converted data in bytes
+     * @param time the time spent in the converter
+     */
+    void addStatistics(ConverterID id, bool created, size_t bytes, std::chrono::nanoseconds time);
+
+    /**
+     * The number of conversions, bytes, and time spent for each converter since the start or the
+     * last call to resetStatistics.
+     */
+    StatisticsMap getStatistics() const;
+    void resetStatistics();
+
 private:
     const RepresentationConverterPackage<BaseRepr>* createConverterPackage(ConverterID id);
 
     // converters are owned by the Module
     RepMap converters_;
 
-    // All the converter packages created locally;
-    std::mutex mutex_;
+    // All the converter packages created locally, the lookups only need a shared lock
+    mutable std::shared_mutex mutex_;
     PackageMap packages_;
+
+    mutable std::mutex statisticsMutex_;
+    StatisticsMap statistics_;
 };
 
 template <typename BaseRepr>
@@ -124,6 +153,7 @@ bool RepresentationConverterFactory<BaseRepr>::unRegisterObject(
     size_t removed = std::erase_if(
         converters_, [converter](const auto& elem) { return elem.second == converter; });
 
+    std::unique_lock lock(mutex_);
     std::erase_if(packages_, [converter](const auto& elem) {
         for (auto& conv : elem.second->getConverters()) {
             if (conv == converter) return true;
@@ -137,22 +167,13 @@ bool RepresentationConverterFactory<BaseRepr>::unRegisterObject(
 template <typename BaseRepr>
 const RepresentationConverterPackage<BaseRepr>*
 RepresentationConverterFactory<BaseRepr>::getRepresentationConverter(ConverterID id) {
-    RepresentationConverterPackage<BaseRepr>* res = nullptr;
-    constexpr size_t steps = std::numeric_limits<size_t>::max();
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-        auto range = packages_.equal_range(id);
-        for (auto it = range.first; it != range.second; ++it) {
-            if (it->second->steps() < steps) {
-                res = it->second.get();
-            }
+        std::shared_lock lock(mutex_);
+        if (auto it = packages_.find(id); it != packages_.end()) {
+            return it->second.get();
         }
     }
-    if (res) {
-        return res;
-    } else {
-        return createConverterPackage(id);
-    }
+    return createConverterPackage(id);
 }
 
 template <typename BaseRepr>
@@ -162,12 +183,41 @@ RepresentationConverterFactory<BaseRepr>::getRepresentationConverter(std::type_i
     return getRepresentationConverter(ConverterID(from, to));
 }
 
+template <typename BaseRepr>
+void RepresentationConverterFactory<BaseRepr>::addStatistics(ConverterID id, bool created,
+                                                             size_t bytes,
+                                                             std::chrono::nanoseconds time) {
+    std::scoped_lock lock(statisticsMutex_);
+    statistics_[id] += ConversionStatistics{.created = created ? size_t{1} : size_t{0},
+                                            .updated = created ? size_t{0} : size_t{1},
+                                            .bytes = bytes,
+                                            .time = time};
+}
+
+template <typename BaseRepr>
+auto RepresentationConverterFactory<BaseRepr>::getStatistics() const -> StatisticsMap {
+    std::scoped_lock lock(statisticsMutex_);
+    return statistics_;
+}
+
+template <typename BaseRepr>
+void RepresentationConverterFactory<BaseRepr>::resetStatistics() {
+    std::scoped_lock lock(statisticsMutex_);
+    statistics_.clear();
+}
+
 template <typename BaseRepr>
 const RepresentationConverterPackage<BaseRepr>*
 RepresentationConverterFactory<BaseRepr>::createConverterPackage(ConverterID id) {
     /* Implementation of Dijkstra's algorithm following
      * https://en.wikipedia.org/wiki/Dijkstra's_algorithm#Pseudocode
+     * The distance is the total cost of the converters along the path, ties are broken by the
+     * number of steps.
      */
+    using Distance = std::pair<double, size_t>;
+    constexpr Distance infinity{std::numeric_limits<double>::max(),
+                                std::numeric_limits<size_t>::max()};
+
     std::type_index source = id.first;
     std::type_index target = id.second;
 
@@ -177,39 +227,40 @@ RepresentationConverterFactory<BaseRepr>::createConverterPackage(ConverterID id)
         verts.insert(converter.first.second);
     }
 
-    std::unordered_map<std::type_index, size_t> dist;
+    std::unordered_map<std::type_index, Distance> dist;
     std::unordered_map<std::type_index, std::type_index> prev;
 
-    dist[source] = 0;
+    dist[source] = Distance{0.0, 0};
 
     std::unordered_set<std::type_index> Q;
     for (const auto& v : verts) {
         if (v != source) {
-            dist[v] = std::numeric_limits<size_t>::max();
+            dist[v] = infinity;
         }
         Q.insert(v);
     }
 
     while (!Q.empty()) {
-        std::size_t steps = std::numeric_limits<size_t>::max();
+        Distance shortest = infinity;
         std::type_index u = *Q.begin();
         for (const auto& t : Q) {
-            if (dist[t] < steps) {
-                steps = dist[t];
+            if (dist[t] < shortest) {
+                shortest = dist[t];
                 u = t;
             }
         }
         Q.erase(u);
 
-        if (u == target) break;
+        if (u == target || shortest == infinity) break;
 
         for (const auto& converter : converters_) {
             if (converter.first.first == u) {
                 auto v = converter.first.second;
-                size_t alt = dist[u] + 1;
+                const Distance alt{dist[u].first + converter.second->getCost().total(),
+                                   dist[u].second + 1};
                 if (alt < dist[v]) {
                     dist[v] = alt;
-                    prev.emplace(std::make_pair(v, u));
+                    prev.insert_or_assign(v, u);
                 }
             }
         }
@@ -229,11 +280,14 @@ RepresentationConverterFactory<BaseRepr>::createConverterPackage(ConverterID id)
         for (auto it = S.crbegin(); it != S.crend(); it++) {
             package->addConverter(*it);
         }
-        auto res = package.get();
-        {
-            std::unique_lock<std::mutex> lock(mutex_);
-            packages_.emplace(std::make_pair(package->getConverterID(), std::move(package)));
+
+        std::unique_lock lock(mutex_);
+        // An other thread might have created the same package while we were searching
+        if (auto it = packages_.find(id); it != packages_.end()) {
+            return it->second.get();
         }
+        auto res = package.get();
+        packages_.emplace(std::make_pair(package->getConverterID(), std::move(package)));
         return res;
     } else {
         return nullptr;
@@ -0,0 +1,228 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <array>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace inviwo {
+
+class VolumeRAM;
+
+/**
+ * \ingroup datastructures
+ * Interface for a source of volume data that can be read in parts, used by VolumeBricked to load
+ * bricks on demand. Implementations need to be thread safe since bricks might be requested from
+ * several threads concurrently.
+ * \see RawVolumeBrickSource
+ */
+class IVW_CORE_API VolumeBrickSource {
+public:
+    virtual ~VolumeBrickSource() = default;
+
+    virtual size3_t getDimensions() const = 0;
+    virtual const DataFormatBase* getDataFormat() const = 0;
+
+    /**
+     * Read the region [offset, offset + extent) of the volume into @p dest. The data is written
+     * linearized in x, then y, then z, i.e. @p dest has to hold `glm::compMul(extent)` voxels.
+     */
+    virtual void read(size3_t offset, size3_t extent, void* dest) const = 0;
+};
+
+/**
+ * \ingroup datastructures
+ * A read-only volume representation for data that does not fit into memory. The volume is split
+ * into bricks of a fixed size which are loaded on demand from a VolumeBrickSource. Loaded bricks
+ * are kept in an LRU cache, and the least recently used bricks are evicted when the resident
+ * bricks exceed the memory budget. At least one brick is always kept resident, and bricks that are
+ * still referenced by a caller stay valid after being evicted.
+ *
+ * The getAs* functions look up the brick in the cache for every call, which requires a lock. Use
+ * a VolumeBricked::Cursor, util::forEachVoxel or getBrick directly when accessing many voxels.
+ *
+ * A VolumeBricked can be converted into a VolumeRAM, which will load the whole volume. A VolumeDisk
+ * loaded by a RawVolumeRAMLoader can be converted into a VolumeBricked.
+ *
+ * \see util::forEachVoxel, VolumeSampler
+ */
+class IVW_CORE_API VolumeBricked : public VolumeRepresentation {
+public:
+    static constexpr auto defaultBrickSize = size3_t(64, 64, 64);
+    static constexpr size_t defaultMemoryBudget = size_t{512} << 20;
+
+    VolumeBricked(std::shared_ptr<const VolumeBrickSource> source,
+                  size3_t brickSize = defaultBrickSize,
+                  size_t memoryBudget = defaultMemoryBudget,
+                  const SwizzleMask& swizzleMask = VolumeConfig::defaultSwizzleMask,
+                  InterpolationType interpolation = VolumeConfig::defaultInterpolation,
+                  const Wrapping3D& wrapping = VolumeConfig::defaultWrapping);
+    VolumeBricked(const VolumeBricked& rhs);
+    VolumeBricked& operator=(const VolumeBricked& that);
+    virtual VolumeBricked* clone() const override;
+    virtual ~VolumeBricked();
+
+    virtual std::type_index getTypeIndex() const override final;
+
+    virtual const DataFormatBase* getDataFormat() const override;
+
+    /**
+     * The dimensions of a VolumeBricked are given by its source and can not be changed.
+     * @throws Exception
+     */
+    virtual void setDimensions(size3_t dimensions) override;
+    virtual const size3_t& getDimensions() const override;
+
+    virtual void setSwizzleMask(const SwizzleMask& mask) override;
+    virtual SwizzleMask getSwizzleMask() const override;
+
+    virtual void setInterpolation(InterpolationType interpolation) override;
+    virtual InterpolationType getInterpolation() const override;
+
+    virtual void setWrapping(const Wrapping3D& wrapping) override;
+    virtual Wrapping3D getWrapping() const override;
+
+    const std::shared_ptr<const VolumeBrickSource>& getSource() const;
+
+    size3_t getBrickSize() const;
+    /**
+     * The number of bricks in each direction, the bricks at the upper boundary might be smaller
+     * than the brick size.
+     */
+    size3_t getNumberOfBricks() const;
+    /**
+     * @return the index of the brick containing voxel @p pos
+     */
+    size3_t getBrickIndex(const size3_t& pos) const;
+    /**
+     * @return the position of the first voxel of brick @p brick
+     */
+    size3_t getBrickOffset(const size3_t& brick) const;
+    /**
+     * @return the dimensions of brick @p brick
+     */
+    size3_t getBrickExtent(const size3_t& brick) const;
+
+    /**
+     * Get brick @p brick, loading it from the source if it is not resident. The brick is a
+     * VolumeRAM with dimensions getBrickExtent(brick) covering the voxels starting at
+     * getBrickOffset(brick).
+     */
+    std::shared_ptr<const VolumeRAM> getBrick(const size3_t& brick) const;
+
+    /**
+     * Caches references to the most recently used bricks of a VolumeBricked, such that repeated
+     * voxel accesses within those bricks neither take the lock of the volume nor look up the
+     * brick in its cache. A cursor is not thread safe, use one per thread. The referenced bricks
+     * are kept alive by the cursor even if they are evicted from the volume.
+     */
+    class IVW_CORE_API Cursor {
+    public:
+        explicit Cursor(const VolumeBricked& volume);
+
+        /**
+         * @return the brick containing voxel @p pos and the position of @p pos within that brick
+         */
+        std::pair<const VolumeRAM*, size3_t> locate(const size3_t& pos);
+
+    private:
+        static constexpr size_t slots = 8;
+        const VolumeBricked* volume_;
+        std::array<size3_t, slots> index_{};
+        std::array<std::shared_ptr<const VolumeRAM>, slots> bricks_{};
+        size_t next_ = 0;
+    };
+
+    double getAsDouble(const size3_t& pos) const;
+    dvec2 getAsDVec2(const size3_t& pos) const;
+    dvec3 getAsDVec3(const size3_t& pos) const;
+    dvec4 getAsDVec4(const size3_t& pos) const;
+
+    double getAsNormalizedDouble(const size3_t& pos) const;
+    dvec2 getAsNormalizedDVec2(const size3_t& pos) const;
+    dvec3 getAsNormalizedDVec3(const size3_t& pos) const;
+    dvec4 getAsNormalizedDVec4(const size3_t& pos) const;
+
+    /**
+     * Set the maximum number of bytes of resident bricks. Bricks are evicted immediately if the
+     * new budget is smaller than the current usage.
+     */
+    void setMemoryBudget(size_t bytes);
+    size_t getMemoryBudget() const;
+    /**
+     * @return the number of bytes of currently resident bricks
+     */
+    size_t getResidentBytes() const;
+    /**
+     * Evict all resident bricks
+     */
+    void clearCache();
+
+    struct CacheStats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
+    CacheStats getCacheStats() const;
+
+private:
+    std::shared_ptr<const VolumeRAM> findBrick(size_t index) const;
+    void evict(size_t keep) const;
+
+    std::shared_ptr<const VolumeBrickSource> source_;
+    size3_t dimensions_;
+    size3_t brickSize_;
+    size3_t numBricks_;
+    SwizzleMask swizzleMask_;
+    InterpolationType interpolation_;
+    Wrapping3D wrapping_;
+
+    struct Entry {
+        std::shared_ptr<const VolumeRAM> brick;
+        std::list<size_t>::iterator lru;
+    };
+    mutable std::mutex mutex_;
+    mutable std::list<size_t> lru_;  // brick indices, most recently used first
+    mutable std::unordered_map<size_t, Entry> bricks_;
+    mutable size_t residentBytes_ = 0;
+    mutable CacheStats stats_;
+    size_t memoryBudget_;
+};
+
+}  // namespace inviwo
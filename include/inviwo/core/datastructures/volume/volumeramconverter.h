@@ -44,6 +44,8 @@ public:
         std::shared_ptr<const VolumeDisk> source) const override;
     virtual void update(std::shared_ptr<const VolumeDisk> source,
                         std::shared_ptr<VolumeRAM> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 }  // namespace inviwo
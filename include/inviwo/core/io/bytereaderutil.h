@@ -32,6 +32,7 @@
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <string_view>
 #include <filesystem>
+#include <cstddef>
 
 namespace inviwo {
 
@@ -40,6 +41,12 @@ namespace util {
 void IVW_CORE_API readBytesIntoBuffer(const std::filesystem::path& file, size_t offset,
                                       size_t bytes, bool littleEndian, size_t elementSize,
                                       void* dest);
+
+/**
+ * Reverse the byte order of each element of size @p elementSize in @p data in place.
+ * @p bytes has to be a multiple of @p elementSize.
+ */
+void IVW_CORE_API swapEndianInPlace(void* data, size_t bytes, size_t elementSize);
 }  // namespace util
 
 }  // namespace inviwo
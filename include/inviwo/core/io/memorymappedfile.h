@@ -0,0 +1,88 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <filesystem>
+#include <cstddef>
+#include <span>
+
+namespace inviwo {
+
+/**
+ * \class MemoryMappedFile
+ * \brief RAII class for a read only memory mapping of a part of a file.
+ * The pages of the file are loaded on demand when the memory is accessed. The mapping is private,
+ * i.e. copy-on-write, hence the memory may be modified but changes are never written back to the
+ * file.
+ */
+class IVW_CORE_API MemoryMappedFile {
+public:
+    /**
+     * Map @p size bytes of @p file into memory starting at @p offset. If @p size is zero, the
+     * rest of the file after @p offset is mapped.
+     * @throw FileException if the file could not be opened or mapped
+     */
+    MemoryMappedFile(const std::filesystem::path& file, size_t offset = 0, size_t size = 0);
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    MemoryMappedFile(MemoryMappedFile&& rhs) noexcept;
+    MemoryMappedFile& operator=(MemoryMappedFile&& rhs) noexcept;
+    ~MemoryMappedFile();
+
+    void* data() { return data_; }
+    const void* data() const { return data_; }
+    size_t size() const { return size_; }
+
+    std::span<std::byte> bytes() { return {static_cast<std::byte*>(data_), size_}; }
+    std::span<const std::byte> bytes() const {
+        return {static_cast<const std::byte*>(data_), size_};
+    }
+
+    /**
+     * Hint the operating system that the mapped memory will be accessed sequentially
+     */
+    void adviseSequential() const;
+
+private:
+    void unmap() noexcept;
+
+    void* mapping_ = nullptr;   //< start of the mapping, aligned to the allocation granularity
+    size_t mappingSize_ = 0;
+    void* data_ = nullptr;      //< the requested offset into the mapping
+    size_t size_ = 0;
+#ifdef WIN32
+    void* fileHandle_ = nullptr;
+    void* mappingHandle_ = nullptr;
+#endif
+};
+
+}  // namespace inviwo
@@ -34,6 +34,7 @@
 #include <inviwo/core/io/datareaderexception.h>
 #include <inviwo/core/datastructures/diskrepresentation.h>
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
 
 #include <string>
 #include <memory>
@@ -44,20 +45,61 @@ namespace inviwo {
  * \class RawVolumeRAMLoader
  * \brief A loader of raw files. Used to create VolumeRAM representations.
  * This class us used by the DatVolumeSequenceReader, IvfVolumeReader and RawVolumeReader.
+ *
+ * By default the data is copied into the VolumeRAM. If @p memoryMap is true and the file has
+ * native byte order, the VolumeRAM will instead be backed by a private memory mapping of the file.
+ * Pages of the file are then loaded on demand when accessed, and the peak memory usage during load
+ * is avoided. Modifications of the VolumeRAM are never written back to the file. Note that the
+ * file must not be truncated while it is mapped.
  */
-
 class IVW_CORE_API RawVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation> {
 public:
-    RawVolumeRAMLoader(const std::filesystem::path& rawFile, size_t offset, bool littleEndian);
+    RawVolumeRAMLoader(const std::filesystem::path& rawFile, size_t offset, bool littleEndian,
+                       bool memoryMap = false);
     virtual RawVolumeRAMLoader* clone() const override;
     virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
         const VolumeRepresentation& src) const override;
     virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
                                       const VolumeRepresentation& src) const override;
 
+    /**
+     * Create a source for loading bricks of the raw file on demand, used to create a VolumeBricked
+     * representation with the dimensions and format of @p src.
+     */
+    std::shared_ptr<VolumeBrickSource> createBrickSource(const VolumeRepresentation& src) const;
+    /**
+     * Create a VolumeBricked representation with default brick size and memory budget that loads
+     * bricks of the raw file on demand. Used by the readers when the "Bricked" option is set.
+     */
+    std::shared_ptr<VolumeBricked> createBricked(const VolumeRepresentation& src) const;
+
+private:
+    std::filesystem::path rawFile_;
+    size_t offset_;
+    bool littleEndian_;
+    bool memoryMap_;
+};
+
+/**
+ * \class RawVolumeBrickSource
+ * \brief Reads subregions of a raw file, used by VolumeBricked to load bricks on demand.
+ * Each read opens the file separately, so reads from several threads can happen concurrently.
+ */
+class IVW_CORE_API RawVolumeBrickSource : public VolumeBrickSource {
+public:
+    RawVolumeBrickSource(const std::filesystem::path& rawFile, size_t offset, size3_t dimensions,
+                         const DataFormatBase* format, bool littleEndian);
+    virtual ~RawVolumeBrickSource() = default;
+
+    virtual size3_t getDimensions() const override;
+    virtual const DataFormatBase* getDataFormat() const override;
+    virtual void read(size3_t offset, size3_t extent, void* dest) const override;
+
 private:
     std::filesystem::path rawFile_;
     size_t offset_;
+    size3_t dimensions_;
+    const DataFormatBase* format_;
     bool littleEndian_;
 };
 
@@ -45,6 +45,11 @@ class MetaDataOwner;
 
 /**
  * \ingroup dataio
+ * Supported options:
+ *  - "MemoryMap" (bool, default false): Back the loaded VolumeRAM by a memory mapping of the raw
+ *    file when it has native byte order, see RawVolumeRAMLoader.
+ *  - "Bricked" (bool, default false): Also add a VolumeBricked representation that loads bricks
+ *    of the raw file on demand, see RawVolumeRAMLoader::createBricked.
  */
 class IVW_CORE_API RawVolumeReader : public DataReaderType<Volume> {
 public:
@@ -61,6 +66,9 @@ public:
     virtual std::shared_ptr<Volume> readData(const std::filesystem::path& filePath,
                                              MetaDataOwner* metadata) override;
 
+    virtual bool setOption(std::string_view key, std::any value) override;
+    virtual std::any getOption(std::string_view key) override;
+
     bool haveReadLittleEndian() const { return littleEndian_; }
     const DataFormatBase* getFormat() const { return format_; }
 
@@ -73,6 +81,8 @@ private:
     DataMapper dataMapper_;
     size_t byteOffset_;
     bool parametersSet_;
+    bool memoryMap_;
+    bool bricked_;
 };
 
 }  // namespace inviwo
@@ -35,11 +35,68 @@
 #include <inviwo/core/network/processornetworkevaluationobserver.h>
 #include <inviwo/core/network/evaluationerrorhandler.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace inviwo {
 
 class Processor;
 class ProcessorNetwork;
 
+/**
+ * How the ProcessorNetworkEvaluator schedules invalid processors during an evaluation.
+ */
+enum class EvaluationMode {
+    /**
+     * Processors are processed one after another in topological order on the main thread.
+     */
+    Serial,
+    /**
+     * Processors whose predecessors are done are processed concurrently. Processors that are not
+     * main thread bound run Processor::process() on the thread pool, while initializeResources,
+     * inport onChange callbacks, observer notifications and setValid always run on the main thread.
+     * @see Processor::isMainThreadBound
+     */
+    Concurrent
+};
+
+/**
+ * Timings of a single evaluation of a processor, gathered by the ProcessorNetworkEvaluator.
+ * All times are in milliseconds.
+ */
+struct IVW_CORE_API EvaluationSample {
+    /// Time spent in Processor::process()
+    double process = 0.0;
+    /// Time spent in the inport onChange callbacks before processing
+    double onChange = 0.0;
+    /// Time spent in Processor::initializeResources(), zero if the resources were valid
+    double initializeResources = 0.0;
+    /// Time from the processor being invalidated until it was set valid by this evaluation
+    double invalid = 0.0;
+
+    EvaluationSample& operator+=(const EvaluationSample& rhs);
+};
+
+/**
+ * Per processor evaluation metrics, gathered by the ProcessorNetworkEvaluator.
+ * @see ProcessorNetworkEvaluator::getMetrics
+ */
+struct IVW_CORE_API ProcessorMetrics {
+    /// Number of times the processor has been processed
+    size_t evaluations = 0;
+    /// Number of evaluations where the processor was invalid but skipped since it was not ready
+    size_t skippedNotReady = 0;
+    /// Sum of all samples, including the ones that have been dropped from the history
+    EvaluationSample total;
+    /// The latest samples, oldest first
+    std::deque<EvaluationSample> history;
+};
+
 class IVW_CORE_API ProcessorNetworkEvaluator : public ProcessorNetworkObserver,
                                                public ProcessorObserver,
                                                public ProcessorNetworkEvaluationObservable {
@@ -50,6 +107,38 @@ public:
     virtual ~ProcessorNetworkEvaluator() = default;
     void setExceptionHandler(EvaluationErrorHandler handler);
 
+    /**
+     * Select how the network is evaluated, EvaluationMode::Serial by default.
+     * @see EvaluationMode
+     */
+    void setEvaluationMode(EvaluationMode mode);
+    EvaluationMode getEvaluationMode() const;
+
+    /**
+     * Enable or disable the gathering of evaluation metrics, enabled by default.
+     * @see getMetrics
+     */
+    void setMetricsEnabled(bool enabled);
+    bool getMetricsEnabled() const;
+
+    /**
+     * Set the number of samples kept in ProcessorMetrics::history for each processor, 100 by
+     * default. Existing histories are truncated if needed.
+     */
+    void setMetricsHistorySize(size_t size);
+    size_t getMetricsHistorySize() const;
+
+    /**
+     * The metrics gathered for @p processor, or nullptr if the processor has not been evaluated
+     * since it was added or since the metrics were cleared.
+     */
+    const ProcessorMetrics* getMetrics(const Processor* processor) const;
+    /**
+     * The metrics of all processors currently in the network that have been evaluated.
+     */
+    const std::unordered_map<const Processor*, ProcessorMetrics>& getMetrics() const;
+    void clearMetrics();
+
 private:
     // ProcessorNetworkObserver overrides
     virtual void onProcessorNetworkEvaluateRequest() override;
@@ -62,16 +151,49 @@ private:
     // ProcessorObserver overrides
     virtual void onProcessorSinkChanged(Processor*) override;
     virtual void onProcessorActiveConnectionsChanged(Processor*) override;
+    virtual void onProcessorInvalidationEnd(Processor*) override;
 
     void requestEvaluate();
     void evaluate();
+    void evaluateSerial();
+    void evaluateConcurrent();
+    void updateDependencies();
+
+    /**
+     * Run initializeResources, inport onChange callbacks and notifyObserversAboutToProcess, or
+     * doIfNotReady if the processor is not ready.
+     * @return true if the processor should be processed
+     */
+    bool beforeProcess(Processor* processor);
+    /**
+     * Set the processor valid if it is still ready and record the metrics of the evaluation
+     * @param processTime the time spent in Processor::process()
+     */
+    void afterProcess(Processor* processor, std::chrono::nanoseconds processTime);
+    void recordMetrics(Processor* processor, EvaluationSample sample);
 
     ProcessorNetwork* processorNetwork_;
     // the sorted list of processors obtained through topological sorting
     std::vector<Processor*> processorsSorted_;
+    // the indices into processorsSorted_ of the direct successors of each processor, and the
+    // number of direct predecessors of each processor. Only used in EvaluationMode::Concurrent
+    std::vector<std::vector<size_t>> successors_;
+    std::vector<size_t> predecessorCount_;
     bool needsSorting_;
     bool evaluationQueued_;
+    EvaluationMode evaluationMode_;
     EvaluationErrorHandler exceptionHandler_;
+
+    // read in onProcessorInvalidationEnd, which can be called from the thread pool
+    std::atomic<bool> metricsEnabled_;
+    size_t metricsHistorySize_;
+    std::unordered_map<const Processor*, ProcessorMetrics> metrics_;
+    // the onChange and initializeResources timings of the processors currently being processed
+    std::unordered_map<const Processor*, EvaluationSample> pending_;
+    // the time each invalid processor was invalidated. Processors processed on the thread pool
+    // can invalidate themselves from there, hence the map is guarded by invalidSinceMutex_
+    std::unordered_map<const Processor*, std::chrono::steady_clock::time_point> invalidSince_;
+    std::mutex invalidSinceMutex_;
 };
 
 }  // namespace inviwo
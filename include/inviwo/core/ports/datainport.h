@@ -36,10 +36,13 @@
 #include <inviwo/core/ports/dataoutport.h>
 #include <inviwo/core/ports/outportiterable.h>
 #include <inviwo/core/ports/inportiterable.h>
+#include <inviwo/core/datastructures/data.h>
 #include <inviwo/core/datastructures/datatraits.h>
 #include <inviwo/core/util/glmvec.h>
 #include <inviwo/core/util/document.h>
+#include <inviwo/core/util/threadutil.h>
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -54,7 +57,9 @@ namespace inviwo {
  * outport with vector data of type T and merge them into the data return data vector.
  */
 template <typename T, size_t N = 1, bool Flat = false>
-class DataInport : public Inport, public InportIterable<DataInport<T, N, Flat>, T, Flat> {
+class DataInport : public Inport,
+                   public InportIterable<DataInport<T, N, Flat>, T, Flat>,
+                   public DataPrefetcher<T> {
 public:
     using type = T;
     using value_type = std::shared_ptr<const T>;
@@ -79,6 +84,24 @@ public:
     virtual std::vector<std::pair<Outport*, std::shared_ptr<const T>>> getSourceVectorData() const;
 
     virtual bool hasData() const;
+
+    /**
+     * Hint that the processor will use the representation Repr of the data. When new data is set
+     * in a connected outport the representation will be created, or updated, on the thread pool
+     * such that it is ready, or at least on its way, when the processor is evaluated.
+     * Example:
+     * \code{.cpp}
+     *     volume_.addRepresentationHint<VolumeRAM>();
+     * \endcode
+     * @see Data::requestRepresentation
+     */
+    template <typename Repr>
+    void addRepresentationHint();
+
+    virtual void prefetch(const std::shared_ptr<const T>& data) const override;
+
+private:
+    std::vector<std::function<void(const std::shared_ptr<const T>&)>> representationHints_;
 };
 
 template <typename T>
@@ -185,6 +208,31 @@ bool DataInport<T, N, Flat>::hasData() const {
     }
 }
 
+template <typename T, size_t N, bool Flat>
+template <typename Repr>
+void DataInport<T, N, Flat>::addRepresentationHint() {
+    representationHints_.emplace_back([](const std::shared_ptr<const T>& data) {
+        if (data->template hasValidRepresentation<Repr>()) return;
+
+        // The task keeps the data alive until the conversion is done. Errors are ignored here,
+        // they will be thrown again when the processor asks for the representation.
+        util::dispatchPool([data]() {
+            detail::prepareConversionThread();
+            data->template getRepresentationShared<Repr>();
+        });
+    });
+}
+
+template <typename T, size_t N, bool Flat>
+void DataInport<T, N, Flat>::prefetch(const std::shared_ptr<const T>& data) const {
+    // Don't spend time on data for a processor that is not going to be processed
+    if (representationHints_.empty() || !detail::canBecomeReady(*this)) return;
+
+    for (const auto& hint : representationHints_) {
+        hint(data);
+    }
+}
+
 template <typename T, size_t N, bool Flat>
 std::shared_ptr<const T> DataInport<T, N, Flat>::getData() const {
     if (isConnected()) {
@@ -37,14 +37,30 @@
 #include <inviwo/core/util/stringconversion.h>
 #include <inviwo/core/util/document.h>
 #include <inviwo/core/util/detected.h>
+#include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/resourcemanager/resource.h>
 
 #include <glm/fwd.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace inviwo {
 
+/**
+ * \ingroup ports
+ * Interface for inports that want to start preparing the data they will consume as soon as it is
+ * set in a connected DataOutport<T>, for example by converting it to the representations they will
+ * use, while the rest of the network is still being evaluated.
+ * @see DataInport::addRepresentationHint
+ */
+template <typename T>
+class DataPrefetcher {
+public:
+    virtual ~DataPrefetcher() = default;
+    virtual void prefetch(const std::shared_ptr<const T>& data) const = 0;
+};
+
 /**
  * \ingroup ports
  * DataOutport hold data of type T
@@ -92,7 +108,16 @@ public:
     virtual bool hasData() const override;
 
 protected:
+    virtual void connectTo(Inport* port) override;
+    virtual void disconnectFrom(Inport* port) override;
+
+    void prefetch() const;
+
     std::shared_ptr<const T> data_;
+
+private:
+    // The connected inports that are DataPrefetchers, resolved once when connecting
+    std::vector<const DataPrefetcher<T>*> prefetchers_;
 };
 
 template <typename T>
@@ -142,12 +167,38 @@ void DataOutport<T>::setData(std::shared_ptr<const T> data) {
     if constexpr (util::is_detected_v<detail::updateResourceType, T>) {
         data_->updateResource(ResourceMeta{.source = getPath()});
     }
+    prefetch();
 }
 
 template <typename T>
 void DataOutport<T>::setData(const T* data) {
     data_.reset(data);
     isReady_.update();
+    prefetch();
+}
+
+template <typename T>
+void DataOutport<T>::connectTo(Inport* port) {
+    if (auto* prefetcher = dynamic_cast<const DataPrefetcher<T>*>(port)) {
+        util::push_back_unique(prefetchers_, prefetcher);
+    }
+    Outport::connectTo(port);
+}
+
+template <typename T>
+void DataOutport<T>::disconnectFrom(Inport* port) {
+    if (auto* prefetcher = dynamic_cast<const DataPrefetcher<T>*>(port)) {
+        std::erase(prefetchers_, prefetcher);
+    }
+    Outport::disconnectFrom(port);
+}
+
+template <typename T>
+void DataOutport<T>::prefetch() const {
+    if (!data_) return;
+    for (const auto* prefetcher : prefetchers_) {
+        prefetcher->prefetch(data_);
+    }
 }
 
 template <typename T>
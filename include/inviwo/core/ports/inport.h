@@ -181,4 +181,14 @@ private:
     Dispatcher<void(Outport*)> onDisconnectDispatcher_;
 };
 
+namespace detail {
+
+/**
+ * Check if the processor of @p inport can become ready, i.e. the port belongs to a processor and
+ * all the inports of that processor are either connected or optional.
+ */
+IVW_CORE_API bool canBecomeReady(const Inport& inport);
+
+}  // namespace detail
+
 }  // namespace inviwo
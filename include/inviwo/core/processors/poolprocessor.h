@@ -164,6 +164,12 @@ public:
      */
     bool hasJobs();
 
+    /**
+     * Pool processors already offload their work to the thread pool and deliver the results on the
+     * main thread, hence process() is always called on the main thread.
+     */
+    virtual bool isMainThreadBound() const override { return true; }
+
     /**
      * Dispatch a single background job. The job will be executed in a background thread in
      * the thread pool. It is important that the job captures its state by value, since it might
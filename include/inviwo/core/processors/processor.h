@@ -295,6 +295,17 @@ public:
      */
     const ProcessorStatus& status() const;
 
+    /**
+     * Returns whether the processor has to be processed on the main thread. This is only
+     * considered when the ProcessorNetworkEvaluator runs in EvaluationMode::Concurrent. The
+     * default is true. A processor can override this and return false to have process() called
+     * on the thread pool, but only if process() does not need a render context, does not touch the
+     * GUI, does not set properties or otherwise notify observers, and only reads its inports and
+     * writes its outports.
+     * @see ProcessorNetworkEvaluator::setEvaluationMode
+     */
+    virtual bool isMainThreadBound() const;
+
     /**
      * Deriving classes should override this function to do the main work of the processor.
      * This function is called by the ProcessorNetworkEvaluator when the network is evaluated and
@@ -33,6 +33,10 @@
 #include <inviwo/core/processors/processorfactoryobject.h>
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/util/factory.h>
+#include <inviwo/core/util/dispatcher.h>
+
+#include <functional>
+#include <vector>
 
 namespace inviwo {
 
@@ -60,8 +64,30 @@ public:
 
     virtual bool hasKey(std::string_view key) const override;
 
+    std::vector<std::string> getKeys() const;
+    auto getKeyView() const {
+        registerDeferred();
+        return Register::getKeyView();
+    }
+    ProcessorFactoryObject* getFactoryObject(std::string_view key) const;
+
+    /**
+     * Add a registration that is postponed until the processors are first looked up, created, or
+     * listed, or until registerDeferred is called. Used for processors that are expensive to
+     * register, like the python processors, to keep them out of the module registration. The
+     * registration might be invoked more than once and should do nothing after the first time.
+     * It is dropped when the returned handle is released.
+     */
+    DispatcherHandle<void()> deferRegistration(std::function<void()> registration);
+
+    /**
+     * Invoke the deferred registrations, see deferRegistration.
+     */
+    void registerDeferred() const;
+
 private:
     InviwoApplication* app_;
+    mutable Dispatcher<void()> deferredRegistrations_;
 };
 
 }  // namespace inviwo
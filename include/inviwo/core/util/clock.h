@@ -37,6 +37,8 @@
 #include <sstream>
 #include <string>
 #include <chrono>
+#include <ostream>
+#include <utility>
 
 namespace inviwo {
 
@@ -186,6 +188,70 @@ void ScopedClock<Clock>::printAndReset() {
     Clock::start();
 }
 
+/**
+ * Scoped clock like ScopedClock, but the log source and message are only created if the elapsed
+ * time exceeds the threshold. @p source is called without arguments and should return the log
+ * source and @p message is called with a std::ostream to write the log message to.
+ * Used by the IVW_CPU_PROFILING macros to keep the overhead low for scopes under the threshold.
+ *
+ * \see util::deferredScopedClock
+ */
+template <typename Clock, typename Source, typename Message>
+class DeferredScopedClock : public Clock {
+public:
+    DeferredScopedClock(Source source, Message message,
+                        typename Clock::duration logIfAtLeast = typename Clock::duration{},
+                        LogLevel logLevel = LogLevel::Info)
+        : source_{std::move(source)}
+        , message_{std::move(message)}
+        , logIfAtLeast_{logIfAtLeast}
+        , logLevel_{logLevel} {}
+
+    DeferredScopedClock(Source source, Message message, double logIfAtLeastMilliSec,
+                        LogLevel logLevel = LogLevel::Info)
+        : DeferredScopedClock(std::move(source), std::move(message),
+                              std::chrono::duration_cast<typename Clock::duration>(
+                                  std::chrono::duration<double, std::chrono::milliseconds::period>(
+                                      logIfAtLeastMilliSec)),
+                              logLevel) {}
+
+    DeferredScopedClock(const DeferredScopedClock&) = delete;
+    DeferredScopedClock(DeferredScopedClock&&) = delete;
+    DeferredScopedClock& operator=(const DeferredScopedClock&) = delete;
+    DeferredScopedClock& operator=(DeferredScopedClock&&) = delete;
+
+    ~DeferredScopedClock() {
+        if (Clock::getElapsedTime() > logIfAtLeast_) {
+            std::stringstream message;
+            message_(message);
+            message << ": " << util::msToString(Clock::getElapsedMilliseconds());
+            LogCentral::getPtr()->log(source_(), logLevel_, LogAudience::Developer, __FILE__,
+                                      __FUNCTION__, __LINE__, message.str());
+        }
+    }
+
+private:
+    Source source_;
+    Message message_;
+    const typename Clock::duration logIfAtLeast_;
+    const LogLevel logLevel_;
+};
+
+namespace util {
+
+/**
+ * Create a DeferredScopedClock, the remaining arguments are forwarded to its constructor.
+ * Usage: `auto clock = util::deferredScopedClock([]() { return "src"; },
+ *                                                [&](std::ostream& os) { os << "message"; });`
+ */
+template <typename C = Clock, typename Source, typename Message, typename... Args>
+DeferredScopedClock<C, Source, Message> deferredScopedClock(Source source, Message message,
+                                                            Args&&... args) {
+    return {std::move(source), std::move(message), std::forward<Args>(args)...};
+}
+
+}  // namespace util
+
 /**
  * scoped clock for CPU time measurements
  *
@@ -234,39 +300,39 @@ using ScopedClockCPU = ScopedClock<Clock>;
  */
 
 #if IVW_PROFILING
-#define IVW_CPU_PROFILING(message)                                                  \
-    std::ostringstream IVW_ADDLINE(__stream);                                       \
-    IVW_ADDLINE(__stream) << message;                                               \
-    ScopedClockCPU IVW_ADDLINE(__clock)(util::parseTypeIdName(typeid(this).name()), \
-                                        IVW_ADDLINE(__stream).str());
+#define IVW_CPU_PROFILING(message)                                                 \
+    auto IVW_ADDLINE(__clock) = util::deferredScopedClock(                         \
+        [&]() { return util::parseTypeIdName(typeid(this).name()); },              \
+        [&](std::ostream& IVW_ADDLINE(__stream)) { IVW_ADDLINE(__stream) << message; });
 #else
 #define IVW_CPU_PROFILING(message)
 #endif
 
 #if IVW_PROFILING
-#define IVW_CPU_PROFILING_CUSTOM(src, message) \
-    std::ostringstream IVW_ADDLINE(__stream);  \
-    IVW_ADDLINE(__stream) << message;          \
-    ScopedClockCPU IVW_ADDLINE(__clock)(src, IVW_ADDLINE(__stream).str());
+#define IVW_CPU_PROFILING_CUSTOM(src, message)                   \
+    auto IVW_ADDLINE(__clock) = util::deferredScopedClock(       \
+        [&]() { return std::string{src}; },                      \
+        [&](std::ostream& IVW_ADDLINE(__stream)) { IVW_ADDLINE(__stream) << message; });
 #else
 #define IVW_CPU_PROFILING_CUSTOM(src, message)
 #endif
 
 #if IVW_PROFILING
-#define IVW_CPU_PROFILING_IF(time, message)                                         \
-    std::ostringstream IVW_ADDLINE(__stream);                                       \
-    IVW_ADDLINE(__stream) << message;                                               \
-    ScopedClockCPU IVW_ADDLINE(__clock)(util::parseTypeIdName(typeid(this).name()), \
-                                        IVW_ADDLINE(__stream).str(), time);
+#define IVW_CPU_PROFILING_IF(time, message)                                              \
+    auto IVW_ADDLINE(__clock) = util::deferredScopedClock(                               \
+        [&]() { return util::parseTypeIdName(typeid(this).name()); },                    \
+        [&](std::ostream& IVW_ADDLINE(__stream)) { IVW_ADDLINE(__stream) << message; }, \
+        time);
 #else
 #define IVW_CPU_PROFILING_IF(time, message)
 #endif
 
 #if IVW_PROFILING
-#define IVW_CPU_PROFILING_IF_CUSTOM(time, src, message) \
-    std::ostringstream IVW_ADDLINE(__stream);           \
-    IVW_ADDLINE(__stream) << message;                   \
-    ScopedClockCPU IVW_ADDLINE(__clock)(src, IVW_ADDLINE(__stream).str(), time);
+#define IVW_CPU_PROFILING_IF_CUSTOM(time, src, message)                                  \
+    auto IVW_ADDLINE(__clock) = util::deferredScopedClock(                               \
+        [&]() { return std::string{src}; },                                              \
+        [&](std::ostream& IVW_ADDLINE(__stream)) { IVW_ADDLINE(__stream) << message; }, \
+        time);
 #else
 #define IVW_CPU_PROFILING_IF_CUSTOM(time, src, message)
 #endif
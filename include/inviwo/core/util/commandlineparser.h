@@ -89,6 +89,11 @@ public:
     std::filesystem::path getOutputPath() const;
     std::filesystem::path getWorkspacePath() const;
     std::filesystem::path getLogToFileFileName() const;
+    /**
+     * The file to write recorded trace events to on exit, empty if tracing was not requested.
+     * \see TraceRecorder
+     */
+    std::filesystem::path getTraceFileName() const;
     std::vector<std::filesystem::path> getModuleSearchPaths() const;
     bool getQuitApplicationAfterStartup() const;
     bool getLoadWorkspaceFromArg() const;
@@ -115,6 +120,7 @@ private:
     TCLAP::ValueArg<std::string> workspace_;
     TCLAP::ValueArg<std::string> outputPath_;
     TCLAP::ValueArg<std::string> logfile_;
+    TCLAP::ValueArg<std::string> traceFile_;
     TCLAP::MultiArg<std::string> moduleSearchPaths_;
     TCLAP::SwitchArg logConsole_;
     TCLAP::SwitchArg noSplashScreen_;
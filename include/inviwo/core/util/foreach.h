@@ -136,7 +136,7 @@ void forEachParallel(const Iterable& iterable, Callback&& callback, size_t jobs
         forEachParallelAsync<Iterable, Callback>(iterable, std::forward<Callback>(callback), jobs);
 
     for (const auto& e : futures) {
-        e.wait();
+        util::getThreadPool().wait(e);
     }
 }
 
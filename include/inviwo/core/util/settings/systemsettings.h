@@ -50,6 +50,7 @@ public:
     SystemSettings(InviwoApplication* app);
     virtual ~SystemSettings();
     IntSizeTProperty poolSize_;
+    BoolProperty concurrentEvaluation_;
     BoolProperty enablePortInspectors_;
     IntProperty portInspectorSize_;
     BoolProperty enableTouchProperty_;
@@ -32,6 +32,11 @@
 #include <inviwo/core/datastructures/spatialdata.h>
 #include <inviwo/core/datastructures/datatraits.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
 namespace inviwo {
 
 /**
@@ -56,6 +61,18 @@ public:
     ReturnType sample(const dvec2& pos, CoordinateSpace space) const;
     ReturnType sample(const vec2& pos, CoordinateSpace space) const;
 
+    ///@{
+    /**
+     * Sample each position in @p pos and store the sample at the same index in @p result, which
+     * must hold at least as many elements as @p pos. Gives the same result as calling sample()
+     * for each position, but the positions are transformed to data space and handed to the
+     * sampler implementation in batches, which avoids a virtual call for every sample.
+     */
+    void sample(std::span<const dvec3> pos, std::span<ReturnType> result) const;
+    void sample(std::span<const dvec3> pos, std::span<ReturnType> result,
+                CoordinateSpace space) const;
+    ///@}
+
     bool withinBounds(const dvec3& pos) const;
     bool withinBounds(const vec3& pos) const;
     bool withinBounds(const dvec2& pos) const;
@@ -75,6 +92,13 @@ public:
 protected:
     virtual ReturnType sampleDataSpace(const dvec3& pos) const = 0;
     virtual bool withinBoundsDataSpace(const dvec3& pos) const = 0;
+    /**
+     * Sample a batch of positions given in data space. The default implementation calls
+     * sampleDataSpace() for each position, derived samplers can override it to sample the whole
+     * batch at once.
+     */
+    virtual void sampleBatchDataSpace(std::span<const dvec3> pos,
+                                      std::span<ReturnType> result) const;
 
     CoordinateSpace space_;
     const SpatialEntity& spatialEntity_;
@@ -161,6 +185,47 @@ auto SpatialSampler<ReturnType>::sample(const dvec3& pos, CoordinateSpace space)
     }
 }
 
+template <typename ReturnType>
+void SpatialSampler<ReturnType>::sample(std::span<const dvec3> pos,
+                                        std::span<ReturnType> result) const {
+    sample(pos, result, space_);
+}
+
+template <typename ReturnType>
+void SpatialSampler<ReturnType>::sample(std::span<const dvec3> pos, std::span<ReturnType> result,
+                                        CoordinateSpace space) const {
+    if (space == CoordinateSpace::Data) {
+        sampleBatchDataSpace(pos, result);
+        return;
+    }
+
+    const dmat4 m =
+        space == space_
+            ? transform_
+            : dmat4{spatialEntity_.getCoordinateTransformer().getMatrix(space,
+                                                                         CoordinateSpace::Data)};
+
+    constexpr size_t batchSize = 64;
+    std::array<dvec3, batchSize> dataPos;
+    for (size_t begin = 0; begin < pos.size(); begin += batchSize) {
+        const auto count = std::min(batchSize, pos.size() - begin);
+        for (size_t i = 0; i < count; ++i) {
+            const auto p = m * dvec4(pos[begin + i], 1.0);
+            dataPos[i] = dvec3(p) / p.w;
+        }
+        sampleBatchDataSpace(std::span<const dvec3>{dataPos.data(), count},
+                             result.subspan(begin, count));
+    }
+}
+
+template <typename ReturnType>
+void SpatialSampler<ReturnType>::sampleBatchDataSpace(std::span<const dvec3> pos,
+                                                      std::span<ReturnType> result) const {
+    for (size_t i = 0; i < pos.size(); ++i) {
+        result[i] = sampleDataSpace(pos[i]);
+    }
+}
+
 template <typename ReturnType>
 bool SpatialSampler<ReturnType>::withinBounds(const vec3& pos) const {
     return withinBounds(static_cast<dvec3>(pos));
@@ -41,6 +41,8 @@
 #include <inviwo/core/util/spatialsampler.h>
 #include <inviwo/core/util/glm.h>
 
+#include <span>
+
 namespace inviwo {
 
 template <typename ReturnType, typename DataType>
@@ -56,6 +58,8 @@ public:
 protected:
     virtual ReturnType sampleDataSpace(const dvec3& pos) const override;
     virtual bool withinBoundsDataSpace(const dvec3& pos) const override;
+    virtual void sampleBatchDataSpace(std::span<const dvec3> pos,
+                                      std::span<ReturnType> result) const override;
     ReturnType getVoxel(const size3_t& pos) const;
 
     const DataType* data_;
@@ -115,6 +119,15 @@ auto TemplateVolumeSampler<ReturnType, DataType>::sampleDataSpace(const dvec3& p
     return Interpolation<ReturnType, double>::trilinear(samples, interpolants);
 }
 
+template <typename ReturnType, typename DataType>
+void TemplateVolumeSampler<ReturnType, DataType>::sampleBatchDataSpace(
+    std::span<const dvec3> pos, std::span<ReturnType> result) const {
+    // qualified calls are not dispatched virtually and can be inlined into the loop
+    for (size_t i = 0; i < pos.size(); ++i) {
+        result[i] = TemplateVolumeSampler::sampleDataSpace(pos[i]);
+    }
+}
+
 template <typename ReturnType, typename DataType>
 auto TemplateVolumeSampler<ReturnType, DataType>::getVoxel(const size3_t& pos) const -> ReturnType {
     return static_cast<ReturnType>(data_[ic_(glm::min(pos, dimsM1_))]);
@@ -52,8 +52,6 @@
  *
  *********************************************************************************/
 
-// following https://github.com/progschj/ThreadPool
-
 #pragma once
 
 #include <inviwo/core/common/inviwocoredefine.h>
@@ -61,19 +59,33 @@
 #include <warn/push>
 #include <warn/ignore/all>
 #include <vector>
-#include <queue>
+#include <deque>
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <shared_mutex>
 #include <condition_variable>
 #include <future>
 #include <functional>
 #include <stdexcept>
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <warn/pop>
 
 namespace inviwo {
 
+/**
+ * A work-stealing thread pool. Each worker owns a task deque, tasks enqueued from outside the pool
+ * are distributed round robin over the workers, while tasks enqueued from a worker thread are put
+ * in the deque of that worker. Idle workers steal tasks from the other workers. Task submitted
+ * from within a running task can be waited for using ThreadPool::wait, which will run pending
+ * tasks on the waiting worker instead of blocking it, hence nested submission can not deadlock
+ * the pool.
+ */
 class IVW_CORE_API ThreadPool {
 public:
     ThreadPool(
@@ -81,6 +93,87 @@ public:
         std::function<void()> onThreadStop = []() {});
     ~ThreadPool();
 
+    /**
+     * A move only type erased void() functor. Small functors are stored inline to avoid a heap
+     * allocation per task.
+     */
+    class Task {
+    public:
+        static constexpr size_t bufferSize = 48;
+
+        Task() = default;
+        template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task>>>
+        Task(F&& f) {
+            using Func = std::decay_t<F>;
+            if constexpr (sizeof(Func) <= bufferSize &&
+                          alignof(Func) <= alignof(std::max_align_t) &&
+                          std::is_nothrow_move_constructible_v<Func>) {
+                ::new (static_cast<void*>(buffer_)) Func(std::forward<F>(f));
+                vtable_ = &inlineVTable<Func>;
+            } else {
+                ::new (static_cast<void*>(buffer_)) Func*(new Func(std::forward<F>(f)));
+                vtable_ = &heapVTable<Func>;
+            }
+        }
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        Task(Task&& rhs) noexcept : vtable_{rhs.vtable_} {
+            if (vtable_) {
+                vtable_->move(rhs.buffer_, buffer_);
+                rhs.vtable_ = nullptr;
+            }
+        }
+        Task& operator=(Task&& rhs) noexcept {
+            if (this != &rhs) {
+                reset();
+                if (rhs.vtable_) {
+                    rhs.vtable_->move(rhs.buffer_, buffer_);
+                    vtable_ = rhs.vtable_;
+                    rhs.vtable_ = nullptr;
+                }
+            }
+            return *this;
+        }
+        ~Task() { reset(); }
+
+        explicit operator bool() const { return vtable_ != nullptr; }
+        void operator()() { vtable_->invoke(buffer_); }
+
+    private:
+        void reset() noexcept {
+            if (vtable_) {
+                vtable_->destroy(buffer_);
+                vtable_ = nullptr;
+            }
+        }
+
+        struct VTable {
+            void (*invoke)(void*);
+            void (*move)(void* from, void* to) noexcept;
+            void (*destroy)(void*) noexcept;
+        };
+
+        template <typename Func>
+        static constexpr VTable inlineVTable{
+            [](void* f) { (*static_cast<Func*>(f))(); },
+            [](void* from, void* to) noexcept {
+                ::new (to) Func(std::move(*static_cast<Func*>(from)));
+                static_cast<Func*>(from)->~Func();
+            },
+            [](void* f) noexcept { static_cast<Func*>(f)->~Func(); }};
+
+        template <typename Func>
+        static constexpr VTable heapVTable{
+            [](void* f) { (**static_cast<Func**>(f))(); },
+            [](void* from, void* to) noexcept {
+                ::new (to) Func*(*static_cast<Func**>(from));
+            },
+            [](void* f) noexcept { delete *static_cast<Func**>(f); }};
+
+        alignas(std::max_align_t) std::byte buffer_[bufferSize];
+        const VTable* vtable_ = nullptr;
+    };
+
     /**
      * Enqueue function f with arguments args. The function f may throw exceptions.
      * @return a future to the result of f
@@ -93,6 +186,22 @@ public:
      */
     void enqueueRaw(std::function<void()> f);
 
+    /**
+     * Wait for the future to become ready. If called from a worker thread of this pool, the worker
+     * will run pending tasks while waiting instead of blocking. Use this when waiting for tasks
+     * enqueued from within a task, to avoid deadlocking the pool.
+     */
+    template <typename T>
+    void wait(const std::future<T>& future);
+
+    /**
+     * Try to change the number of worker threads. Workers that are busy are not stopped, hence the
+     * resulting size might be larger than requested.
+     * If the pool ends up without workers, any tasks still queued are run on the calling thread
+     * before returning. Tasks queued when the pool is destroyed are dropped, and their futures
+     * will report a broken promise.
+     * @return the new number of worker threads
+     */
     size_t trySetSize(size_t size);
     size_t getSize() const;
 
@@ -115,17 +224,35 @@ private:
         Worker& operator=(Worker&& rhs) = delete;
         ~Worker();
 
+        ThreadPool* pool;
         std::atomic<State> state;  //< State of the worker
+        std::mutex mutex;          //< Guards tasks and closed
+        std::deque<Task> tasks;    //< Owner pops from the front, thieves from the back
+        bool closed = false;       //< The worker has exited, tasks should go to the shared queue
+        size_t victim = 0;         //< Where to start looking for tasks to steal
         std::thread thread;
     };
+
+    static Worker*& currentWorker();
+    void submit(Task task);
+    void push(Task task);
+    Task pop(Worker& worker);
+    bool runPendingTask();
+    void work(Worker& worker);
+
     // need to keep track of threads so we can join them
     std::vector<std::unique_ptr<Worker>> workers;
+    mutable std::shared_mutex workersMutex;
 
-    // the task queue
-    std::queue<std::function<void()>> tasks;
+    // shared queue for tasks that can not be given to a specific worker
+    std::deque<Task> tasks;
+    std::mutex queueMutex;
 
     // synchronization
-    std::mutex queue_mutex;
+    std::atomic<size_t> pending;   //< Number of queued tasks
+    std::atomic<size_t> sleeping;  //< Number of workers waiting on the condition
+    std::atomic<size_t> next;      //< Round robin counter for distributing tasks
+    std::mutex sleepMutex;
     std::condition_variable condition;
 
     // Thread start end exit actions
@@ -138,19 +265,28 @@ template <class F, class... Args>
 auto ThreadPool::enqueue(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>> {
     using return_type = std::invoke_result_t<F, Args...>;
 
-    auto task = std::make_shared<std::packaged_task<return_type()>>(
-        std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+    std::packaged_task<return_type()> task{
+        [f = std::forward<F>(f), ... args = std::forward<Args>(args)]() mutable -> return_type {
+            return std::invoke(f, args...);
+        }};
 
-    std::future<return_type> res = task->get_future();
+    std::future<return_type> res = task.get_future();
+    submit(Task{std::move(task)});
+    return res;
+}
 
-    if (workers.empty()) {
-        (*task)();  // No worker threads, just run the task.
-    } else {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-        tasks.emplace([task]() { (*task)(); });
+template <typename T>
+void ThreadPool::wait(const std::future<T>& future) {
+    const auto* worker = currentWorker();
+    if (!worker || worker->pool != this) {
+        future.wait();
+        return;
+    }
+    while (future.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+        if (!runPendingTask()) {
+            future.wait_for(std::chrono::microseconds{100});
+        }
     }
-    condition.notify_one();
-    return res;
 }
 
 }  // namespace inviwo
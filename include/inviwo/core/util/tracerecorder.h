@@ -0,0 +1,202 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace inviwo {
+
+/**
+ * A timed scope recorded by the TraceRecorder
+ */
+struct IVW_CORE_API TraceEvent {
+    static constexpr size_t maxNameLength = 47;
+
+    const char* category = nullptr;              ///< Must have static storage duration
+    std::array<char, maxNameLength + 1> name{};  ///< Null terminated, truncated if too long
+    std::int64_t start = 0;                      ///< Nanoseconds since the recorder was created
+    std::int64_t duration = 0;                   ///< Nanoseconds
+
+    std::string_view getName() const { return std::string_view{name.data()}; }
+};
+
+/**
+ * \brief Records timed scopes from all threads for exporting as a trace file
+ *
+ * Each thread records into its own fixed size ring buffer, hence recording never takes a lock
+ * and only allocates once per thread. When the ring buffer is full the oldest events are
+ * overwritten. When the recorder is disabled, recording amounts to reading an atomic flag.
+ *
+ * The events can be exported in the Chrome trace event format, which can be opened in
+ * chrome://tracing or https://ui.perfetto.dev. Use the IVW_TRACE_SCOPE macro or ScopedTrace to
+ * record events. Inviwo records processor evaluation, property linking and thread pool tasks.
+ * Start Inviwo with `--trace <file>` to record everything and write the trace on exit.
+ */
+class IVW_CORE_API TraceRecorder {
+public:
+    using clock = std::chrono::steady_clock;
+    static constexpr size_t defaultCapacity = 16384;
+
+    struct ThreadEvents {
+        size_t id;
+        std::string name;
+        std::vector<TraceEvent> events;
+    };
+
+    static TraceRecorder& instance();
+
+    TraceRecorder(const TraceRecorder&) = delete;
+    TraceRecorder(TraceRecorder&&) = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+    TraceRecorder& operator=(TraceRecorder&&) = delete;
+
+    bool isEnabled() const noexcept { return enabled_.load(std::memory_order_relaxed); }
+    void setEnabled(bool enabled);
+
+    /**
+     * Set the number of events kept per thread. Only applies to threads that have not yet
+     * recorded anything.
+     */
+    void setCapacity(size_t eventsPerThread);
+    size_t getCapacity() const;
+
+    /**
+     * Record an event on the calling thread. Does nothing if the recorder is disabled.
+     * @param category a string with static storage duration
+     * @param name event name, truncated to TraceEvent::maxNameLength characters
+     * @param start time when the event started
+     * @param end time when the event ended
+     */
+    void record(const char* category, std::string_view name, clock::time_point start,
+                clock::time_point end);
+
+    /**
+     * Set the name of the calling thread in the exported trace.
+     * Also called by util::setThreadDescription.
+     */
+    void setThreadName(std::string_view name);
+
+    /**
+     * Get a copy of all recorded events. Can be called while other threads are recording.
+     */
+    std::vector<ThreadEvents> getEvents() const;
+
+    /**
+     * Discard all recorded events
+     */
+    void clear();
+
+    /**
+     * Write all recorded events as Chrome trace event JSON
+     */
+    void exportChromeTrace(std::ostream& os) const;
+
+    /**
+     * Write all recorded events as Chrome trace event JSON to @p file
+     * @throw FileException if the file could not be opened
+     */
+    void exportChromeTrace(const std::filesystem::path& file) const;
+
+private:
+    TraceRecorder();
+    struct Buffer;
+    static std::shared_ptr<Buffer>& localBuffer();
+    Buffer& threadBuffer();
+
+    std::atomic<bool> enabled_;
+    std::atomic<size_t> capacity_;
+    const clock::time_point epoch_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<Buffer>> buffers_;
+};
+
+/**
+ * \brief Records the lifetime of the scope in the TraceRecorder
+ *
+ * The name is copied on construction, so it does not need to outlive the scope. When tracing is
+ * disabled construction and destruction only checks a flag.
+ * \see IVW_TRACE_SCOPE
+ */
+class IVW_CORE_API ScopedTrace {
+public:
+    ScopedTrace(const char* category, std::string_view name) noexcept {
+        if (TraceRecorder::instance().isEnabled()) {
+            category_ = category;
+            size_ = std::min(name.size(), TraceEvent::maxNameLength);
+            std::copy_n(name.data(), size_, name_.data());
+            start_ = TraceRecorder::clock::now();
+        }
+    }
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace(ScopedTrace&&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(ScopedTrace&&) = delete;
+    ~ScopedTrace() {
+        if (category_) {
+            TraceRecorder::instance().record(category_, std::string_view{name_.data(), size_},
+                                             start_, TraceRecorder::clock::now());
+        }
+    }
+
+private:
+    const char* category_ = nullptr;
+    size_t size_ = 0;
+    std::array<char, TraceEvent::maxNameLength> name_;
+    TraceRecorder::clock::time_point start_;
+};
+
+#define IVW_TRACE_CONCAT_PART1(x, y) x##y
+#define IVW_TRACE_CONCAT_PART2(x, y) IVW_TRACE_CONCAT_PART1(x, y)
+
+/**
+ * \def IVW_TRACE_SCOPE(category, name)
+ * Records the enclosing scope in the TraceRecorder.
+ *
+ * @param category string literal used to group events, like "processor" or "threadpool"
+ * @param name     event name, anything convertible to std::string_view
+ */
+#define IVW_TRACE_SCOPE(category, name) \
+    const ::inviwo::ScopedTrace IVW_TRACE_CONCAT_PART2(__ivwTrace, __LINE__)(category, name)
+
+}  // namespace inviwo
@@ -31,8 +31,11 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/indexmapper.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
 
+#include <algorithm>
 #include <vector>
 #include <future>
 
@@ -57,6 +60,21 @@ void forEachVoxel(const VolumeRAM& v, C callback) {
     forEachVoxel(v.getDimensions(), callback);
 }
 
+/**
+ * Calls @p callback for each voxel position of the bricked volume, iterating brick by brick so
+ * that each brick is only loaded once. The brick containing the current position is kept resident
+ * during the iteration, i.e. accessing the voxel at the given position via the volume is a cache
+ * hit.
+ */
+template <typename C>
+void forEachVoxel(const VolumeBricked& v, C callback) {
+    forEachVoxel(v.getNumberOfBricks(), [&](const size3_t& brick) {
+        const auto ram = v.getBrick(brick);
+        const auto offset = v.getBrickOffset(brick);
+        forEachVoxel(ram->getDimensions(), [&](const size3_t& pos) { callback(offset + pos); });
+    });
+}
+
 template <typename C>
 void forEachVoxelParallel(const size3_t dims, C callback, size_t jobs = 0) {
     const size_t poolSize = util::getPoolSize();
@@ -88,7 +106,7 @@ void forEachVoxelParallel(const size3_t dims, C callback, size_t jobs = 0) {
     }
 
     for (const auto& e : futures) {
-        e.wait();
+        util::getThreadPool().wait(e);
     }
 }
 template <typename C>
@@ -96,6 +114,47 @@ void forEachVoxelParallel(const VolumeRAM& v, C callback, size_t jobs = 0) {
     forEachVoxelParallel(v.getDimensions(), callback, jobs);
 }
 
+/**
+ * Parallel version of forEachVoxel for bricked volumes, the bricks are distributed over the jobs.
+ * @see forEachVoxel(const VolumeBricked&, C)
+ */
+template <typename C>
+void forEachVoxelParallel(const VolumeBricked& v, C callback, size_t jobs = 0) {
+    const size_t poolSize = util::getPoolSize();
+    if (jobs == 0) {
+        jobs = 4 * poolSize;
+    }
+    const auto numBricks = v.getNumberOfBricks();
+    const auto count = glm::compMul(numBricks);
+    if ((jobs == 0) || (poolSize == 0)) {
+        // fallback to serial version
+        forEachVoxel(v, callback);
+        return;
+    }
+    jobs = std::min(jobs, count);
+
+    const util::IndexMapper3D im{numBricks};
+    std::vector<std::future<void>> futures;
+    for (size_t job = 0; job < jobs; ++job) {
+        const size_t start = job * count / jobs;
+        const size_t stop = (job + 1) * count / jobs;
+
+        futures.push_back(util::dispatchPool([&v, &callback, &im, start, stop]() {
+            for (size_t i = start; i < stop; ++i) {
+                const auto brick = im(i);
+                const auto ram = v.getBrick(brick);
+                const auto offset = v.getBrickOffset(brick);
+                forEachVoxel(ram->getDimensions(),
+                             [&](const size3_t& pos) { callback(offset + pos); });
+            }
+        }));
+    }
+
+    for (const auto& e : futures) {
+        util::getThreadPool().wait(e);
+    }
+}
+
 }  // namespace util
 
 }  // namespace inviwo
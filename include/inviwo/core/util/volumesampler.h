@@ -35,13 +35,21 @@
 #include <inviwo/core/util/interpolation.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
 
 #include <inviwo/core/util/spatialsampler.h>
+#include <inviwo/core/util/glmconvert.h>
+
+#include <span>
 
 namespace inviwo {
 
 /**
  * \class VolumeSampler
+ * Samples a Volume using its VolumeRAM representation. If the volume has a VolumeBricked but no
+ * VolumeRAM representation, the samples are taken from the bricked volume instead, loading bricks
+ * as needed, to avoid loading the whole volume into memory. Each sample, or batch of samples, uses
+ * a VolumeBricked::Cursor such that bricks are only looked up once and not for every voxel.
  */
 template <typename ReturnType = dvec4>
 class VolumeSampler : public SpatialSampler<ReturnType> {
@@ -55,10 +63,25 @@ public:
 protected:
     virtual ReturnType sampleDataSpace(const dvec3& pos) const override;
     virtual bool withinBoundsDataSpace(const dvec3& pos) const override;
+    /**
+     * Samples a VolumeRAM representation by dispatching on its format once for the whole batch
+     * and reading the voxels directly from the typed data. A VolumeBricked representation is
+     * sampled through a single VolumeBricked::Cursor for the whole batch.
+     */
+    virtual void sampleBatchDataSpace(std::span<const dvec3> pos,
+                                      std::span<ReturnType> result) const override;
     ReturnType getVoxel(const size3_t& pos) const;
+    static ReturnType getAs(const VolumeRAM& ram, const size3_t& pos);
+    /**
+     * Trilinear interpolation at @p pos in data space, @p voxel is called with the positions of
+     * the 8 surrounding voxels.
+     */
+    template <typename Voxel>
+    ReturnType interpolate(const dvec3& pos, Voxel&& voxel) const;
 
     std::shared_ptr<const Volume> volume_;
     const VolumeRAM* ram_;
+    const VolumeBricked* bricked_;
     size3_t dims_;
 };
 
@@ -74,54 +97,112 @@ VolumeSampler<ReturnType>::VolumeSampler(std::shared_ptr<const Volume> vol, Coor
 template <typename ReturnType>
 VolumeSampler<ReturnType>::VolumeSampler(const Volume& vol, CoordinateSpace space)
     : SpatialSampler<ReturnType>(vol, space)
-    , ram_(vol.getRepresentation<VolumeRAM>())
-    , dims_(vol.getDimensions()) {}
+    , ram_(nullptr)
+    , bricked_(nullptr)
+    , dims_(vol.getDimensions()) {
+    if (!vol.hasRepresentation<VolumeRAM>() && vol.hasRepresentation<VolumeBricked>()) {
+        bricked_ = vol.getRepresentation<VolumeBricked>();
+    } else {
+        ram_ = vol.getRepresentation<VolumeRAM>();
+    }
+}
+
+template <>
+inline double VolumeSampler<double>::getAs(const VolumeRAM& ram, const size3_t& pos) {
+    return ram.getAsDouble(pos);
+}
+
+template <>
+inline dvec2 VolumeSampler<dvec2>::getAs(const VolumeRAM& ram, const size3_t& pos) {
+    return ram.getAsDVec2(pos);
+}
+
+template <>
+inline dvec3 VolumeSampler<dvec3>::getAs(const VolumeRAM& ram, const size3_t& pos) {
+    return ram.getAsDVec3(pos);
+}
+
+template <>
+inline dvec4 VolumeSampler<dvec4>::getAs(const VolumeRAM& ram, const size3_t& pos) {
+    return ram.getAsDVec4(pos);
+}
 
 template <typename ReturnType>
-auto VolumeSampler<ReturnType>::sampleDataSpace(const dvec3& pos) const -> ReturnType {
-    if (!withinBoundsDataSpace(pos)) {
-        return ReturnType(0.0);
-    }
+template <typename Voxel>
+ReturnType VolumeSampler<ReturnType>::interpolate(const dvec3& pos, Voxel&& voxel) const {
     const dvec3 samplePos = pos * dvec3(dims_ - size3_t(1));
     const size3_t indexPos = size3_t(samplePos);
     const dvec3 interpolants = samplePos - dvec3(indexPos);
 
-    ReturnType samples[8];
-    samples[0] = getVoxel(indexPos);
-    samples[1] = getVoxel(indexPos + size3_t(1, 0, 0));
-    samples[2] = getVoxel(indexPos + size3_t(0, 1, 0));
-    samples[3] = getVoxel(indexPos + size3_t(1, 1, 0));
-
-    samples[4] = getVoxel(indexPos + size3_t(0, 0, 1));
-    samples[5] = getVoxel(indexPos + size3_t(1, 0, 1));
-    samples[6] = getVoxel(indexPos + size3_t(0, 1, 1));
-    samples[7] = getVoxel(indexPos + size3_t(1, 1, 1));
-
+    const ReturnType samples[8] = {voxel(indexPos),
+                                   voxel(indexPos + size3_t(1, 0, 0)),
+                                   voxel(indexPos + size3_t(0, 1, 0)),
+                                   voxel(indexPos + size3_t(1, 1, 0)),
+                                   voxel(indexPos + size3_t(0, 0, 1)),
+                                   voxel(indexPos + size3_t(1, 0, 1)),
+                                   voxel(indexPos + size3_t(0, 1, 1)),
+                                   voxel(indexPos + size3_t(1, 1, 1))};
     return Interpolation<ReturnType, double>::trilinear(samples, interpolants);
 }
 
-template <>
-inline double VolumeSampler<double>::getVoxel(const size3_t& pos) const {
-    const auto p = glm::clamp(pos, size3_t(0), dims_ - size3_t(1));
-    return ram_->getAsDouble(p);
+template <typename ReturnType>
+auto VolumeSampler<ReturnType>::sampleDataSpace(const dvec3& pos) const -> ReturnType {
+    if (!withinBoundsDataSpace(pos)) {
+        return ReturnType(0.0);
+    }
+    if (bricked_) {
+        // Look up each of the (at most 8) bricks once instead of once per voxel
+        VolumeBricked::Cursor cursor{*bricked_};
+        const size3_t dimsM1 = dims_ - size3_t(1);
+        return interpolate(pos, [&](const size3_t& p) {
+            const auto [brick, local] = cursor.locate(glm::min(p, dimsM1));
+            return getAs(*brick, local);
+        });
+    }
+    return interpolate(pos, [&](const size3_t& p) { return getVoxel(p); });
 }
 
-template <>
-inline dvec2 VolumeSampler<dvec2>::getVoxel(const size3_t& pos) const {
-    const auto p = glm::clamp(pos, size3_t(0), dims_ - size3_t(1));
-    return ram_->getAsDVec2(p);
-}
+template <typename ReturnType>
+void VolumeSampler<ReturnType>::sampleBatchDataSpace(std::span<const dvec3> pos,
+                                                     std::span<ReturnType> result) const {
+    const size3_t dimsM1 = dims_ - size3_t(1);
+
+    if (bricked_) {
+        // One cursor for the whole batch, nearby samples reuse the bricks without locking
+        VolumeBricked::Cursor cursor{*bricked_};
+        const auto voxel = [&](const size3_t& p) {
+            const auto [brick, local] = cursor.locate(glm::min(p, dimsM1));
+            return getAs(*brick, local);
+        };
+        for (size_t i = 0; i < pos.size(); ++i) {
+            result[i] = VolumeSampler::withinBoundsDataSpace(pos[i]) ? interpolate(pos[i], voxel)
+                                                                     : ReturnType(0.0);
+        }
+        return;
+    }
 
-template <>
-inline dvec3 VolumeSampler<dvec3>::getVoxel(const size3_t& pos) const {
-    const auto p = glm::clamp(pos, size3_t(0), dims_ - size3_t(1));
-    return ram_->getAsDVec3(p);
+    ram_->dispatch<void>([&](auto vrprecision) {
+        const auto* data = vrprecision->getDataTyped();
+        const util::IndexMapper3D index(dims_);
+        const auto voxel = [&](const size3_t& p) {
+            return util::glm_convert<ReturnType>(data[index(glm::min(p, dimsM1))]);
+        };
+
+        for (size_t i = 0; i < pos.size(); ++i) {
+            result[i] = VolumeSampler::withinBoundsDataSpace(pos[i]) ? interpolate(pos[i], voxel)
+                                                                     : ReturnType(0.0);
+        }
+    });
 }
 
-template <>
-inline dvec4 VolumeSampler<dvec4>::getVoxel(const size3_t& pos) const {
+template <typename ReturnType>
+auto VolumeSampler<ReturnType>::getVoxel(const size3_t& pos) const -> ReturnType {
     const auto p = glm::clamp(pos, size3_t(0), dims_ - size3_t(1));
-    return ram_->getAsDVec4(p);
+    if (ram_) {
+        return getAs(*ram_, p);
+    }
+    const auto brick = bricked_->getBrickIndex(p);
+    return getAs(*bricked_->getBrick(brick), p - bricked_->getBrickOffset(brick));
 }
 
 template <typename ReturnType>
@@ -128,6 +128,7 @@ public:
     DoubleProperty renderFPS;
     ButtonProperty renderAction;
     ButtonProperty renderActionStop;
+    StringProperty renderStatus;
 
     BoolCompositeProperty exportOptions_;
     DirectoryProperty exportOutputDirectory_;
@@ -35,6 +35,7 @@
 #include <inviwo/core/properties/stringproperty.h>
 #include <inviwo/core/properties/optionproperty.h>
 #include <inviwo/core/properties/boolproperty.h>
+#include <inviwo/core/properties/ordinalproperty.h>
 
 #include <modules/animation/factories/recorderfactory.h>
 
@@ -61,6 +62,7 @@ private:
     StringProperty baseName_;
     OptionProperty<FileExtension> writer_;
     BoolProperty overwrite_;
+    IntSizeTProperty maxQueuedFrames_;
 };
 
 }  // namespace animation
@@ -32,6 +32,7 @@
 
 #include <inviwo/core/util/glmvec.h>
 
+#include <chrono>
 #include <string>
 #include <memory>
 
@@ -42,6 +43,26 @@ class Layer;
 
 namespace animation {
 
+/**
+ * Statistics of a Recorder, used to report progress and throughput while rendering animations.
+ */
+struct IVW_MODULE_ANIMATION_API RecorderStatistics {
+    using duration = std::chrono::duration<double>;
+
+    size_t recorded = 0;     ///< Number of frames passed to Recorder::record
+    size_t written = 0;      ///< Number of frames that have been encoded and written
+    size_t queued = 0;       ///< Number of frames that are waiting for or being written
+    size_t maxQueued = 0;    ///< The largest number of queued frames so far
+    size_t queueLimit = 0;   ///< The maximum number of queued frames, 0 if not bounded
+    duration blocked{0.0};   ///< Time spent in Recorder::record waiting for room in the queue
+    duration elapsed{0.0};   ///< Time since the first recorded frame
+
+    /**
+     * Number of frames written per second since the first recorded frame
+     */
+    double framesPerSecond() const;
+};
+
 class IVW_MODULE_ANIMATION_API Recorder {
 public:
     Recorder() = default;
@@ -52,6 +73,11 @@ public:
     virtual ~Recorder() = default;
 
     virtual void record(const Layer& layer) = 0;
+
+    /**
+     * Statistics of the recording so far. The default implementation returns empty statistics.
+     */
+    virtual RecorderStatistics statistics() const { return {}; }
 };
 
 struct IVW_MODULE_ANIMATION_API RecorderOptions {
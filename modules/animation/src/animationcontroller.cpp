@@ -96,6 +96,27 @@ class Layer;
 
 namespace animation {
 
+namespace {
+
+std::string recorderStatus(const std::vector<std::shared_ptr<Recorder>>& recorders) {
+    std::string status;
+    for (const auto& recorder : recorders) {
+        const auto stats = recorder->statistics();
+        if (!status.empty()) status.append("; ");
+        if (stats.queueLimit > 0) {
+            fmt::format_to(std::back_inserter(status),
+                           "{}/{} written, queue {}/{}, {:.1f} fps", stats.written,
+                           stats.recorded, stats.queued, stats.queueLimit,
+                           stats.framesPerSecond());
+        } else {
+            fmt::format_to(std::back_inserter(status), "{} recorded", stats.recorded);
+        }
+    }
+    return status;
+}
+
+}  // namespace
+
 AnimationController::AnimationController(Animation& animation, AnimationManager& manager,
                                          InviwoApplication* app)
     : playOptions("PlayOptions", "Play Settings")
@@ -123,6 +144,8 @@ AnimationController::AnimationController(Animation& animation, AnimationManager&
                 PropertySemantics::Text)
     , renderAction("renderAction", "Render")
     , renderActionStop("renderActionStop", "Stop")
+    , renderStatus("renderStatus", "Status",
+                   "Throughput and queue depth of the active recorders while rendering"_help)
 
     , exportOptions_{"exporter", "Exporter"}
     , exportOutputDirectory_{"outputDirectory", "Output Directory"}
@@ -184,9 +207,11 @@ AnimationController::AnimationController(Animation& animation, AnimationManager&
     renderActionStop.onChange([&]() { pause(); });
     renderAction.setReadOnly(state_ == AnimationState::Rendering);
     renderActionStop.setReadOnly(state_ != AnimationState::Rendering);
+    renderStatus.setReadOnly(true);
+    renderStatus.setSerializationMode(PropertySerializationMode::None);
 
     renderOptions.addProperties(renderWindowMode, renderWindow, renderFPS, renderAction,
-                                renderActionStop);
+                                renderActionStop, renderStatus);
     renderOptions.setCollapsed(true);
 
     const auto& recorders = manager.getRecorderFactories();
@@ -358,6 +383,7 @@ void AnimationController::render() {
             std::max(2, static_cast<int>((lastTime - firstTime) / Seconds{1.0 / renderFPS.get()}));
 
         std::vector<std::function<void()>> recordingFunctors;
+        std::vector<std::shared_ptr<Recorder>> recorders;
         const auto& recorderFactories = manager_->getRecorderFactories();
 
         network->forEachProcessor([&](Processor* p) {
@@ -371,6 +397,7 @@ void AnimationController::render() {
                                  .frameRate = static_cast<int>(framesPerSecond.get()),
                                  .expectedNumberOfFrames = numFrames,
                                  .sourceName = p->getIdentifier()});
+                            recorders.push_back(recorder);
 
                             recordingFunctors.emplace_back(
                                 [recorder = std::move(recorder), imageExporter]() {
@@ -426,12 +453,27 @@ void AnimationController::render() {
             for (auto& recorder : recordingFunctors) {
                 recorder();
             }
+            if (!recorders.empty()) {
+                renderStatus.set(recorderStatus(recorders));
+            }
 
             lock.emplace(network);
 
             if (state_ != AnimationState::Rendering) break;
         }
 
+        for (const auto& recorder : recorders) {
+            const auto stats = recorder->statistics();
+            if (stats.maxQueued > 0) {
+                util::logInfo(IVW_CONTEXT,
+                              "Recorder queue peaked at {}/{} frames, blocked for {:.3f} seconds",
+                              stats.maxQueued, stats.queueLimit, stats.blocked.count());
+            }
+        }
+        // Destroying the recorders waits for any frames still being written
+        recordingFunctors.clear();
+        recorders.clear();
+
         using duration_double = std::chrono::duration<double, std::ratio<1>>;
         auto seconds = std::chrono::duration_cast<duration_double>(
                            std::chrono::high_resolution_clock::now() - start)
@@ -36,7 +36,15 @@
 #include <inviwo/core/util/stringconversion.h>
 #include <inviwo/core/common/factoryutil.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <optional>
+
 #include <fmt/format.h>
+#include <glm/gtx/component_wise.hpp>
 
 namespace inviwo::animation {
 
@@ -90,49 +98,139 @@ private:
 };
 
 namespace {
+/**
+ * Writes each recorded frame to a file of its own. The frames are copied into reusable frame
+ * buffers and written by jobs on the thread pool, at most `maxQueued` frames are in flight at any
+ * time. When the queue is full record() blocks until a frame has been written, which bounds the
+ * memory use when rendering is faster than writing. The file names are assigned in record order.
+ */
 class ImageRecorder : public Recorder {
 public:
     ImageRecorder(InviwoApplication* app, const std::filesystem::path& dir, std::string_view format,
-                  std::shared_ptr<DataWriterType<Layer>> writer)
+                  std::shared_ptr<DataWriterType<Layer>> writer, size_t maxQueued)
         : Recorder{}
         , app_{app}
         , dir_{dir}
         , format_{format}
         , writer_{std::move(writer)}
-        , count_{1} {}
+        , count_{1}
+        , maxQueued_{std::max(maxQueued, size_t{1})}
+        , state_{std::make_shared<State>()} {}
 
-    virtual ~ImageRecorder() = default;
+    virtual ~ImageRecorder() {
+        // Wait for the queued frames, the frames might otherwise still be written after the
+        // rendering has finished.
+        std::unique_lock lock{state_->mutex};
+        state_->condition.wait(lock, [&]() { return state_->queued == 0; });
+    }
     virtual void record(const Layer& layer) override;
+    virtual RecorderStatistics statistics() const override;
 
 private:
+    using clock = std::chrono::steady_clock;
+
+    struct State {
+        mutable std::mutex mutex;
+        std::condition_variable condition;
+        std::vector<std::shared_ptr<Layer>> frames;  ///< Frame buffers ready for reuse
+        size_t queued = 0;
+        size_t maxQueued = 0;
+        size_t written = 0;
+        clock::duration blocked{0};
+        std::optional<clock::time_point> start;
+    };
+
+    std::shared_ptr<Layer> copyFrame(const LayerRAM& src, std::shared_ptr<Layer> frame) const;
+
     InviwoApplication* app_;
     std::filesystem::path dir_;
     std::string format_;
     std::shared_ptr<DataWriterType<Layer>> writer_;
     size_t count_;
+    size_t maxQueued_;
+    std::shared_ptr<State> state_;
     ExceptionPropagator exceptionProp_;
 };
 
+std::shared_ptr<Layer> ImageRecorder::copyFrame(const LayerRAM& src,
+                                                std::shared_ptr<Layer> frame) const {
+    if (!frame) {
+        // Only clone the RAM representation, that is all the writers need
+        return std::make_shared<Layer>(std::shared_ptr<LayerRAM>(src.clone()));
+    }
+
+    auto* dst = frame->getEditableRepresentation<LayerRAM>();
+    dst->setSwizzleMask(src.getSwizzleMask());
+    std::memcpy(dst->getData(), src.getData(),
+                glm::compMul(src.getDimensions()) * src.getDataFormat()->getSizeInBytes());
+    return frame;
+}
+
 void ImageRecorder::record(const Layer& layer) {
     exceptionProp_.throwOnError();
 
-    // Hackish: Make sure LayerRAM is the last valid rep, so
-    // that it is the one that will be cloned. This also
-    // forces the download to happen on the main thread
-    // instead of in the background.
-    layer.getRepresentation<LayerRAM>();
-    util::dispatchPool(
-        app_, [writer = writer_, file = dir_ / fmt::format(fmt::runtime(format_), count_),
-               copy = std::shared_ptr<Layer>(layer.clone()), exception = exceptionProp_.get()]() {
-            try {
-                writer->writeData(copy.get(), file);
-            } catch (...) {
-                exception->setException();
-            }
+    // Download the layer on the main thread, the copy below is only a memcpy
+    const auto& ram = *layer.getRepresentation<LayerRAM>();
+
+    std::shared_ptr<Layer> frame;
+    {
+        std::unique_lock lock{state_->mutex};
+        const auto waitStart = clock::now();
+        if (!state_->start) state_->start = waitStart;
+        state_->condition.wait(lock, [&]() { return state_->queued < maxQueued_; });
+        state_->blocked += clock::now() - waitStart;
+
+        ++state_->queued;
+        state_->maxQueued = std::max(state_->maxQueued, state_->queued);
+
+        auto it = std::find_if(state_->frames.begin(), state_->frames.end(), [&](auto& item) {
+            return item->getDimensions() == ram.getDimensions() &&
+                   item->getDataFormat() == ram.getDataFormat();
         });
+        if (it != state_->frames.end()) {
+            frame = std::move(*it);
+            state_->frames.erase(it);
+        }
+    }
+
+    try {
+        frame = copyFrame(ram, std::move(frame));
+    } catch (...) {
+        std::scoped_lock lock{state_->mutex};
+        --state_->queued;
+        state_->condition.notify_all();
+        throw;
+    }
+
+    auto file = dir_ / fmt::format(fmt::runtime(format_), count_);
+    util::dispatchPool(app_, [writer = writer_, file = std::move(file), frame = std::move(frame),
+                              state = state_, exception = exceptionProp_.get()]() mutable {
+        try {
+            writer->writeData(frame.get(), file);
+        } catch (...) {
+            exception->setException();
+        }
+
+        std::scoped_lock lock{state->mutex};
+        state->frames.push_back(std::move(frame));
+        --state->queued;
+        ++state->written;
+        state->condition.notify_all();
+    });
 
     ++count_;
 }
+
+RecorderStatistics ImageRecorder::statistics() const {
+    std::scoped_lock lock{state_->mutex};
+    return {.recorded = count_ - 1,
+            .written = state_->written,
+            .queued = state_->queued,
+            .maxQueued = state_->maxQueued,
+            .queueLimit = maxQueued_,
+            .blocked = state_->blocked,
+            .elapsed = state_->start ? clock::now() - *state_->start : clock::duration{0}};
+}
 }  // namespace
 
 ImageRecorderFactory::ImageRecorderFactory(InviwoApplication* app)
@@ -146,9 +244,14 @@ ImageRecorderFactory::ImageRecorderFactory(InviwoApplication* app)
                 " For example: 'frame0001.png'"_help,
                 "frame"}
     , writer_{"writer", "Writer"}
-    , overwrite_{"overwrite", "Overwrite", false} {
+    , overwrite_{"overwrite", "Overwrite", false}
+    , maxQueuedFrames_{"maxQueuedFrames", "Max Queued Frames",
+                       util::ordinalCount<size_t>(8, 64).setMin(1).set(
+                           "The number of frames that can be waiting to be written. Rendering "
+                           "will pause when the queue is full, which limits the memory used when "
+                           "rendering is faster than writing."_help)} {
 
-    options_.addProperties(outputDirectory_, baseName_, writer_, overwrite_);
+    options_.addProperties(outputDirectory_, baseName_, writer_, overwrite_, maxQueuedFrames_);
 }
 
 const std::string& ImageRecorderFactory::getClassIdentifier() const { return name_; }
@@ -183,7 +286,8 @@ std::unique_ptr<Recorder> ImageRecorderFactory::create(const RecorderOptions& op
                               writer_.getSelectedValue().extension_);
     replaceInString(format, "UPN", opts.sourceName);
 
-    return std::make_unique<ImageRecorder>(app_, outputDirectory_.get(), format, std::move(writer));
+    return std::make_unique<ImageRecorder>(app_, outputDirectory_.get(), format, std::move(writer),
+                                           maxQueuedFrames_.get());
 }
 
 }  // namespace inviwo::animation
@@ -29,4 +29,10 @@
 
 #include <modules/animation/factories/recorderfactory.h>
 
-namespace inviwo {}  // namespace inviwo
+namespace inviwo::animation {
+
+double RecorderStatistics::framesPerSecond() const {
+    return elapsed.count() > 0.0 ? static_cast<double>(written) / elapsed.count() : 0.0;
+}
+
+}  // namespace inviwo::animation
@@ -3,4 +3,5 @@
 # List modules on the format "Inviwo<ModuleName>Module"
 set(dependencies
 )
-set(EnableByDefault ON)
\ No newline at end of file
+set(EnableByDefault ON)
+set(threadSafe ON)
\ No newline at end of file
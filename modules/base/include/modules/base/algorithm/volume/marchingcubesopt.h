@@ -53,6 +53,12 @@ namespace util {
  * Note: Shares interface with util::marchingcbes and util::marchingtetrahedron
  * This is an optimized version of util::marchingcubes
  *
+ * Large volumes are split into slabs along z that are processed concurrently on the thread pool,
+ * the vertices on the faces shared by two slabs are welded when the slabs are joined. The slabs
+ * only depend on the volume dimensions, so the result does not depend on the pool size. The
+ * progress and masking callbacks might be called from several threads, but the progress callback
+ * is never called concurrently.
+ *
  * @param volume the scalar volume
  * @param iso iso-value for the extracted surface
  * @param color the color of the resulting surface
@@ -33,11 +33,13 @@
 #include <inviwo/core/datastructures/volume/volumeram.h>  // for VolumeRAM
 #include <inviwo/core/util/glmconvert.h>                  // for glm_convert
 #include <inviwo/core/util/glmvec.h>                      // for vec3, size3_t
-#include <modules/base/datastructures/kdtree.h>           // for K3DTree
+#include <inviwo/core/util/hashcombine.h>                 // for hash_combine
 
-#include <array>    // for array, array<>::value_type
-#include <cstddef>  // for size_t
-#include <vector>   // for vector
+#include <array>          // for array, array<>::value_type
+#include <cstddef>        // for size_t
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for pair
+#include <vector>         // for vector
 
 #include <glm/fwd.hpp>   // for vec3
 #include <glm/vec3.hpp>  // for vec<>::(anonymous)
@@ -53,18 +55,74 @@ double getValue(const T* src, size3_t pos, size3_t dim, double iso, bool invert)
     return invert ? v - iso : -(v - iso);
 }
 
-glm::vec3 interpolate(const glm::vec3& p0, double v0, const glm::vec3& p1, double v1);
+/**
+ * A corner of a cell, i.e. a grid point of the volume
+ */
+struct GridPoint {
+    size_t index;  ///< linear index of the grid point in the volume
+    vec3 pos;
+    double value;
+};
+
+/**
+ * A vertex of the extracted surface. It lies either on the edge between the grid points @p a and
+ * @p b (a < b), or on the grid point @p a if a == b.
+ */
+struct EdgeVertex {
+    size_t a;
+    size_t b;
+    vec3 pos;
+};
+
+/**
+ * Welds the vertices of the extracted surface by the grid edge they lie on, which makes the lookup
+ * O(1) and independent of any distance threshold. The vertices are grouped by the z-plane of their
+ * first grid point. When marching through the volume slice by slice only the planes of the current
+ * slice can be shared with upcoming cells, call startSlice() before each slice to discard the
+ * rest. If startSlice() is never called, all vertices are kept.
+ */
+class VertexCache {
+public:
+    explicit VertexCache(const size3_t& dim);
+
+    /**
+     * Start processing the cells between z-plane @p z and z + 1. Discards all vertices of
+     * z-plane z - 1.
+     */
+    void startSlice(size_t z);
+
+    /**
+     * Returns the index of vertex @p v, adding it to @p positions and @p normals if it is not
+     * already in the cache.
+     */
+    size_t add(const EdgeVertex& v, std::vector<vec3>& positions, std::vector<vec3>& normals);
+
+private:
+    using Key = std::pair<size_t, size_t>;
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept {
+            size_t h = 0;
+            util::hash_combine(h, key.first);
+            util::hash_combine(h, key.second);
+            return h;
+        }
+    };
+
+    size_t planeSize_;
+    std::array<std::unordered_map<Key, size_t, KeyHash>, 2> planes_;
+};
+
+EdgeVertex gridVertex(const GridPoint& p);
 
-void evaluateTriangle(K3DTree<size_t, float>& vertexTree, IndexBufferRAM* indexBuffer,
-                      std::vector<vec3>& positions, std::vector<vec3>& normals, const glm::vec3& p0,
-                      double v0, const glm::vec3& p1, double v1, const glm::vec3& p2, double v2);
+EdgeVertex interpolate(const GridPoint& p0, const GridPoint& p1);
 
-size_t addVertex(K3DTree<size_t, float>& vertexTree, std::vector<vec3>& positions,
-                 std::vector<vec3>& normals, const vec3 pos);
+void evaluateTriangle(VertexCache& vertexCache, IndexBufferRAM* indexBuffer,
+                      std::vector<vec3>& positions, std::vector<vec3>& normals, const GridPoint& p0,
+                      const GridPoint& p1, const GridPoint& p2);
 
-void addTriangle(K3DTree<size_t, float>& vertexTree, IndexBufferRAM* indexBuffer,
-                 std::vector<vec3>& positions, std::vector<vec3>& normals, const glm::vec3& a,
-                 const glm::vec3& b, const glm::vec3& c);
+void addTriangle(VertexCache& vertexCache, IndexBufferRAM* indexBuffer,
+                 std::vector<vec3>& positions, std::vector<vec3>& normals, const EdgeVertex& a,
+                 const EdgeVertex& b, const EdgeVertex& c);
 
 template <typename T>
 void encloseSurfce(const T* src, const size3_t& dim, IndexBufferRAM* indexBuffer,
@@ -75,11 +133,14 @@ void encloseSurfce(const T* src, const size3_t& dim, IndexBufferRAM* indexBuffer
         return {size_t(0), n - 1};
     };
 
-    std::array<vec3, 4> pos;
-    std::array<double, 4> values;
+    std::array<GridPoint, 4> points;
+    const auto gridPoint = [&](const size3_t& ind, double x, double y, double z) {
+        return GridPoint{VolumeRAM::posToIndex(ind, dim), vec3(x, y, z),
+                         marching::getValue(src, ind, dim, iso, invert)};
+    };
 
     {
-        K3DTree<size_t, float> sideVertexTree;
+        VertexCache sideVertexCache{dim};
         // Z axis
         for (auto& k : cubeEdgeIndices(dim.z)) {
             for (size_t j = 0; j < dim.y - 1; ++j) {
@@ -88,33 +149,28 @@ void encloseSurfce(const T* src, const size3_t& dim, IndexBufferRAM* indexBuffer
                     double y = dy * j;
                     double z = dz * k;
 
-                    pos[0] = glm::vec3(x, y, z);
-                    pos[1] = glm::vec3(x + dx, y, z);
-                    pos[2] = glm::vec3(x + dx, y + dy, z);
-                    pos[3] = glm::vec3(x, y + dy, z);
-
-                    values[0] = marching::getValue(src, size3_t(i, j, k), dim, iso, invert);
-                    values[1] = marching::getValue(src, size3_t(i + 1, j, k), dim, iso, invert);
-                    values[2] = marching::getValue(src, size3_t(i + 1, j + 1, k), dim, iso, invert);
-                    values[3] = marching::getValue(src, size3_t(i, j + 1, k), dim, iso, invert);
+                    points[0] = gridPoint(size3_t(i, j, k), x, y, z);
+                    points[1] = gridPoint(size3_t(i + 1, j, k), x + dx, y, z);
+                    points[2] = gridPoint(size3_t(i + 1, j + 1, k), x + dx, y + dy, z);
+                    points[3] = gridPoint(size3_t(i, j + 1, k), x, y + dy, z);
 
                     if (k == 0) {
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[0],
-                                         values[0], pos[3], values[3], pos[1], values[1]);
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[1],
-                                         values[1], pos[3], values[3], pos[2], values[2]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[0], points[3], points[1]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[1], points[3], points[2]);
                     } else {
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[0],
-                                         values[0], pos[1], values[1], pos[3], values[3]);
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[1],
-                                         values[1], pos[2], values[2], pos[3], values[3]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[0], points[1], points[3]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[1], points[2], points[3]);
                     }
                 }
             }
         }
     }
     {
-        K3DTree<size_t, float> sideVertexTree;
+        VertexCache sideVertexCache{dim};
         // Y axis
         for (size_t k = 0; k < dim.z - 1; ++k) {
             for (auto& j : cubeEdgeIndices(dim.y)) {
@@ -123,33 +179,28 @@ void encloseSurfce(const T* src, const size3_t& dim, IndexBufferRAM* indexBuffer
                     double y = dy * j;
                     double z = dz * k;
 
-                    pos[0] = glm::vec3(x, y, z);
-                    pos[1] = glm::vec3(x + dx, y, z);
-                    pos[2] = glm::vec3(x + dx, y, z + dz);
-                    pos[3] = glm::vec3(x, y, z + dz);
-
-                    values[0] = marching::getValue(src, size3_t(i, j, k), dim, iso, invert);
-                    values[1] = marching::getValue(src, size3_t(i + 1, j, k), dim, iso, invert);
-                    values[2] = marching::getValue(src, size3_t(i + 1, j, k + 1), dim, iso, invert);
-                    values[3] = marching::getValue(src, size3_t(i, j, k + 1), dim, iso, invert);
+                    points[0] = gridPoint(size3_t(i, j, k), x, y, z);
+                    points[1] = gridPoint(size3_t(i + 1, j, k), x + dx, y, z);
+                    points[2] = gridPoint(size3_t(i + 1, j, k + 1), x + dx, y, z + dz);
+                    points[3] = gridPoint(size3_t(i, j, k + 1), x, y, z + dz);
 
                     if (j == 0) {
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[0],
-                                         values[0], pos[1], values[1], pos[2], values[2]);
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[0],
-                                         values[0], pos[2], values[2], pos[3], values[3]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[0], points[1], points[2]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[0], points[2], points[3]);
                     } else {
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[0],
-                                         values[0], pos[2], values[2], pos[1], values[1]);
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[0],
-                                         values[0], pos[3], values[3], pos[2], values[2]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[0], points[2], points[1]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[0], points[3], points[2]);
                     }
                 }
             }
         }
     }
     {
-        K3DTree<size_t, float> sideVertexTree;
+        VertexCache sideVertexCache{dim};
         // X axis
         for (size_t k = 0; k < dim.z - 1; ++k) {
             for (size_t j = 0; j < dim.y - 1; ++j) {
@@ -158,26 +209,21 @@ void encloseSurfce(const T* src, const size3_t& dim, IndexBufferRAM* indexBuffer
                     double y = dy * j;
                     double z = dz * k;
 
-                    pos[0] = glm::vec3(x, y, z);
-                    pos[1] = glm::vec3(x, y + dy, z);
-                    pos[2] = glm::vec3(x, y + dy, z + dz);
-                    pos[3] = glm::vec3(x, y, z + dz);
-
-                    values[0] = marching::getValue(src, size3_t(i, j, k), dim, iso, invert);
-                    values[1] = marching::getValue(src, size3_t(i, j + 1, k), dim, iso, invert);
-                    values[2] = marching::getValue(src, size3_t(i, j + 1, k + 1), dim, iso, invert);
-                    values[3] = marching::getValue(src, size3_t(i, j, k + 1), dim, iso, invert);
+                    points[0] = gridPoint(size3_t(i, j, k), x, y, z);
+                    points[1] = gridPoint(size3_t(i, j + 1, k), x, y + dy, z);
+                    points[2] = gridPoint(size3_t(i, j + 1, k + 1), x, y + dy, z + dz);
+                    points[3] = gridPoint(size3_t(i, j, k + 1), x, y, z + dz);
 
                     if (i == 0) {
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[0],
-                                         values[0], pos[3], values[3], pos[1], values[1]);
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[1],
-                                         values[1], pos[3], values[3], pos[2], values[2]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[0], points[3], points[1]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[1], points[3], points[2]);
                     } else {
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[0],
-                                         values[0], pos[1], values[1], pos[3], values[3]);
-                        evaluateTriangle(sideVertexTree, indexBuffer, positions, normals, pos[1],
-                                         values[1], pos[2], values[2], pos[3], values[3]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[0], points[1], points[3]);
+                        evaluateTriangle(sideVertexCache, indexBuffer, positions, normals,
+                                         points[1], points[2], points[3]);
                     }
                 }
             }
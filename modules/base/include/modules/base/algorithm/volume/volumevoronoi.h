@@ -45,6 +45,14 @@ class Volume;
 
 namespace util {
 
+/**
+ * How voronoiSegmentation finds the closest seed point of each voxel. Both give the same result.
+ */
+enum class VoronoiSearch {
+    Grid,       ///< Bin the seed points in a uniform grid and only visit the cells close to a voxel
+    BruteForce  ///< Compare every voxel against every seed point
+};
+
 /**
  * Implementation of Voronoi segmentation.
  *
@@ -62,12 +70,15 @@ namespace util {
  *     * wrapping the wrapping mode of the volume, @see Wrapping3D.
  *     * weights is an optional vector containing the weights for each seed point. If set the
  *       weighted version of voronoi should be used.
+ *     * search how to find the closest seed point, @see VoronoiSearch. The grid search visits
+ *       only a few seed points per voxel, the brute force search is mostly useful as a reference.
  */
 
 IVW_MODULE_BASE_API std::shared_ptr<Volume> voronoiSegmentation(
     const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
     const std::vector<std::pair<uint32_t, vec3>>& seedPointsWithIndices, const Wrapping3D& wrapping,
-    const std::optional<std::vector<float>>& weights);
+    const std::optional<std::vector<float>>& weights,
+    VoronoiSearch search = VoronoiSearch::Grid);
 
 }  // namespace util
 }  // namespace inviwo
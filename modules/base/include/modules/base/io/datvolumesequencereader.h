@@ -34,6 +34,7 @@
 #include <inviwo/core/datastructures/volume/volume.h>  // for DataReaderType
 #include <inviwo/core/io/datareader.h>                 // for DataReaderType
 
+#include <any>          // for any
 #include <memory>       // for shared_ptr
 #include <string_view>  // for string_view
 #include <vector>       // for vector
@@ -80,6 +81,12 @@ namespace inviwo {
  *   - __AxisUnits__    Space separated axes units (Optional, defaults to Unit{})
  *   - __Axis(1|2|3)Unit__ Axis unit (Optional, defaults to Unit{})
  *
+ *  Supported options:
+ *   - "MemoryMap" (bool, default false): Back the loaded VolumeRAMs by memory mappings of the raw
+ *     files when they have native byte order, see RawVolumeRAMLoader.
+ *   - "Bricked" (bool, default false): Also add VolumeBricked representations that load bricks
+ *     of the raw files on demand, see RawVolumeRAMLoader::createBricked.
+ *
  *  The tag names are case insensitive and should always be followed by a ":"
  *  Anything after a '#' will be considered a comment.
  *
@@ -102,8 +109,13 @@ public:
     virtual std::shared_ptr<VolumeSequence> readData(
         const std::filesystem::path& filePath) override;
 
+    virtual bool setOption(std::string_view key, std::any value) override;
+    virtual std::any getOption(std::string_view key) override;
+
 private:
     bool enableLogOutput_;
+    bool memoryMap_;
+    bool bricked_;
 };
 
 }  // namespace inviwo
@@ -34,12 +34,18 @@
 #include <inviwo/core/datastructures/volume/volume.h>  // for DataReaderType
 #include <inviwo/core/io/datareader.h>                 // for DataReaderType
 
+#include <any>          // for any
 #include <memory>       // for shared_ptr
 #include <string_view>  // for string_view
 
 namespace inviwo {
 /**
  * \ingroup dataio
+ * Supported options:
+ *  - "MemoryMap" (bool, default false): Back the loaded VolumeRAM by a memory mapping of the raw
+ *    file when it has native byte order, see RawVolumeRAMLoader.
+ *  - "Bricked" (bool, default false): Also add a VolumeBricked representation that loads bricks
+ *    of the raw file on demand, see RawVolumeRAMLoader::createBricked.
  */
 class IVW_MODULE_BASE_API IvfVolumeReader : public DataReaderType<Volume> {
 public:
@@ -50,6 +56,13 @@ public:
     virtual ~IvfVolumeReader() = default;
 
     virtual std::shared_ptr<Volume> readData(const std::filesystem::path& filePath) override;
+
+    virtual bool setOption(std::string_view key, std::any value) override;
+    virtual std::any getOption(std::string_view key) override;
+
+private:
+    bool memoryMap_ = false;
+    bool bricked_ = false;
 };
 
 }  // namespace inviwo
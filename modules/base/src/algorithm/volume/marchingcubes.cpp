@@ -42,7 +42,6 @@
 #include <inviwo/core/util/glmvec.h>                                    // for size3_t, vec3, vec4
 #include <inviwo/core/util/sourcecontext.h>                             // for IVW_CONTEXT_CUSTOM
 #include <modules/base/algorithm/volume/surfaceextraction.h>            // for addTriangle, encl...
-#include <modules/base/datastructures/kdtree.h>                         // for K3DTree
 
 #include <algorithm>      // for max
 #include <array>          // for array, array<>::v...
@@ -559,9 +558,9 @@ std::array<std::vector<Triangle>, 256> cases = {
     std::vector<Triangle>{Triangle{0, 1, 3, 0, 0, 4}},
     std::vector<Triangle>{}};
 
-void evaluateCube(K3DTree<size_t, float>& vertexTree, IndexBufferRAM* indexBuffer,
+void evaluateCube(marching::VertexCache& vertexCache, IndexBufferRAM* indexBuffer,
                   std::vector<vec3>& positions, std::vector<vec3>& normals,
-                  const std::array<vec3, 8>& pos, const std::array<double, 8>& values) {
+                  const std::array<marching::GridPoint, 8>& points) {
     int index = 0;
 
     //  v7 ----- v6
@@ -571,27 +570,21 @@ void evaluateCube(K3DTree<size_t, float>& vertexTree, IndexBufferRAM* indexBuffe
     // |/       |/
     // v0 ----- v1
 
-    if (values[0] > 0) index = index | 1;
-    if (values[1] > 0) index = index | 2;
-    if (values[2] > 0) index = index | 4;
-    if (values[3] > 0) index = index | 8;
-    if (values[4] > 0) index = index | 16;
-    if (values[5] > 0) index = index | 32;
-    if (values[6] > 0) index = index | 64;
-    if (values[7] > 0) index = index | 128;
+    if (points[0].value > 0) index = index | 1;
+    if (points[1].value > 0) index = index | 2;
+    if (points[2].value > 0) index = index | 4;
+    if (points[3].value > 0) index = index | 8;
+    if (points[4].value > 0) index = index | 16;
+    if (points[5].value > 0) index = index | 32;
+    if (points[6].value > 0) index = index | 64;
+    if (points[7].value > 0) index = index | 128;
 
     for (auto t : cases[index]) {
-        auto interpolate = [&](auto a, auto b) {
-            auto v0 = values[a];
-            auto v1 = values[b];
-            float t = static_cast<float>(v0 / (v0 - v1));
-            return pos[a] + t * (pos[b] - pos[a]);
-        };
-        vec3 p0 = interpolate(t.e0a, t.e0b);
-        vec3 p1 = interpolate(t.e1a, t.e1b);
-        vec3 p2 = interpolate(t.e2a, t.e2b);
-
-        marching::addTriangle(vertexTree, indexBuffer, positions, normals, p0, p1, p2);
+        const auto p0 = marching::interpolate(points[t.e0a], points[t.e0b]);
+        const auto p1 = marching::interpolate(points[t.e1a], points[t.e1b]);
+        const auto p2 = marching::interpolate(points[t.e2a], points[t.e2b]);
+
+        marching::addTriangle(vertexCache, indexBuffer, positions, normals, p0, p1, p2);
     }
 }
 
@@ -611,7 +604,8 @@ std::shared_ptr<Mesh> marchingcubes(std::shared_ptr<const Volume> volume, double
             throw Exception("Masking callback not set", IVW_CONTEXT_CUSTOM("util::marchingcubes"));
         }
 
-        K3DTree<size_t, float> vertexTree;
+        const size3_t dim{volume->getDimensions()};
+        marching::VertexCache vertexCache{dim};
 
         auto mesh = std::make_shared<BasicMesh>();
         auto indexBuffer = mesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::None);
@@ -624,7 +618,6 @@ std::shared_ptr<Mesh> marchingcubes(std::shared_ptr<const Volume> volume, double
 
         const T* src = ram->getDataTyped();
 
-        const size3_t dim{volume->getDimensions()};
         double dx, dy, dz;
         dx = 1.0 / static_cast<double>(std::max(size_t(1), (dim.x - 1)));
         dy = 1.0 / static_cast<double>(std::max(size_t(1), (dim.y - 1)));
@@ -636,6 +629,7 @@ std::shared_ptr<Mesh> marchingcubes(std::shared_ptr<const Volume> volume, double
         normals.reserve(volSize * 6);
 
         for (size_t k = 0; k < dim.z - 1; k++) {
+            vertexCache.startSlice(k);
             for (size_t j = 0; j < dim.y - 1; j++) {
                 for (size_t i = 0; i < dim.x - 1; i++) {
                     if (!maskingCallback({i, j, k})) continue;
@@ -643,17 +637,18 @@ std::shared_ptr<Mesh> marchingcubes(std::shared_ptr<const Volume> volume, double
                     double y = dy * j;
                     double z = dz * k;
 
-                    std::array<vec3, 8> pos;
-                    std::array<double, 8> values;
+                    std::array<marching::GridPoint, 8> points;
 
                     for (int l = 0; l < 8; l++) {
                         const auto& o = marchingcubes::offs[l];
-                        pos[l] = glm::vec3(x + dx * o.x, y + dy * o.y, z + dz * o.z);
-                        values[l] = marching::getValue(src, size3_t(i, j, k) + o, dim, iso, invert);
+                        const auto ind = size3_t(i, j, k) + o;
+                        points[l] = {VolumeRAM::posToIndex(ind, dim),
+                                     glm::vec3(x + dx * o.x, y + dy * o.y, z + dz * o.z),
+                                     marching::getValue(src, ind, dim, iso, invert)};
                     }
 
-                    marchingcubes::evaluateCube(vertexTree, indexBuffer.get(), positions, normals,
-                                                pos, values);
+                    marchingcubes::evaluateCube(vertexCache, indexBuffer.get(), positions,
+                                                normals, points);
                 }
             }
             if (progressCallback) {
@@ -43,13 +43,17 @@
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, vec4
 #include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
 #include <inviwo/core/util/stdextensions.h>                             // for make_array, contains
+#include <inviwo/core/util/threadutil.h>                                // for dispatchPool
 #include <modules/base/algorithm/volume/surfaceextraction.h>            // for encloseSurfce
 #include <modules/base/datastructures/disjointsets.h>                   // for DisjointSets
 
 #include <algorithm>      // for find_if, transform
 #include <bitset>         // for bitset, __bitset<...
 #include <cstdint>        // for uint32_t
+#include <future>         // for future
 #include <iterator>       // for distance, back_in...
+#include <limits>         // for numeric_limits
+#include <mutex>          // for mutex, scoped_lock
 #include <type_traits>    // for remove_extent_t
 #include <unordered_set>  // for unordered_set
 #include <utility>        // for pair
@@ -455,6 +459,86 @@ template <typename T, typename IsoTest>
 const std::array<OffsetIndexMasks, 4> Index<T, IsoTest>::oim_ = {
     {{0, 1, {0, 0, 0}}, {3, 2, {0, 1, 0}}, {4, 5, {0, 0, 1}}, {7, 6, {0, 1, 1}}}};
 
+/**
+ * Part of the surface extracted from a range of z-slices.
+ */
+struct Slab {
+    std::vector<vec3> positions;
+    std::vector<vec3> normals;
+    std::vector<std::uint32_t> indices;
+    // Vertices created on the first and last z-plane of the slab, as (plane key, vertex index)
+    std::vector<std::pair<size_t, std::uint32_t>> bottom;
+    std::vector<std::pair<size_t, std::uint32_t>> top;
+};
+
+/**
+ * Split the cells into slabs along z. The slab boundaries only depend on the size of the volume, so
+ * the resulting mesh is the same regardless of the number of threads used.
+ */
+std::vector<size_t> slabBoundaries(const size3_t& cells) {
+    constexpr size_t minCellsPerSlab = size_t{1} << 18;
+    constexpr size_t maxSlabs = 256;
+
+    const size_t sliceCells = std::max(size_t{1}, cells.x * cells.y);
+    const size_t thickness = std::max({(minCellsPerSlab + sliceCells - 1) / sliceCells,
+                                       (cells.z + maxSlabs - 1) / maxSlabs, size_t{1}});
+    std::vector<size_t> bounds;
+    for (size_t z = 0; z < cells.z; z += thickness) {
+        bounds.push_back(z);
+    }
+    bounds.push_back(cells.z);
+    return bounds;
+}
+
+/**
+ * Concatenate the slabs in order, welding the vertices on the bottom face of each slab to the
+ * matching vertices on the top face of the previous slab. The vertex order is the same as when
+ * extracting the whole volume as one slab.
+ */
+void mergeSlabs(std::vector<Slab>& slabs, std::vector<vec3>& positions, std::vector<vec3>& normals,
+                std::vector<std::uint32_t>& indices) {
+    if (slabs.size() == 1) {
+        positions.swap(slabs.front().positions);
+        normals.swap(slabs.front().normals);
+        indices.swap(slabs.front().indices);
+        return;
+    }
+
+    constexpr auto unmapped = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint32_t> remap;
+    std::vector<std::pair<size_t, std::uint32_t>> prevTop;
+    for (auto& slab : slabs) {
+        remap.assign(slab.positions.size(), unmapped);
+
+        std::sort(slab.bottom.begin(), slab.bottom.end());
+        auto top = prevTop.begin();
+        for (const auto& [key, local] : slab.bottom) {
+            top = std::lower_bound(top, prevTop.end(), std::pair{key, std::uint32_t{0}});
+            if (top != prevTop.end() && top->first == key) {
+                remap[local] = top->second;
+                normals[top->second] += slab.normals[local];
+            }
+        }
+
+        for (size_t i = 0; i < slab.positions.size(); ++i) {
+            if (remap[i] == unmapped) {
+                remap[i] = static_cast<std::uint32_t>(positions.size());
+                positions.push_back(slab.positions[i]);
+                normals.push_back(slab.normals[i]);
+            }
+        }
+        std::transform(slab.indices.begin(), slab.indices.end(), std::back_inserter(indices),
+                       [&](std::uint32_t i) { return remap[i]; });
+
+        prevTop.clear();
+        std::transform(slab.top.begin(), slab.top.end(), std::back_inserter(prevTop),
+                       [&](const auto& item) { return std::pair{item.first, remap[item.second]}; });
+        std::sort(prevTop.begin(), prevTop.end());
+
+        slab = Slab{};
+    }
+}
+
 }  // namespace
 
 namespace util {
@@ -488,78 +572,118 @@ std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, dou
         const util::IndexMapper3D im(dim);
 
         const auto dr = dvec3(1.0) / dvec3{glm::max(size3_t{1}, (dim - size3_t{1}))};
-        const auto doffs = [&]() {
-            std::array<dvec3, 8> tmp;
-            std::transform(cube.vertices.begin(), cube.vertices.end(), tmp.begin(),
-                           [dr](auto& v) { return dr * dvec3{v}; });
-            return tmp;
-        }();
 
-        const auto interpolate = [src, im, &mapValue, &doffs](const size3_t& ind, const dvec3& pos,
-                                                              marching::Config::EdgeId e) {
-            const auto a = cube.edges[e][0];
-            const auto b = cube.edges[e][1];
-            const auto tv0 = src[im(ind + cube.vertices[a])];
-            const auto v0 = mapValue(tv0);
-            const auto tv1 = src[im(ind + cube.vertices[b])];
-            const auto v1 = mapValue(tv1);
+        const auto interpolate = [src, im, dr, &mapValue](const size3_t& ind,
+                                                          marching::Config::EdgeId e) {
+            const auto a = ind + cube.vertices[cube.edges[e][0]];
+            const auto b = ind + cube.vertices[cube.edges[e][1]];
+            const auto v0 = mapValue(src[im(a)]);
+            const auto v1 = mapValue(src[im(b)]);
 
             const auto t = v0 / (v0 - v1);
-            const auto r0 = pos + doffs[a];
-            const auto r1 = pos + doffs[b];
+            const auto r0 = dvec3{a} * dr;
+            const auto r1 = dvec3{b} * dr;
             return r0 + t * (r1 - r0);
         };
 
-        VCache vcache(size2_t{dim.x, dim.y});
-        Index<T, decltype(isoTest)> index(src, im, isoTest);
-        size3_t ind;
-        dvec3 pos;
+        // Identifies an edge within a z-plane, used to match the vertices on the faces shared by
+        // two slabs
+        const auto planeKey = [&](const size3_t& ind, marching::Config::EdgeId e) -> size_t {
+            const auto& a = cube.vertices[cube.edges[e][0]];
+            const auto& b = cube.vertices[cube.edges[e][1]];
+            const auto p = ind + glm::min(a, b);
+            return 2 * (p.x + p.y * dim.x) + (a.y != b.y ? 1 : 0);
+        };
 
         const float err =
             static_cast<float>(4.0 * glm::epsilon<double>() * glm::epsilon<double>() * dr.x * dr.y);
 
-        for (ind.z = 0, pos.z = 0.0; ind.z < dim1.z; ++ind.z, pos.z += dr.z) {
-            vcache.incZ();
-            for (ind.y = 0, pos.y = 0.0; ind.y < dim1.y; ++ind.y, pos.y += dr.y) {
-                ind.x = 0;
-                const auto cInd = im(ind);
-                vcache.incY();
-                index.init(cInd);
-                for (pos.x = 0.0; ind.x < dim1.x; ++ind.x, pos.x += dr.x) {
-                    index.update(cInd + ind.x);
-                    if (index == 0 || index == 255) continue;
-                    if (maskingCallback && !maskingCallback(ind)) continue;
-
-                    std::array<size_t, 12> inds;
-                    for (const auto edge : cube.caseEdges[index]) {
-                        const auto c = vcache.find(ind, edge, positions.size());
-                        inds[edge] = c.first;
-                        if (c.second) {
-                            const auto vertex = interpolate(ind, pos, edge);
-                            positions.emplace_back(vertex);
-                            normals.emplace_back(0.0f, 0.0f, 0.0f);
-                        }
-                    }
-                    for (const auto& tri : cube.caseTriangles[index]) {
-                        const auto side0 = positions[inds[tri[1]]] - positions[inds[tri[0]]];
-                        const auto side1 = positions[inds[tri[2]]] - positions[inds[tri[0]]];
-                        auto n = glm::cross(side0, side1);
-                        if (glm::length2(n) < err) {
-                            continue;  // triangle is so small area is 0.
+        std::mutex progressMutex;
+        size_t slicesDone = 0;
+
+        const auto extract = [&](size_t zBegin, size_t zEnd, Slab& slab) {
+            VCache vcache(size2_t{dim.x, dim.y});
+            Index<T, decltype(isoTest)> index(src, im, isoTest);
+            size3_t ind;
+
+            for (ind.z = zBegin; ind.z < zEnd; ++ind.z) {
+                vcache.incZ();
+                const bool first = ind.z == zBegin;
+                const bool last = ind.z + 1 == zEnd;
+                for (ind.y = 0; ind.y < dim1.y; ++ind.y) {
+                    ind.x = 0;
+                    const auto cInd = im(ind);
+                    vcache.incY();
+                    index.init(cInd);
+                    for (; ind.x < dim1.x; ++ind.x) {
+                        index.update(cInd + ind.x);
+                        if (index == 0 || index == 255) continue;
+                        if (maskingCallback && !maskingCallback(ind)) continue;
+
+                        const size3_t slabInd{ind.x, ind.y, ind.z - zBegin};
+                        std::array<size_t, 12> inds;
+                        for (const auto edge : cube.caseEdges[index]) {
+                            const auto c = vcache.find(slabInd, edge, slab.positions.size());
+                            inds[edge] = c.first;
+                            if (c.second) {
+                                slab.positions.emplace_back(interpolate(ind, edge));
+                                slab.normals.emplace_back(0.0f, 0.0f, 0.0f);
+                                if (first && edge < 4) {
+                                    slab.bottom.emplace_back(planeKey(ind, edge),
+                                                             static_cast<std::uint32_t>(c.first));
+                                } else if (last && edge >= 8) {
+                                    slab.top.emplace_back(planeKey(ind, edge),
+                                                          static_cast<std::uint32_t>(c.first));
+                                }
+                            }
                         }
-                        n = glm::normalize(n);
-                        for (int v = 0; v < 3; ++v) {
-                            indices.push_back(static_cast<uint32_t>(inds[tri[v]]));
-                            normals[inds[tri[v]]] += n;
+                        for (const auto& tri : cube.caseTriangles[index]) {
+                            const auto side0 =
+                                slab.positions[inds[tri[1]]] - slab.positions[inds[tri[0]]];
+                            const auto side1 =
+                                slab.positions[inds[tri[2]]] - slab.positions[inds[tri[0]]];
+                            auto n = glm::cross(side0, side1);
+                            if (glm::length2(n) < err) {
+                                continue;  // triangle is so small area is 0.
+                            }
+                            n = glm::normalize(n);
+                            for (int v = 0; v < 3; ++v) {
+                                slab.indices.push_back(static_cast<uint32_t>(inds[tri[v]]));
+                                slab.normals[inds[tri[v]]] += n;
+                            }
                         }
+                        vcache.incX(cube.caseIncrements[index]);
                     }
-                    vcache.incX(cube.caseIncrements[index]);
                 }
+                if (progressCallback) {
+                    std::scoped_lock lock{progressMutex};
+                    ++slicesDone;
+                    progressCallback(static_cast<float>(slicesDone) /
+                                     static_cast<float>(dim.z - 1));
+                }
+            }
+        };
+
+        const auto bounds = slabBoundaries(dim1);
+        std::vector<Slab> slabs(bounds.size() - 1);
+        if (slabs.size() == 1 || util::getPoolSize() == 0) {
+            for (size_t i = 0; i < slabs.size(); ++i) {
+                extract(bounds[i], bounds[i + 1], slabs[i]);
+            }
+        } else {
+            std::vector<std::future<void>> futures;
+            for (size_t i = 0; i < slabs.size(); ++i) {
+                futures.push_back(util::dispatchPool(
+                    [&, i]() { extract(bounds[i], bounds[i + 1], slabs[i]); }));
+            }
+            for (auto& future : futures) {
+                util::getThreadPool().wait(future);
             }
-            if (progressCallback) {
-                progressCallback(static_cast<float>(ind.z + 1) / static_cast<float>(dim.z - 1));
+            for (auto& future : futures) {
+                future.get();
             }
         }
+        mergeSlabs(slabs, positions, normals, indices);
 
         if (enclose) {
             marching::encloseSurfce(src, dim, indexRAM, positions, normals, iso, invert, dr.x, dr.y,
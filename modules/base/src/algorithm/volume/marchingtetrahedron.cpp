@@ -43,7 +43,6 @@
 #include <inviwo/core/util/logcentral.h>                                // for LogCentral, LogWa...
 #include <inviwo/core/util/sourcecontext.h>                             // for IVW_CONTEXT_CUSTOM
 #include <modules/base/algorithm/volume/surfaceextraction.h>            // for interpolate, addT...
-#include <modules/base/datastructures/kdtree.h>                         // for K3DTree
 
 #include <algorithm>      // for max
 #include <array>          // for array, array<>::v...
@@ -88,94 +87,94 @@ const static std::array<std::array<size_t, 4>, 6> tetras = {
     std::array<size_t, 4>{2, 3, 5, 6}, std::array<size_t, 4>{0, 3, 4, 5},
     std::array<size_t, 4>{7, 4, 3, 5}, std::array<size_t, 4>{7, 6, 5, 3}};
 
-void evaluateTetra(K3DTree<size_t, float>& vertexTree, IndexBufferRAM* indexBuffer,
-                   std::vector<vec3>& positions, std::vector<vec3>& normals, const glm::vec3& p0,
-                   double v0, const glm::vec3& p1, double v1, const glm::vec3& p2, double v2,
-                   const glm::vec3& p3, double v3) {
+void evaluateTetra(marching::VertexCache& vertexCache, IndexBufferRAM* indexBuffer,
+                   std::vector<vec3>& positions, std::vector<vec3>& normals,
+                   const marching::GridPoint& p0, const marching::GridPoint& p1,
+                   const marching::GridPoint& p2, const marching::GridPoint& p3) {
     int index = 0;
-    if (v0 > 0) index = index | 1;
-    if (v1 > 0) index = index | 2;
-    if (v2 > 0) index = index | 4;
-    if (v3 > 0) index = index | 8;
-    glm::vec3 a, b, c, d;
+    if (p0.value > 0) index = index | 1;
+    if (p1.value > 0) index = index | 2;
+    if (p2.value > 0) index = index | 4;
+    if (p3.value > 0) index = index | 8;
+    marching::EdgeVertex a, b, c, d;
     if (index == 0 || index == 15) return;
     if (index == 1 || index == 14) {
-        a = marching::interpolate(p0, v0, p2, v2);
-        b = marching::interpolate(p0, v0, p1, v1);
-        c = marching::interpolate(p0, v0, p3, v3);
+        a = marching::interpolate(p0, p2);
+        b = marching::interpolate(p0, p1);
+        c = marching::interpolate(p0, p3);
         if (index == 1) {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, b, c);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, b, c);
         } else {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, c, b);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, c, b);
         }
     } else if (index == 2 || index == 13) {
-        a = marching::interpolate(p1, v1, p0, v0);
-        b = marching::interpolate(p1, v1, p2, v2);
-        c = marching::interpolate(p1, v1, p3, v3);
+        a = marching::interpolate(p1, p0);
+        b = marching::interpolate(p1, p2);
+        c = marching::interpolate(p1, p3);
         if (index == 2) {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, b, c);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, b, c);
         } else {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, c, b);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, c, b);
         }
 
     } else if (index == 4 || index == 11) {
-        a = marching::interpolate(p2, v2, p0, v0);
-        b = marching::interpolate(p2, v2, p1, v1);
-        c = marching::interpolate(p2, v2, p3, v3);
+        a = marching::interpolate(p2, p0);
+        b = marching::interpolate(p2, p1);
+        c = marching::interpolate(p2, p3);
         if (index == 4) {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, c, b);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, c, b);
         } else {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, b, c);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, b, c);
         }
     } else if (index == 7 || index == 8) {
-        a = marching::interpolate(p3, v3, p0, v0);
-        b = marching::interpolate(p3, v3, p2, v2);
-        c = marching::interpolate(p3, v3, p1, v1);
+        a = marching::interpolate(p3, p0);
+        b = marching::interpolate(p3, p2);
+        c = marching::interpolate(p3, p1);
         if (index == 7) {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, b, c);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, b, c);
         } else {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, c, b);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, c, b);
         }
     } else if (index == 3 || index == 12) {
-        a = marching::interpolate(p0, v0, p2, v2);
-        b = marching::interpolate(p1, v1, p3, v3);
-        c = marching::interpolate(p0, v0, p3, v3);
-        d = marching::interpolate(p1, v1, p2, v2);
+        a = marching::interpolate(p0, p2);
+        b = marching::interpolate(p1, p3);
+        c = marching::interpolate(p0, p3);
+        d = marching::interpolate(p1, p2);
 
         if (index == 3) {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, b, c);
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, d, b);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, b, c);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, d, b);
         } else {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, c, b);
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, b, d);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, c, b);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, b, d);
         }
 
     } else if (index == 5 || index == 10) {
-        a = marching::interpolate(p2, v2, p3, v3);
-        b = marching::interpolate(p0, v0, p1, v1);
-        c = marching::interpolate(p0, v0, p3, v3);
-        d = marching::interpolate(p1, v1, p2, v2);
+        a = marching::interpolate(p2, p3);
+        b = marching::interpolate(p0, p1);
+        c = marching::interpolate(p0, p3);
+        d = marching::interpolate(p1, p2);
 
         if (index == 5) {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, b, c);
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, d, b);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, b, c);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, d, b);
         } else {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, c, b);
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, b, d);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, c, b);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, b, d);
         }
 
     } else if (index == 6 || index == 9) {
-        a = marching::interpolate(p1, v1, p3, v3);
-        b = marching::interpolate(p0, v0, p2, v2);
-        c = marching::interpolate(p0, v0, p1, v1);
-        d = marching::interpolate(p2, v2, p3, v3);
+        a = marching::interpolate(p1, p3);
+        b = marching::interpolate(p0, p2);
+        c = marching::interpolate(p0, p1);
+        d = marching::interpolate(p2, p3);
 
         if (index == 6) {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, c, b);
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, b, d);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, c, b);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, b, d);
         } else {
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, b, c);
-            marching::addTriangle(vertexTree, indexBuffer, positions, normals, a, d, b);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, b, c);
+            marching::addTriangle(vertexCache, indexBuffer, positions, normals, a, d, b);
         }
     }
 }
@@ -196,7 +195,8 @@ std::shared_ptr<Mesh> marchingtetrahedron(std::shared_ptr<const Volume> volume,
                             IVW_CONTEXT_CUSTOM("util::marchingtetrahedron"));
         }
 
-        K3DTree<size_t, float> vertexTree;
+        const size3_t dim{volume->getDimensions()};
+        marching::VertexCache vertexCache{dim};
 
         auto mesh = std::make_shared<BasicMesh>();
         auto indexBuffer = mesh->addIndexBuffer(DrawType::Triangles, ConnectivityType::None);
@@ -209,7 +209,6 @@ std::shared_ptr<Mesh> marchingtetrahedron(std::shared_ptr<const Volume> volume,
 
         const T* src = ram->getDataTyped();
 
-        const size3_t dim{volume->getDimensions()};
         double dx, dy, dz;
         dx = 1.0 / static_cast<double>(std::max(size_t(1), (dim.x - 1)));
         dy = 1.0 / static_cast<double>(std::max(size_t(1), (dim.y - 1)));
@@ -221,6 +220,7 @@ std::shared_ptr<Mesh> marchingtetrahedron(std::shared_ptr<const Volume> volume,
         normals.reserve(volSize * 6);
 
         for (size_t k = 0; k < dim.z - 1; k++) {
+            vertexCache.startSlice(k);
             for (size_t j = 0; j < dim.y - 1; j++) {
                 for (size_t i = 0; i < dim.x - 1; i++) {
                     if (!maskingCallback({i, j, k})) continue;
@@ -228,20 +228,21 @@ std::shared_ptr<Mesh> marchingtetrahedron(std::shared_ptr<const Volume> volume,
                     double y = dy * j;
                     double z = dz * k;
 
-                    std::array<vec3, 8> pos;
-                    std::array<double, 8> values;
+                    std::array<marching::GridPoint, 8> points;
 
                     for (int l = 0; l < 8; l++) {
                         const auto& o = marchingtetrahedron::offs[l];
-                        pos[l] = glm::vec3(x + dx * o.x, y + dy * o.y, z + dz * o.z);
-                        values[l] = marching::getValue(src, size3_t(i, j, k) + o, dim, iso, invert);
+                        const auto ind = size3_t(i, j, k) + o;
+                        points[l] = {VolumeRAM::posToIndex(ind, dim),
+                                     glm::vec3(x + dx * o.x, y + dy * o.y, z + dz * o.z),
+                                     marching::getValue(src, ind, dim, iso, invert)};
                     }
 
                     for (auto& t : marchingtetrahedron::tetras) {
-                        marchingtetrahedron::evaluateTetra(vertexTree, indexBuffer.get(), positions,
-                                                           normals, pos[t[0]], values[t[0]],
-                                                           pos[t[1]], values[t[1]], pos[t[2]],
-                                                           values[t[2]], pos[t[3]], values[t[3]]);
+                        marchingtetrahedron::evaluateTetra(vertexCache, indexBuffer.get(),
+                                                           positions, normals, points[t[0]],
+                                                           points[t[1]], points[t[2]],
+                                                           points[t[3]]);
                     }
                 }
             }
@@ -31,107 +31,114 @@
 
 #include <inviwo/core/datastructures/buffer/bufferram.h>  // for IndexBufferRAM
 #include <inviwo/core/util/glmvec.h>                      // for vec3
-#include <modules/base/datastructures/kdtree.h>           // for K3DTree, KDNode, KDTreeGlm<>::Node
 
-#include <cstdint>  // for uint32_t
+#include <algorithm>  // for min, max
+#include <cstdint>    // for uint32_t
 
-#include <glm/ext/scalar_constants.hpp>  // for epsilon
-#include <glm/fwd.hpp>                   // for vec3
-#include <glm/geometric.hpp>             // for cross, dot, normalize
-#include <glm/gtc/type_ptr.hpp>          // for value_ptr
-#include <glm/gtx/norm.hpp>              // for distance2
+#include <glm/fwd.hpp>        // for vec3
+#include <glm/geometric.hpp>  // for cross, dot, normalize
+#include <glm/gtx/norm.hpp>   // for length2
 
 namespace inviwo {
 namespace marching {
 
-glm::vec3 interpolate(const glm::vec3& p0, double v0, const glm::vec3& p1, double v1) {
-    if (v0 == v1) {
-        return p0;
+VertexCache::VertexCache(const size3_t& dim) : planeSize_{dim.x * dim.y}, planes_{} {}
+
+void VertexCache::startSlice(size_t z) { planes_[(z + 1) % 2].clear(); }
+
+size_t VertexCache::add(const EdgeVertex& v, std::vector<vec3>& positions,
+                        std::vector<vec3>& normals) {
+    auto& plane = planes_[(v.a / planeSize_) % 2];
+    const auto [it, inserted] = plane.try_emplace(Key{v.a, v.b}, positions.size());
+    if (inserted) {
+        positions.push_back(v.pos);
+        normals.push_back(vec3(0, 0, 0));
+    }
+    return it->second;
+}
+
+EdgeVertex gridVertex(const GridPoint& p) { return {p.index, p.index, p.pos}; }
+
+EdgeVertex interpolate(const GridPoint& p0, const GridPoint& p1) {
+    // Snap intersections at the grid points to the grid point itself, that way they are shared
+    // between all edges meeting there.
+    if (p0.value == p1.value || p0.value == 0.0) {
+        return gridVertex(p0);
+    } else if (p1.value == 0.0) {
+        return gridVertex(p1);
     }
-    float t = static_cast<float>(v0 / (v0 - v1));
-    return p0 + t * (p1 - p0);
+    float t = static_cast<float>(p0.value / (p0.value - p1.value));
+    return {std::min(p0.index, p1.index), std::max(p0.index, p1.index),
+            p0.pos + t * (p1.pos - p0.pos)};
 }
 
-void evaluateTriangle(K3DTree<size_t, float>& vertexTree, IndexBufferRAM* indexBuffer,
-                      std::vector<vec3>& positions, std::vector<vec3>& normals, const glm::vec3& p0,
-                      double v0, const glm::vec3& p1, double v1, const glm::vec3& p2, double v2) {
+void evaluateTriangle(VertexCache& vertexCache, IndexBufferRAM* indexBuffer,
+                      std::vector<vec3>& positions, std::vector<vec3>& normals, const GridPoint& p0,
+                      const GridPoint& p1, const GridPoint& p2) {
     int index = 0;
-    if (v0 <= 0.0) index += 1;
-    if (v1 <= 0.0) index += 2;
-    if (v2 <= 0.0) index += 4;
+    if (p0.value <= 0.0) index += 1;
+    if (p1.value <= 0.0) index += 2;
+    if (p2.value <= 0.0) index += 4;
 
     if (index == 0) {  // FULLY OUTSIDE
         return;
     } else if (index == 1) {  // ONLY P0 INSIDE
-        auto p01 = interpolate(p0, v0, p1, v1);
-        auto p02 = interpolate(p0, v0, p2, v2);
-        addTriangle(vertexTree, indexBuffer, positions, normals, p0, p01, p02);
+        auto p01 = interpolate(p0, p1);
+        auto p02 = interpolate(p0, p2);
+        addTriangle(vertexCache, indexBuffer, positions, normals, gridVertex(p0), p01, p02);
     } else if (index == 2) {  // ONLY P1 INSIDE
-        auto p10 = interpolate(p1, v1, p0, v0);
-        auto p12 = interpolate(p1, v1, p2, v2);
-        addTriangle(vertexTree, indexBuffer, positions, normals, p1, p12, p10);
+        auto p10 = interpolate(p1, p0);
+        auto p12 = interpolate(p1, p2);
+        addTriangle(vertexCache, indexBuffer, positions, normals, gridVertex(p1), p12, p10);
     } else if (index == 3) {  // P0 AND P1 INSIDE
-        auto p02 = interpolate(p0, v0, p2, v2);
-        auto p12 = interpolate(p1, v1, p2, v2);
-        addTriangle(vertexTree, indexBuffer, positions, normals, p0, p1, p12);
-        addTriangle(vertexTree, indexBuffer, positions, normals, p0, p12, p02);
+        auto p02 = interpolate(p0, p2);
+        auto p12 = interpolate(p1, p2);
+        addTriangle(vertexCache, indexBuffer, positions, normals, gridVertex(p0), gridVertex(p1),
+                    p12);
+        addTriangle(vertexCache, indexBuffer, positions, normals, gridVertex(p0), p12, p02);
     } else if (index == 4) {  // ONLY P2 INSIDE
-        auto p20 = interpolate(p2, v2, p0, v0);
-        auto p21 = interpolate(p2, v2, p1, v1);
-        addTriangle(vertexTree, indexBuffer, positions, normals, p2, p20, p21);
+        auto p20 = interpolate(p2, p0);
+        auto p21 = interpolate(p2, p1);
+        addTriangle(vertexCache, indexBuffer, positions, normals, gridVertex(p2), p20, p21);
     } else if (index == 5) {  // P0 AND P2 INSIDE
-        auto p01 = interpolate(p0, v0, p1, v1);
-        auto p21 = interpolate(p2, v2, p1, v1);
-        addTriangle(vertexTree, indexBuffer, positions, normals, p0, p01, p21);
-        addTriangle(vertexTree, indexBuffer, positions, normals, p0, p21, p2);
+        auto p01 = interpolate(p0, p1);
+        auto p21 = interpolate(p2, p1);
+        addTriangle(vertexCache, indexBuffer, positions, normals, gridVertex(p0), p01, p21);
+        addTriangle(vertexCache, indexBuffer, positions, normals, gridVertex(p0), p21,
+                    gridVertex(p2));
     } else if (index == 6) {  // P1 AND P2 INSIDE
-        auto p10 = interpolate(p1, v1, p0, v0);
-        auto p20 = interpolate(p2, v2, p0, v0);
-        addTriangle(vertexTree, indexBuffer, positions, normals, p1, p20, p10);
-        addTriangle(vertexTree, indexBuffer, positions, normals, p1, p2, p20);
+        auto p10 = interpolate(p1, p0);
+        auto p20 = interpolate(p2, p0);
+        addTriangle(vertexCache, indexBuffer, positions, normals, gridVertex(p1), p20, p10);
+        addTriangle(vertexCache, indexBuffer, positions, normals, gridVertex(p1), gridVertex(p2),
+                    p20);
     } else if (index == 7) {  // FULLY INSIDE
-        addTriangle(vertexTree, indexBuffer, positions, normals, p0, p1, p2);
+        addTriangle(vertexCache, indexBuffer, positions, normals, gridVertex(p0), gridVertex(p1),
+                    gridVertex(p2));
     }
 }
 
-size_t addVertex(K3DTree<size_t, float>& vertexTree, std::vector<vec3>& positions,
-                 std::vector<vec3>& normals, const vec3 pos) {
-    auto nearest = vertexTree.findNearest(vec3(pos));
-    const auto nearestPos = [&]() {
-        return vec3{nearest->getPosition()[0], nearest->getPosition()[1],
-                    nearest->getPosition()[2]};
-    };
-    if (!nearest || (glm::distance2(nearestPos(), pos) > glm::epsilon<float>())) {
-        nearest = vertexTree.insert(pos, positions.size());
-        positions.push_back(pos);
-        normals.push_back(vec3(0, 0, 0));
-    }
-    return nearest->get();
-}
-
-void addTriangle(K3DTree<size_t, float>& vertexTree, IndexBufferRAM* indexBuffer,
-                 std::vector<vec3>& positions, std::vector<vec3>& normals, const glm::vec3& a,
-                 const glm::vec3& b, const glm::vec3& c) {
-    size_t i0 = addVertex(vertexTree, positions, normals, a);
-    size_t i1 = addVertex(vertexTree, positions, normals, b);
-    size_t i2 = addVertex(vertexTree, positions, normals, c);
-
-    if (i0 == i1 || i0 == i2 || i1 == i2) {
-        // triangle is so small so that the vertices are merged.
+void addTriangle(VertexCache& vertexCache, IndexBufferRAM* indexBuffer,
+                 std::vector<vec3>& positions, std::vector<vec3>& normals, const EdgeVertex& a,
+                 const EdgeVertex& b, const EdgeVertex& c) {
+    const vec3 n = glm::cross(b.pos - a.pos, c.pos - a.pos);
+    if (glm::length2(n) == 0.0f) {
+        // Degenerated triangle, e.g. two of the vertices snapped to the same grid point.
         return;
     }
 
+    size_t i0 = vertexCache.add(a, positions, normals);
+    size_t i1 = vertexCache.add(b, positions, normals);
+    size_t i2 = vertexCache.add(c, positions, normals);
+
     indexBuffer->add(static_cast<uint32_t>(i0));
     indexBuffer->add(static_cast<uint32_t>(i1));
     indexBuffer->add(static_cast<uint32_t>(i2));
 
-    vec3 e0 = b - a;
-    vec3 e1 = c - a;
-    vec3 n = glm::normalize(glm::cross(e0, e1));
-
-    normals[i0] += n;
-    normals[i1] += n;
-    normals[i2] += n;
+    const vec3 nn = glm::normalize(n);
+    normals[i0] += nn;
+    normals[i1] += nn;
+    normals[i2] += nn;
 }
 
 }  // namespace marching
@@ -91,11 +91,16 @@ std::shared_ptr<Volume> gradientVolume(std::shared_ptr<const Volume> volume, int
     auto func = [&](const size3_t& pos) {
         const vec3 world{m * vec4(vec3(pos) / vec3(volume->getDimensions() - size3_t(1)), 1)};
 
-        const auto g = static_cast<vec3>(
-            dvec3{(sampler.sample(world + ox) - sampler.sample(world - ox))[channel],
-                  (sampler.sample(world + oy) - sampler.sample(world - oy))[channel],
-                  (sampler.sample(world + oz) - sampler.sample(world - oz))[channel]} /
-            spacing2);
+        const std::array<dvec3, 6> positions{dvec3{world + ox}, dvec3{world - ox},
+                                             dvec3{world + oy}, dvec3{world - oy},
+                                             dvec3{world + oz}, dvec3{world - oz}};
+        std::array<dvec4, 6> samples;
+        sampler.sample(positions, samples);
+
+        const auto g = static_cast<vec3>(dvec3{(samples[0] - samples[1])[channel],
+                                               (samples[2] - samples[3])[channel],
+                                               (samples[4] - samples[5])[channel]} /
+                                         spacing2);
 
         data[index(pos)] = g;
         max = glm::max(max, glm::compMax(glm::abs(g)));
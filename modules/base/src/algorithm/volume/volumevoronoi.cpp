@@ -43,17 +43,24 @@
 
 #include <algorithm>    // for max_element, min_element
 #include <array>        // for array<>::value_type, array
+#include <cmath>        // for sqrt, floor, ceil, pow, acos, cos
 #include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
 #include <functional>   // for __base
+#include <limits>       // for numeric_limits
+#include <numeric>      // for partial_sum
 #include <string>       // for string
 #include <string_view>  // for string_view
 #include <type_traits>  // for remove_extent_t, integral_constant
+#include <vector>       // for vector
 
-#include <glm/geometric.hpp>  // for dot
-#include <glm/gtx/norm.hpp>   // for length2
-#include <glm/mat4x4.hpp>     // for operator*
-#include <glm/vec3.hpp>       // for operator-, operator*
-#include <glm/vec4.hpp>       // for operator*, operator+
+#include <glm/geometric.hpp>           // for dot
+#include <glm/gtc/constants.hpp>       // for pi
+#include <glm/gtx/component_wise.hpp>  // for compMax, compMin, compMul
+#include <glm/gtx/norm.hpp>            // for length2
+#include <glm/mat4x4.hpp>              // for operator*
+#include <glm/vec3.hpp>                // for operator-, operator*
+#include <glm/vec4.hpp>                // for operator*, operator+
 
 namespace inviwo {
 namespace util {
@@ -81,6 +88,263 @@ auto distance2(const vec3& a, const vec3& b, const mat3& dataToModelMatrix) {
     return glm::length2(dataToModelMatrix * delta);
 }
 
+/**
+ * Smallest eigenvalue of a symmetric 3x3 matrix, using the closed form for the roots of the
+ * characteristic polynomial.
+ */
+inline double smallestEigenvalue(const dmat3& m) {
+    const double p1 = m[0][1] * m[0][1] + m[0][2] * m[0][2] + m[1][2] * m[1][2];
+    if (p1 == 0.0) {
+        return std::min({m[0][0], m[1][1], m[2][2]});
+    }
+    const double q = (m[0][0] + m[1][1] + m[2][2]) / 3.0;
+    const double p2 = (m[0][0] - q) * (m[0][0] - q) + (m[1][1] - q) * (m[1][1] - q) +
+                      (m[2][2] - q) * (m[2][2] - q) + 2.0 * p1;
+    const double p = std::sqrt(p2 / 6.0);
+    const double r = glm::determinant((m - q * dmat3{1.0}) / p) / 2.0;
+    const double phi = std::acos(std::clamp(r, -1.0, 1.0)) / 3.0;
+    return q + 2.0 * p * std::cos(phi + 2.0 * glm::pi<double>() / 3.0);
+}
+
+/**
+ * A uniform grid of seed points used to find the seed point with the smallest power distance to a
+ * position while only visiting the seeds in nearby cells. The grid is laid out in data space
+ * scaled by the length of each basis vector, where the cell extents are roughly equal in model
+ * space. The cells are visited in shells of increasing Chebyshev distance around the cell of the
+ * position, and a cell is skipped when a lower bound of the distance to any seed in it is larger
+ * than the best distance found so far. For repeating axes the shells continue into the
+ * neighboring periods.
+ *
+ * The distances are evaluated with the same distance2 function as the brute force search and ties
+ * are broken by the order of the seed points, hence the result is identical to the brute force
+ * search.
+ */
+template <Wrapping X, Wrapping Y, Wrapping Z>
+class SeedGrid {
+public:
+    SeedGrid(const std::vector<std::pair<unsigned short, vec3>>& seedPointsWithIndices,
+             const std::vector<float>& weights, const mat3& d2m)
+        : d2m_{d2m} {
+
+        for (size_t a = 0; a < 3; ++a) {
+            scale_[a] = glm::length(dvec3{d2m[a]});
+        }
+
+        if (glm::compMin(scale_) <= 0.0) return;
+
+        // Distances in model space are bounded from below by the smallest singular value of the
+        // data to model matrix with normalized basis vectors times the distance in scaled space.
+        dmat3 normalized{d2m};
+        for (size_t a = 0; a < 3; ++a) normalized[a] /= scale_[a];
+        // Shrink it slightly to stay a lower bound despite round off
+        sigma2_ = 0.999 * smallestEigenvalue(glm::transpose(normalized) * normalized);
+        if (!(sigma2_ > 1e-8)) return;
+        valid_ = true;
+
+        const auto wrapped = [&](const vec3& p, size_t a) -> double {
+            return periodic[a] ? p[a] - std::floor(p[a]) : p[a];
+        };
+
+        for (size_t a = 0; a < 3; ++a) {
+            if (periodic[a]) {
+                lo_[a] = 0.0;
+                hi_[a] = 1.0;
+            } else {
+                lo_[a] = std::numeric_limits<double>::max();
+                hi_[a] = std::numeric_limits<double>::lowest();
+                for (const auto& item : seedPointsWithIndices) {
+                    lo_[a] = std::min(lo_[a], static_cast<double>(item.second[a]));
+                    hi_[a] = std::max(hi_[a], static_cast<double>(item.second[a]));
+                }
+            }
+            lo_[a] *= scale_[a];
+            hi_[a] *= scale_[a];
+        }
+
+        // Aim for a couple of seed points per cell
+        const auto extent = hi_ - lo_;
+        const double eps = 1e-6 * glm::compMax(extent);
+        double volume = 1.0;
+        int nonEmpty = 0;
+        for (size_t a = 0; a < 3; ++a) {
+            if (extent[a] > eps) {
+                volume *= extent[a];
+                ++nonEmpty;
+            }
+        }
+        const double cells = std::max(1.0, static_cast<double>(seedPointsWithIndices.size()) / 2.0);
+        const double size = nonEmpty > 0 ? std::pow(volume / cells, 1.0 / nonEmpty) : 1.0;
+        for (size_t a = 0; a < 3; ++a) {
+            dims_[a] = extent[a] > eps ? static_cast<int>(std::clamp(
+                                             std::ceil(extent[a] / size), 1.0, double{maxCells}))
+                                       : 1;
+            width_[a] = extent[a] / dims_[a];
+            if (periodic[a]) {
+                maxOffset_[a] = dims_[a] / 2 + 1;
+            } else {
+                maxOffset_[a] = dims_[a] - 1;
+            }
+        }
+        maxRing_ = glm::compMax(maxOffset_);
+
+        minWidth_ = std::numeric_limits<double>::max();
+        for (size_t a = 0; a < 3; ++a) {
+            if (maxOffset_[a] > 0) minWidth_ = std::min(minWidth_, width_[a]);
+        }
+
+        // Bin the seed points
+        const auto cellCount = static_cast<size_t>(glm::compMul(dims_));
+        std::vector<size_t> seedCell(seedPointsWithIndices.size());
+        cellStart_.assign(cellCount + 1, 0);
+        for (size_t i = 0; i < seedPointsWithIndices.size(); ++i) {
+            const auto& p = seedPointsWithIndices[i].second;
+            ivec3 cell;
+            for (size_t a = 0; a < 3; ++a) {
+                cell[a] = cellIndex(wrapped(p, a) * scale_[a], a);
+            }
+            seedCell[i] = linear(cell);
+            ++cellStart_[seedCell[i] + 1];
+        }
+        std::partial_sum(cellStart_.begin(), cellStart_.end(), cellStart_.begin());
+
+        seeds_.resize(seedPointsWithIndices.size());
+        cellMaxWeight2_.assign(cellCount, 0.0f);
+        maxWeight2_ = 0.0f;
+        auto next = cellStart_;
+        for (size_t i = 0; i < seedPointsWithIndices.size(); ++i) {
+            const float weight2 = weights.empty() ? 0.0f : weights[i] * weights[i];
+            seeds_[next[seedCell[i]]++] = Seed{seedPointsWithIndices[i].second, weight2,
+                                               seedPointsWithIndices[i].first,
+                                               static_cast<uint32_t>(i)};
+            cellMaxWeight2_[seedCell[i]] = std::max(cellMaxWeight2_[seedCell[i]], weight2);
+            maxWeight2_ = std::max(maxWeight2_, weight2);
+        }
+    }
+
+    /**
+     * False if the data to model matrix is degenerate, then the grid can not be used.
+     */
+    bool valid() const { return valid_; }
+
+    /**
+     * The seed point with the smallest power distance to pos, given in data space.
+     */
+    unsigned short closest(const vec3& pos) const {
+        dvec3 p;
+        ivec3 center;
+        for (size_t a = 0; a < 3; ++a) {
+            const double wrapped = periodic[a] ? pos[a] - std::floor(pos[a]) : pos[a];
+            p[a] = wrapped * scale_[a];
+            center[a] = cellIndex(p[a], a);
+        }
+
+        float best = std::numeric_limits<float>::max();
+        uint32_t bestOrder = std::numeric_limits<uint32_t>::max();
+        unsigned short bestIndex = 0;
+
+        // Guard against round off, the lower bounds are computed in double precision while the
+        // distances are evaluated in single precision.
+        const auto prune = [&](double bound) {
+            return bound - 1e-4 * (std::abs(static_cast<double>(best)) + maxWeight2_) > best;
+        };
+
+        const auto visit = [&](const ivec3& offset) {
+            double boxDist2 = 0.0;
+            ivec3 cell;
+            for (size_t a = 0; a < 3; ++a) {
+                const int unwrapped = center[a] + offset[a];
+                if (periodic[a]) {
+                    cell[a] = ((unwrapped % dims_[a]) + dims_[a]) % dims_[a];
+                } else if (unwrapped < 0 || unwrapped >= dims_[a]) {
+                    return;
+                } else {
+                    cell[a] = unwrapped;
+                }
+                const double boxLo = lo_[a] + unwrapped * width_[a];
+                const double boxHi = boxLo + width_[a];
+                const double d = std::max({boxLo - p[a], p[a] - boxHi, 0.0});
+                boxDist2 += d * d;
+            }
+            const auto index = linear(cell);
+            if (prune(sigma2_ * boxDist2 - cellMaxWeight2_[index])) return;
+
+            for (size_t i = cellStart_[index]; i < cellStart_[index + 1]; ++i) {
+                const auto& seed = seeds_[i];
+                const float dist = distance2<X, Y, Z>(seed.pos, pos, d2m_) - seed.weight2;
+                if (dist < best || (dist == best && seed.order < bestOrder)) {
+                    best = dist;
+                    bestOrder = seed.order;
+                    bestIndex = seed.index;
+                }
+            }
+        };
+
+        visit(ivec3{0});
+        for (int ring = 1; ring <= maxRing_; ++ring) {
+            const double gap = (ring - 1) * minWidth_;
+            if (prune(sigma2_ * gap * gap - maxWeight2_)) break;
+
+            const auto range = glm::min(ivec3{ring}, maxOffset_);
+            ivec3 offset;
+            for (offset.z = -range.z; offset.z <= range.z; ++offset.z) {
+                for (offset.y = -range.y; offset.y <= range.y; ++offset.y) {
+                    if (std::abs(offset.z) == ring || std::abs(offset.y) == ring) {
+                        for (offset.x = -range.x; offset.x <= range.x; ++offset.x) {
+                            visit(offset);
+                        }
+                    } else if (range.x == ring) {
+                        visit(ivec3{-ring, offset.y, offset.z});
+                        visit(ivec3{ring, offset.y, offset.z});
+                    }
+                }
+            }
+        }
+
+        return bestIndex;
+    }
+
+private:
+    static constexpr std::array<bool, 3> periodic{X == Wrapping::Repeat, Y == Wrapping::Repeat,
+                                                  Z == Wrapping::Repeat};
+    static constexpr int maxCells = 256;
+
+    struct Seed {
+        vec3 pos;
+        float weight2;
+        unsigned short index;
+        uint32_t order;
+    };
+
+    int cellIndex(double p, size_t a) const {
+        if (width_[a] <= 0.0) return 0;
+        return std::clamp(static_cast<int>(std::floor((p - lo_[a]) / width_[a])), 0,
+                          dims_[a] - 1);
+    }
+    size_t linear(const ivec3& cell) const {
+        return static_cast<size_t>(cell.x) +
+               static_cast<size_t>(dims_.x) *
+                   (static_cast<size_t>(cell.y) +
+                    static_cast<size_t>(dims_.y) * static_cast<size_t>(cell.z));
+    }
+
+    mat3 d2m_;
+    bool valid_ = false;
+    dvec3 scale_{1.0};
+    double sigma2_ = 0.0;
+    dvec3 lo_{0.0};
+    dvec3 hi_{0.0};
+    ivec3 dims_{1};
+    dvec3 width_{0.0};
+    ivec3 maxOffset_{0};
+    int maxRing_ = 0;
+    double minWidth_ = 0.0;
+    float maxWeight2_ = 0.0f;
+
+    std::vector<size_t> cellStart_;
+    std::vector<Seed> seeds_;
+    std::vector<float> cellMaxWeight2_;
+};
+
 template <typename Index, typename Functor, Index... Is>
 constexpr auto build_array_impl(Functor&& func, std::integer_sequence<Index, Is...>) noexcept {
     return std::array{func(std::integral_constant<Index, Is>{})...};
@@ -145,10 +409,45 @@ void weightedVoronoiSegmentationImpl(
     });
 }
 
+template <Wrapping X, Wrapping Y, Wrapping Z>
+void voronoiSegmentationSearch(
+    const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
+    const std::vector<std::pair<unsigned short, vec3>>& seedPointsWithIndices,
+    const std::vector<float>& weights, VoronoiSearch search,
+    VolumeRAMPrecision<unsigned short>& voronoiVolumeRep) {
+
+    // Visiting a handful of seed points is cheaper than building the grid
+    constexpr size_t minGridSeeds = 16;
+
+    if (search == VoronoiSearch::Grid && seedPointsWithIndices.size() > minGridSeeds) {
+        // We can ignore any translations
+        const detail::SeedGrid<X, Y, Z> grid(seedPointsWithIndices, weights,
+                                             mat3{dataToModelMatrix});
+        if (grid.valid()) {
+            auto volumeIndices = voronoiVolumeRep.getDataTyped();
+            util::IndexMapper3D index(volumeDimensions);
+            util::forEachVoxelParallel(volumeDimensions, [&](const size3_t& voxelPos) {
+                const auto dataVoxelPos = vec3{indexToDataMatrix * vec4{voxelPos, 1.0f}};
+                volumeIndices[index(voxelPos)] = grid.closest(dataVoxelPos);
+            });
+            return;
+        }
+    }
+
+    if (weights.empty()) {
+        voronoiSegmentationImpl<X, Y, Z>(volumeDimensions, indexToDataMatrix, dataToModelMatrix,
+                                         seedPointsWithIndices, voronoiVolumeRep);
+    } else {
+        weightedVoronoiSegmentationImpl<X, Y, Z>(volumeDimensions, indexToDataMatrix,
+                                                 dataToModelMatrix, seedPointsWithIndices, weights,
+                                                 voronoiVolumeRep);
+    }
+}
+
 std::shared_ptr<Volume> voronoiSegmentation(
     const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
     const std::vector<std::pair<uint32_t, vec3>>& seedPointsWithIndices, const Wrapping3D& wrapping,
-    const std::optional<std::vector<float>>& weights) {
+    const std::optional<std::vector<float>>& weights, VoronoiSearch search) {
 
     if (seedPointsWithIndices.size() == 0) {
         throw Exception("No seed points, cannot create volume voronoi segmentation",
@@ -199,63 +498,36 @@ std::shared_ptr<Volume> voronoiSegmentation(
                            vec3{modelToDataMatrix * vec4{pair.second, 1.0f}}};
                    });
 
-    if (weights.has_value()) {
-        using Functor = void (*)(const size3_t, const mat4&, const mat4&,
-                                 const std::vector<std::pair<unsigned short, vec3>>&,
-                                 const std::vector<float>&, VolumeRAMPrecision<unsigned short>&);
-
-        constexpr auto table = detail::build_array<3>([&](auto x) constexpr {
-            return detail::build_array<3>([&](auto y) constexpr {
-                return detail::build_array<3>([&](auto z) constexpr -> Functor {
-                    return [](const size3_t dim, const mat4& i2d, const mat4& d2m,
-                              const std::vector<std::pair<unsigned short, vec3>>& sp,
-                              const std::vector<float>& w,
-                              VolumeRAMPrecision<unsigned short>& volRep) {
-                        using XT = decltype(x);
-                        using YT = decltype(y);
-                        using ZT = decltype(z);
-                        constexpr auto X = static_cast<Wrapping>(XT::value);
-                        constexpr auto Y = static_cast<Wrapping>(YT::value);
-                        constexpr auto Z = static_cast<Wrapping>(ZT::value);
-                        weightedVoronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp, w, volRep);
-                    };
-                });
-            });
-        });
-
-        table[static_cast<size_t>(wrapping[0])][static_cast<size_t>(wrapping[1])]
-             [static_cast<size_t>(wrapping[2])](volumeDimensions, indexToDataMatrix,
-                                                dataToModelMatrix, dataSeedPointsWithIndices,
-                                                *weights, *voronoiVolumeRep);
-
-    } else {
-        using Functor = void (*)(const size3_t, const mat4&, const mat4&,
-                                 const std::vector<std::pair<unsigned short, vec3>>&,
-                                 VolumeRAMPrecision<unsigned short>&);
-
-        constexpr auto table = detail::build_array<3>([&](auto x) constexpr {
-            return detail::build_array<3>([&](auto y) constexpr {
-                return detail::build_array<3>([&](auto z) constexpr -> Functor {
-                    return [](const size3_t dim, const mat4& i2d, const mat4& d2m,
-                              const std::vector<std::pair<unsigned short, vec3>>& sp,
-                              VolumeRAMPrecision<unsigned short>& volRep) {
-                        using XT = decltype(x);
-                        using YT = decltype(y);
-                        using ZT = decltype(z);
-                        constexpr auto X = static_cast<Wrapping>(XT::value);
-                        constexpr auto Y = static_cast<Wrapping>(YT::value);
-                        constexpr auto Z = static_cast<Wrapping>(ZT::value);
-                        voronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp, volRep);
-                    };
-                });
+    using Functor = void (*)(const size3_t, const mat4&, const mat4&,
+                             const std::vector<std::pair<unsigned short, vec3>>&,
+                             const std::vector<float>&, VoronoiSearch,
+                             VolumeRAMPrecision<unsigned short>&);
+
+    constexpr auto table = detail::build_array<3>([&](auto x) constexpr {
+        return detail::build_array<3>([&](auto y) constexpr {
+            return detail::build_array<3>([&](auto z) constexpr -> Functor {
+                return [](const size3_t dim, const mat4& i2d, const mat4& d2m,
+                          const std::vector<std::pair<unsigned short, vec3>>& sp,
+                          const std::vector<float>& w, VoronoiSearch search,
+                          VolumeRAMPrecision<unsigned short>& volRep) {
+                    using XT = decltype(x);
+                    using YT = decltype(y);
+                    using ZT = decltype(z);
+                    constexpr auto X = static_cast<Wrapping>(XT::value);
+                    constexpr auto Y = static_cast<Wrapping>(YT::value);
+                    constexpr auto Z = static_cast<Wrapping>(ZT::value);
+                    voronoiSegmentationSearch<X, Y, Z>(dim, i2d, d2m, sp, w, search, volRep);
+                };
             });
         });
+    });
 
-        table[static_cast<size_t>(wrapping[0])][static_cast<size_t>(wrapping[1])]
-             [static_cast<size_t>(wrapping[2])](volumeDimensions, indexToDataMatrix,
-                                                dataToModelMatrix, dataSeedPointsWithIndices,
-                                                *voronoiVolumeRep);
-    }
+    static const std::vector<float> noWeights{};
+    table[static_cast<size_t>(wrapping[0])][static_cast<size_t>(wrapping[1])]
+         [static_cast<size_t>(wrapping[2])](volumeDimensions, indexToDataMatrix, dataToModelMatrix,
+                                            dataSeedPointsWithIndices,
+                                            weights ? *weights : noWeights, search,
+                                            *voronoiVolumeRep);
 
     return voronoiVolume;
 }
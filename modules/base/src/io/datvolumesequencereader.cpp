@@ -77,7 +77,10 @@
 namespace inviwo {
 
 DatVolumeSequenceReader::DatVolumeSequenceReader()
-    : DataReaderType<VolumeSequence>(), enableLogOutput_(true) {
+    : DataReaderType<VolumeSequence>()
+    , enableLogOutput_(true)
+    , memoryMap_(false)
+    , bricked_(false) {
     addExtension(FileExtension("dat", "Inviwo dat file format"));
 }
 
@@ -89,6 +92,26 @@ DatVolumeSequenceReader* DatVolumeSequenceReader::clone() const {
     return new DatVolumeSequenceReader(*this);
 }
 
+bool DatVolumeSequenceReader::setOption(std::string_view key, std::any value) {
+    if (auto* memoryMap = std::any_cast<bool>(&value); memoryMap && key == "MemoryMap") {
+        memoryMap_ = *memoryMap;
+        return true;
+    } else if (auto* bricked = std::any_cast<bool>(&value); bricked && key == "Bricked") {
+        bricked_ = *bricked;
+        return true;
+    }
+    return false;
+}
+
+std::any DatVolumeSequenceReader::getOption(std::string_view key) {
+    if (key == "MemoryMap") {
+        return memoryMap_;
+    } else if (key == "Bricked") {
+        return bricked_;
+    }
+    return std::any{};
+}
+
 std::shared_ptr<VolumeSequence> DatVolumeSequenceReader::readData(
     const std::filesystem::path& filePath) {
 
@@ -311,6 +334,8 @@ std::shared_ptr<VolumeSequence> DatVolumeSequenceReader::readData(
         for (size_t t = 0; t < state.datFiles.size(); ++t) {
             auto datVolReader = std::make_unique<DatVolumeSequenceReader>();
             datVolReader->enableLogOutput_ = false;
+            datVolReader->memoryMap_ = memoryMap_;
+            datVolReader->bricked_ = bricked_;
             auto path = state.datFiles[t].is_absolute() ? state.datFiles[t]
                                                         : fileDirectory / state.datFiles[t];
             auto v = datVolReader->readData(path);
@@ -407,8 +432,11 @@ std::shared_ptr<VolumeSequence> DatVolumeSequenceReader::readData(
                                                          state.wrapping);
             const auto filePos = t * bytes + state.byteOffset;
 
-            auto loader = std::make_unique<RawVolumeRAMLoader>(fileDirectory / state.rawFile,
-                                                               filePos, state.littleEndian);
+            auto loader = std::make_unique<RawVolumeRAMLoader>(
+                fileDirectory / state.rawFile, filePos, state.littleEndian, memoryMap_);
+            if (bricked_) {
+                volumes->back()->addRepresentation(loader->createBricked(*diskRepr));
+            }
             diskRepr->setLoader(loader.release());
             volumes->back()->addRepresentation(diskRepr);
             // Compute data range if not specified
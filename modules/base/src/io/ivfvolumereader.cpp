@@ -63,6 +63,26 @@ IvfVolumeReader::IvfVolumeReader() : DataReaderType<Volume>() {
 
 IvfVolumeReader* IvfVolumeReader::clone() const { return new IvfVolumeReader(*this); }
 
+bool IvfVolumeReader::setOption(std::string_view key, std::any value) {
+    if (auto* memoryMap = std::any_cast<bool>(&value); memoryMap && key == "MemoryMap") {
+        memoryMap_ = *memoryMap;
+        return true;
+    } else if (auto* bricked = std::any_cast<bool>(&value); bricked && key == "Bricked") {
+        bricked_ = *bricked;
+        return true;
+    }
+    return false;
+}
+
+std::any IvfVolumeReader::getOption(std::string_view key) {
+    if (key == "MemoryMap") {
+        return memoryMap_;
+    } else if (key == "Bricked") {
+        return bricked_;
+    }
+    return std::any{};
+}
+
 std::shared_ptr<Volume> IvfVolumeReader::readData(const std::filesystem::path& filePath) {
     checkExists(filePath);
     const auto fileDirectory = filePath.parent_path();
@@ -138,7 +158,11 @@ std::shared_ptr<Volume> IvfVolumeReader::readData(const std::filesystem::path& f
     auto vd = std::make_shared<VolumeDisk>(filePath, dimensions, format, swizzleMask, interpolation,
                                            wrapping);
 
-    auto loader = std::make_unique<RawVolumeRAMLoader>(rawFile, byteOffset, littleEndian);
+    auto loader =
+        std::make_unique<RawVolumeRAMLoader>(rawFile, byteOffset, littleEndian, memoryMap_);
+    if (bricked_) {
+        volume->addRepresentation(loader->createBricked(*vd));
+    }
     vd->setLoader(loader.release());
 
     volume->addRepresentation(vd);
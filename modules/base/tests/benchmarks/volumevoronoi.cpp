@@ -0,0 +1,108 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#ifdef _MSC_VER
+#pragma comment(linker, "/SUBSYSTEM:CONSOLE")
+#endif
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <modules/base/algorithm/volume/volumevoronoi.h>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+using namespace inviwo;
+
+namespace {
+
+std::vector<std::pair<uint32_t, vec3>> randomSeedPoints(size_t count) {
+    std::mt19937 rand(0);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    std::vector<std::pair<uint32_t, vec3>> seedPoints;
+    seedPoints.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        seedPoints.emplace_back(static_cast<uint32_t>(i % 65536),
+                                vec3{dist(rand), dist(rand), dist(rand)});
+    }
+    return seedPoints;
+}
+
+void voronoi(benchmark::State& state, util::VoronoiSearch search, Wrapping3D wrapping) {
+    const size3_t dim{static_cast<size_t>(state.range(0))};
+    const auto seedPoints = randomSeedPoints(static_cast<size_t>(state.range(1)));
+    const auto indexToData = glm::scale(glm::translate(mat4{1.0f}, vec3{0.5f} / vec3{dim}),
+                                        vec3{1.0f} / vec3{dim});
+    const mat4 dataToModel{1.0f};
+
+    for (auto _ : state) {
+        auto volume = util::voronoiSegmentation(dim, indexToData, dataToModel, seedPoints,
+                                                wrapping, std::nullopt, search);
+        benchmark::DoNotOptimize(volume);
+    }
+    state.counters["Voxels"] = static_cast<double>(dim.x * dim.y * dim.z);
+    state.counters["VoxelRate"] = benchmark::Counter(static_cast<double>(dim.x * dim.y * dim.z),
+                                                     benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace
+
+static void BruteForce(benchmark::State& state) {
+    voronoi(state, util::VoronoiSearch::BruteForce, wrapping3d::clampAll);
+}
+static void Grid(benchmark::State& state) {
+    voronoi(state, util::VoronoiSearch::Grid, wrapping3d::clampAll);
+}
+static void GridRepeat(benchmark::State& state) {
+    voronoi(state, util::VoronoiSearch::Grid, wrapping3d::repeatAll);
+}
+
+// First argument is the volume size, the second the number of seed points
+BENCHMARK(BruteForce)->ArgsProduct({{32, 64}, {100, 1000, 10000}})->Unit(benchmark::kMillisecond);
+BENCHMARK(Grid)
+    ->ArgsProduct({{32, 64, 128, 256}, {100, 1000, 10000, 50000}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(GridRepeat)
+    ->ArgsProduct({{64, 128}, {1000, 10000}})
+    ->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv) {
+    // The application provides the thread pool used by voronoiSegmentation
+    InviwoApplication app("bm-volumevoronoi");
+
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -32,7 +32,9 @@
 #include <gtest/gtest.h>
 #include <warn/pop>
 
+#include <algorithm>
 #include <cmath>
+#include <map>
 
 #include <inviwo/core/datastructures/geometry/mesh.h>
 #include <inviwo/core/datastructures/volume/volume.h>
@@ -40,6 +42,7 @@
 
 #include <modules/base/algorithm/volume/marchingcubes.h>
 #include <modules/base/algorithm/volume/marchingcubesopt.h>
+#include <modules/base/algorithm/volume/marchingtetrahedron.h>
 
 #include <glm/gtx/normal.hpp>
 
@@ -68,6 +71,28 @@ std::vector<uint32_t>& getBufferIndexData(Mesh& mesh, size_t ind) {
                     IVW_CONTEXT_CUSTOM("getBufferIndexData"));
 }
 
+// True if all vertices are unique and every edge is shared by exactly two triangles
+bool isClosedAndWelded(const std::vector<vec3>& pos, const std::vector<uint32_t>& ind) {
+    auto order = [](auto& a, auto& b) {
+        return std::lexicographical_compare(glm::value_ptr(a), glm::value_ptr(a) + 3,
+                                            glm::value_ptr(b), glm::value_ptr(b) + 3);
+    };
+    std::vector<vec3> spos(pos);
+    std::sort(spos.begin(), spos.end(), order);
+    if (std::adjacent_find(spos.begin(), spos.end()) != spos.end()) return false;
+
+    std::map<std::pair<uint32_t, uint32_t>, int> edges;
+    for (size_t i = 0; i + 2 < ind.size(); i += 3) {
+        for (size_t j = 0; j < 3; ++j) {
+            const auto a = ind[i + j];
+            const auto b = ind[i + (j + 1) % 3];
+            ++edges[{std::min(a, b), std::max(a, b)}];
+        }
+    }
+    return std::all_of(edges.begin(), edges.end(),
+                       [](const auto& item) { return item.second == 2; });
+}
+
 TEST(Marchingcubes, empty) {
     auto vol = std::shared_ptr<Volume>(
         util::generateVolume(size3_t{2}, mat3(1.0f), [&](const size3_t&) { return 0.0f; }));
@@ -337,4 +362,35 @@ TEST(Marchingcubes, sphere) {
     */
 }
 
+TEST(Marchingcubes, slabs) {
+    // Large enough to be split into two slabs along z, with the sphere crossing the slab boundary
+    auto vol = std::shared_ptr<Volume>(util::makeSphericalVolume(size3_t{80}));
+    auto mesh = util::marchingCubesOpt(vol, 0.5, {1.0f, 0.0f, 0.0f, 1.0f}, false, false);
+    auto& pos = getBufferData<vec3>(*mesh, 0);
+    auto& ind = getBufferIndexData(*mesh, 0);
+    ASSERT_FALSE(pos.empty());
+    ASSERT_EQ(ind.size() % 3, 0);
+
+    // All vertices on the shared slab face should have been welded, and the surface is closed
+    EXPECT_TRUE(isClosedAndWelded(pos, ind));
+}
+
+TEST(Marchingcubes, welding) {
+    auto vol = std::shared_ptr<Volume>(util::makeSphericalVolume(size3_t{20}));
+    {
+        auto mesh = util::marchingcubes(vol, 0.5, {1.0f, 0.0f, 0.0f, 1.0f}, false, false);
+        auto& pos = getBufferData<vec3>(*mesh, 0);
+        auto& ind = getBufferIndexData(*mesh, 0);
+        ASSERT_FALSE(pos.empty());
+        EXPECT_TRUE(isClosedAndWelded(pos, ind));
+    }
+    {
+        auto mesh = util::marchingtetrahedron(vol, 0.5, {1.0f, 0.0f, 0.0f, 1.0f}, false, false);
+        auto& pos = getBufferData<vec3>(*mesh, 0);
+        auto& ind = getBufferIndexData(*mesh, 0);
+        ASSERT_FALSE(pos.empty());
+        EXPECT_TRUE(isClosedAndWelded(pos, ind));
+    }
+}
+
 }  // namespace inviwo
@@ -37,6 +37,13 @@
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/util/indexmapper.h>
 
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/component_wise.hpp>
+
 namespace inviwo {
 
 constexpr auto clamp3D = Wrapping3D{Wrapping::Clamp, Wrapping::Clamp, Wrapping::Clamp};
@@ -246,4 +253,52 @@ TEST(VolumeVoronoi, Voronoi_ThreeSeedPoints_PartitionsVolumeInThree) {
     }
 }
 
+TEST(VolumeVoronoi, GridSearch_RandomSeedPoints_MatchesBruteForce) {
+    std::mt19937 rand(0);
+    std::uniform_real_distribution<float> pos(-1.2f, 1.2f);
+    std::uniform_real_distribution<float> weight(0.0f, 0.3f);
+
+    std::vector<std::pair<uint32_t, vec3>> seedPoints;
+    std::vector<float> weights;
+    for (uint32_t i = 0; i < 500; ++i) {
+        seedPoints.emplace_back(i % 200, vec3{pos(rand), pos(rand), pos(rand)});
+        weights.push_back(weight(rand));
+    }
+
+    const size3_t dim{13, 16, 11};
+    const auto indexToData = glm::scale(glm::translate(mat4{1.0f}, vec3{0.5f} / vec3{dim}),
+                                        vec3{1.0f} / vec3{dim});
+    // A skewed basis with the origin in the center of the volume
+    const mat4 dataToModel{vec4{2.0f, 0.0f, 0.0f, 0.0f}, vec4{0.5f, 1.5f, 0.0f, 0.0f},
+                           vec4{0.0f, 0.3f, 3.0f, 0.0f}, vec4{-1.25f, -0.9f, -1.5f, 1.0f}};
+
+    const auto getData = [&](const Volume& volume) {
+        const auto* ram = dynamic_cast<const VolumeRAMPrecision<unsigned short>*>(
+            volume.getRepresentation<VolumeRAM>());
+        EXPECT_TRUE(ram != nullptr);
+        return std::vector<unsigned short>(ram->getDataTyped(),
+                                           ram->getDataTyped() + glm::compMul(dim));
+    };
+
+    for (auto x : {Wrapping::Clamp, Wrapping::Repeat}) {
+        for (auto y : {Wrapping::Clamp, Wrapping::Repeat}) {
+            for (auto z : {Wrapping::Clamp, Wrapping::Repeat}) {
+                for (const auto& w : {std::optional<std::vector<float>>{},
+                                      std::optional<std::vector<float>>{weights}}) {
+                    const Wrapping3D wrapping{x, y, z};
+                    const auto grid =
+                        util::voronoiSegmentation(dim, indexToData, dataToModel, seedPoints,
+                                                  wrapping, w, util::VoronoiSearch::Grid);
+                    const auto bruteForce =
+                        util::voronoiSegmentation(dim, indexToData, dataToModel, seedPoints,
+                                                  wrapping, w, util::VoronoiSearch::BruteForce);
+
+                    EXPECT_EQ(getData(*grid), getData(*bruteForce))
+                        << "wrapping " << wrapping << (w ? " weighted" : "");
+                }
+            }
+        }
+    }
+}
+
 }  // namespace inviwo
@@ -4,3 +4,4 @@
 set(dependencies
 )
 set(EnableByDefault ON)
+set(threadSafe ON)
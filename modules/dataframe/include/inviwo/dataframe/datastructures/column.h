@@ -31,6 +31,8 @@
 
 #include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFR...
 
+#include <inviwo/dataframe/datastructures/columnbuffer.h>  // for ColumnBuffer
+
 #include <inviwo/core/datastructures/buffer/buffer.h>                   // for Buffer, makeBuffer
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>       // for BufferRAMPrecision
 #include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
@@ -93,6 +95,13 @@ public:
 
     virtual Column* clone() const = 0;
     virtual Column* clone(const std::vector<std::uint32_t>& rowSelection) const = 0;
+    /**
+     * Create a column holding the rows in @p rowSelection, which are only copied once the buffer
+     * of the column is requested. The selection can be shared between several columns.
+     * @see ColumnBuffer
+     */
+    virtual Column* clone(
+        std::shared_ptr<const std::vector<std::uint32_t>> rowSelection) const = 0;
 
     virtual ColumnType getColumnType() const = 0;
 
@@ -166,6 +175,8 @@ public:
 
     TemplateColumn(const TemplateColumn<T>& rhs);
     TemplateColumn(const TemplateColumn<T>& rhs, const std::vector<std::uint32_t>& rowSelection);
+    TemplateColumn(const TemplateColumn<T>& rhs,
+                   std::shared_ptr<const std::vector<std::uint32_t>> rowSelection);
     TemplateColumn(TemplateColumn<T>&& rhs);
 
     TemplateColumn<T>& operator=(const TemplateColumn<T>& rhs);
@@ -173,6 +184,8 @@ public:
 
     virtual TemplateColumn* clone() const override;
     virtual TemplateColumn* clone(const std::vector<std::uint32_t>& rowSelection) const override;
+    virtual TemplateColumn* clone(
+        std::shared_ptr<const std::vector<std::uint32_t>> rowSelection) const override;
 
     virtual ~TemplateColumn() = default;
 
@@ -232,7 +245,7 @@ protected:
     std::string header_;
     Unit unit_;
     std::optional<dvec2> range_;
-    std::shared_ptr<Buffer<T>> buffer_;
+    ColumnBuffer<T> buffer_;
 };
 
 class IVW_MODULE_DATAFRAME_API IndexColumn : public TemplateColumn<std::uint32_t> {
@@ -242,12 +255,16 @@ public:
     IndexColumn(std::string_view header, std::vector<std::uint32_t> data);
     IndexColumn(const IndexColumn& rhs) = default;
     IndexColumn(const IndexColumn& rhs, const std::vector<std::uint32_t>& rowSelection);
+    IndexColumn(const IndexColumn& rhs,
+                std::shared_ptr<const std::vector<std::uint32_t>> rowSelection);
     IndexColumn(IndexColumn&& rhs) = default;
     IndexColumn& operator=(const IndexColumn& rhs) = default;
     IndexColumn& operator=(IndexColumn&& rhs) = default;
 
     virtual IndexColumn* clone() const override;
     virtual IndexColumn* clone(const std::vector<std::uint32_t>& rowSelection) const override;
+    virtual IndexColumn* clone(
+        std::shared_ptr<const std::vector<std::uint32_t>> rowSelection) const override;
 
     virtual ~IndexColumn() = default;
 
@@ -290,12 +307,16 @@ public:
 
     CategoricalColumn(const CategoricalColumn& rhs);
     CategoricalColumn(const CategoricalColumn& rhs, const std::vector<std::uint32_t>& rowSelection);
+    CategoricalColumn(const CategoricalColumn& rhs,
+                      std::shared_ptr<const std::vector<std::uint32_t>> rowSelection);
     CategoricalColumn(CategoricalColumn&& rhs) = default;
     CategoricalColumn& operator=(const CategoricalColumn& rhs);
     CategoricalColumn& operator=(CategoricalColumn&& rhs);
 
     virtual CategoricalColumn* clone() const override;
     virtual CategoricalColumn* clone(const std::vector<std::uint32_t>& rowSelection) const override;
+    virtual CategoricalColumn* clone(
+        std::shared_ptr<const std::vector<std::uint32_t>> rowSelection) const override;
 
     virtual ~CategoricalColumn() = default;
 
@@ -463,7 +484,7 @@ private:
     std::string header_;
     Unit unit_;
     std::optional<dvec2> range_;
-    std::shared_ptr<Buffer<std::uint32_t>> buffer_;
+    ColumnBuffer<std::uint32_t> buffer_;
     std::vector<std::string> lookUpTable_;
     std::map<std::string, std::uint32_t, std::less<>> lookupMap_;
 };
@@ -490,7 +511,7 @@ TemplateColumn<T>::TemplateColumn(const TemplateColumn& rhs)
     : header_(rhs.getHeader())
     , unit_(rhs.unit_)
     , range_(rhs.range_)
-    , buffer_(std::shared_ptr<Buffer<T>>(rhs.buffer_->clone())) {}
+    , buffer_(rhs.buffer_) {}
 
 template <typename T>
 TemplateColumn<T>::TemplateColumn(TemplateColumn<T>&& rhs)
@@ -505,14 +526,15 @@ TemplateColumn<T>::TemplateColumn(const TemplateColumn& rhs,
     : header_(rhs.getHeader())
     , unit_(rhs.unit_)
     , range_(rhs.range_)
-    , buffer_(std::make_shared<Buffer<T>>(rowSelection.size())) {
+    , buffer_(rhs.buffer_, rowSelection) {}
 
-    const auto& src = rhs.getTypedBuffer()->getRAMRepresentation()->getDataContainer();
-    auto& dst = buffer_->getEditableRAMRepresentation()->getDataContainer();
-    for (size_t i = 0; i < rowSelection.size(); ++i) {
-        dst[i] = src[rowSelection[i]];
-    }
-}
+template <typename T>
+TemplateColumn<T>::TemplateColumn(const TemplateColumn& rhs,
+                                  std::shared_ptr<const std::vector<std::uint32_t>> rowSelection)
+    : header_(rhs.getHeader())
+    , unit_(rhs.unit_)
+    , range_(rhs.range_)
+    , buffer_(rhs.buffer_, std::move(rowSelection)) {}
 
 template <typename T>
 TemplateColumn<T>& TemplateColumn<T>::operator=(const TemplateColumn<T>& rhs) {
@@ -520,7 +542,7 @@ TemplateColumn<T>& TemplateColumn<T>::operator=(const TemplateColumn<T>& rhs) {
         header_ = rhs.getHeader();
         unit_ = rhs.unit_;
         range_ = rhs.range_;
-        buffer_ = std::shared_ptr<Buffer<T>>(rhs.buffer_->clone());
+        buffer_ = rhs.buffer_;
     }
     return *this;
 }
@@ -546,6 +568,12 @@ TemplateColumn<T>* TemplateColumn<T>::clone(const std::vector<std::uint32_t>& ro
     return new TemplateColumn(*this, rowSelection);
 }
 
+template <typename T>
+TemplateColumn<T>* TemplateColumn<T>::clone(
+    std::shared_ptr<const std::vector<std::uint32_t>> rowSelection) const {
+    return new TemplateColumn(*this, std::move(rowSelection));
+}
+
 template <typename T>
 ColumnType TemplateColumn<T>::getColumnType() const {
     return ColumnType::Ordinal;
@@ -583,7 +611,8 @@ std::optional<dvec2> TemplateColumn<T>::getCustomRange() const {
 
 template <typename T>
 dvec2 TemplateColumn<T>::getDataRange() const {
-    const auto [min, max] = util::bufferMinMax(buffer_.get(), IgnoreSpecialValues::Yes);
+    const auto [min, max] =
+        util::bufferMinMax(buffer_.buffer().get(), IgnoreSpecialValues::Yes);
     return {*std::min_element(glm::value_ptr(min), glm::value_ptr(min) + util::extent_v<T>),
             *std::max_element(glm::value_ptr(max), glm::value_ptr(max) + util::extent_v<T>)};
 }
@@ -645,7 +674,7 @@ void add(Buffer<T>* /*buffer*/, std::string_view value) {
 
 template <typename T>
 void TemplateColumn<T>::add(std::string_view value) {
-    detail::add<T>(buffer_.get(), value);
+    detail::add<T>(buffer_.buffer().get(), value);
 }
 
 template <typename T>
@@ -665,14 +694,12 @@ void TemplateColumn<T>::set(size_t idx, const T& value) {
 
 template <typename T>
 T TemplateColumn<T>::get(size_t idx) const {
-    auto val = buffer_->getRAMRepresentation()->getDataContainer()[idx];
-    return val;
+    return buffer_[idx];
 }
 
 template <typename T>
 double TemplateColumn<T>::getAsDouble(size_t idx) const {
-    auto val = buffer_->getRAMRepresentation()->getDataContainer()[idx];
-    return util::glm_convert<double>(val);
+    return util::glm_convert<double>(buffer_[idx]);
 }
 
 template <typename T>
@@ -683,7 +710,7 @@ void TemplateColumn<T>::setBuffer(std::shared_ptr<Buffer<T>> buffer) {
 template <typename T>
 std::string TemplateColumn<T>::getAsString(size_t idx) const {
     std::ostringstream ss;
-    ss << buffer_->getRAMRepresentation()->get(idx);
+    ss << buffer_[idx];
     return ss.str();
 }
 
@@ -694,27 +721,27 @@ T TemplateColumn<T>::operator[](const size_t idx) const {
 
 template <typename T>
 std::shared_ptr<BufferBase> TemplateColumn<T>::getBuffer() {
-    return buffer_;
+    return buffer_.buffer();
 }
 
 template <typename T>
 std::shared_ptr<const BufferBase> TemplateColumn<T>::getBuffer() const {
-    return buffer_;
+    return buffer_.buffer();
 }
 
 template <typename T>
 std::shared_ptr<Buffer<T>> TemplateColumn<T>::getTypedBuffer() {
-    return buffer_;
+    return buffer_.buffer();
 }
 
 template <typename T>
 std::shared_ptr<const Buffer<T>> TemplateColumn<T>::getTypedBuffer() const {
-    return buffer_;
+    return buffer_.buffer();
 }
 
 template <typename T>
 size_t TemplateColumn<T>::getSize() const {
-    return buffer_->getSize();
+    return buffer_.size();
 }
 
 inline auto CategoricalColumn::begin() const -> ConstIterator {
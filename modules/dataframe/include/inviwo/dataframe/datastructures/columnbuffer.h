@@ -0,0 +1,243 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFR...
+
+#include <inviwo/core/datastructures/buffer/buffer.h>              // for Buffer, makeBuffer
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>  // for BufferRAMPrecision
+
+#include <atomic>   // for atomic, memory_order
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <memory>   // for shared_ptr, make_shared
+#include <mutex>    // for mutex, scoped_lock
+#include <utility>  // for move
+#include <vector>   // for vector
+
+namespace inviwo {
+
+/**
+ * @brief Storage of the data of a column
+ *
+ * Either owns a buffer or refers to a selection of rows of another buffer. The rows of a selection
+ * are only gathered into a buffer of their own the first time the whole buffer is requested,
+ * individual elements are read directly from the source until then. Taking a selection of a
+ * selection composes the row indices and refers to the original source.
+ *
+ * The source buffer of a selection is shared and is expected to remain unchanged, like any other
+ * data passed between processors.
+ */
+template <typename T>
+class ColumnBuffer {
+public:
+    using Rows = std::shared_ptr<const std::vector<std::uint32_t>>;
+
+    explicit ColumnBuffer(std::shared_ptr<Buffer<T>> buffer);
+    /**
+     * Copy the rows in @p rowSelection of @p rhs into a new buffer.
+     */
+    ColumnBuffer(const ColumnBuffer& rhs, const std::vector<std::uint32_t>& rowSelection);
+    /**
+     * Refer to the rows in @p rowSelection of @p rhs without copying them.
+     */
+    ColumnBuffer(const ColumnBuffer& rhs, Rows rowSelection);
+    ColumnBuffer(const ColumnBuffer& rhs);
+    ColumnBuffer(ColumnBuffer&& rhs) noexcept;
+    ColumnBuffer& operator=(const ColumnBuffer& rhs);
+    ColumnBuffer& operator=(ColumnBuffer&& rhs) noexcept;
+    ColumnBuffer& operator=(std::shared_ptr<Buffer<T>> buffer);
+    ~ColumnBuffer() = default;
+
+    ///@{
+    /**
+     * Return the buffer holding all rows. A pending row selection is gathered first, the
+     * non-const version also releases the source of the selection.
+     */
+    const std::shared_ptr<Buffer<T>>& buffer() const;
+    const std::shared_ptr<Buffer<T>>& buffer();
+    Buffer<T>* operator->() const { return buffer().get(); }
+    Buffer<T>* operator->() { return buffer().get(); }
+    ///@}
+
+    /**
+     * Return the value of row @p idx without gathering a pending row selection.
+     */
+    T operator[](size_t idx) const;
+    size_t size() const;
+
+    /**
+     * Returns true if this refers to a row selection that has not been gathered yet.
+     */
+    bool isPending() const { return pending_.load(std::memory_order_acquire); }
+
+private:
+    struct Selection {
+        std::shared_ptr<const Buffer<T>> source;
+        Rows rows;
+    };
+    static std::shared_ptr<Buffer<T>> gather(const Buffer<T>& source,
+                                             const std::vector<std::uint32_t>& rows);
+    void gather() const;
+
+    std::shared_ptr<const Selection> selection_;
+    mutable std::shared_ptr<Buffer<T>> buffer_;
+    mutable std::atomic<bool> pending_;
+    mutable std::mutex mutex_;
+};
+
+template <typename T>
+ColumnBuffer<T>::ColumnBuffer(std::shared_ptr<Buffer<T>> buffer)
+    : selection_{}, buffer_{std::move(buffer)}, pending_{false} {}
+
+template <typename T>
+ColumnBuffer<T>::ColumnBuffer(const ColumnBuffer& rhs,
+                              const std::vector<std::uint32_t>& rowSelection)
+    : selection_{}, buffer_{}, pending_{false} {
+    if (rhs.isPending()) {
+        const auto& rows = *rhs.selection_->rows;
+        std::vector<std::uint32_t> composed(rowSelection.size());
+        for (size_t i = 0; i < rowSelection.size(); ++i) {
+            composed[i] = rows[rowSelection[i]];
+        }
+        buffer_ = gather(*rhs.selection_->source, composed);
+    } else {
+        buffer_ = gather(*rhs.buffer_, rowSelection);
+    }
+}
+
+template <typename T>
+ColumnBuffer<T>::ColumnBuffer(const ColumnBuffer& rhs, Rows rowSelection)
+    : selection_{}, buffer_{}, pending_{true} {
+    if (rhs.isPending()) {
+        const auto& rows = *rhs.selection_->rows;
+        auto composed = std::make_shared<std::vector<std::uint32_t>>(rowSelection->size());
+        for (size_t i = 0; i < rowSelection->size(); ++i) {
+            (*composed)[i] = rows[(*rowSelection)[i]];
+        }
+        selection_ = std::make_shared<const Selection>(
+            Selection{rhs.selection_->source, std::move(composed)});
+    } else {
+        selection_ =
+            std::make_shared<const Selection>(Selection{rhs.buffer_, std::move(rowSelection)});
+    }
+}
+
+template <typename T>
+ColumnBuffer<T>::ColumnBuffer(const ColumnBuffer& rhs)
+    : selection_{}, buffer_{}, pending_{rhs.isPending()} {
+    if (pending_) {
+        selection_ = rhs.selection_;
+    } else {
+        buffer_ = std::shared_ptr<Buffer<T>>(rhs.buffer_->clone());
+    }
+}
+
+template <typename T>
+ColumnBuffer<T>::ColumnBuffer(ColumnBuffer&& rhs) noexcept
+    : selection_{std::move(rhs.selection_)}
+    , buffer_{std::move(rhs.buffer_)}
+    , pending_{rhs.pending_.exchange(false)} {}
+
+template <typename T>
+ColumnBuffer<T>& ColumnBuffer<T>::operator=(const ColumnBuffer& rhs) {
+    if (this != &rhs) {
+        ColumnBuffer tmp(rhs);
+        *this = std::move(tmp);
+    }
+    return *this;
+}
+
+template <typename T>
+ColumnBuffer<T>& ColumnBuffer<T>::operator=(ColumnBuffer&& rhs) noexcept {
+    if (this != &rhs) {
+        selection_ = std::move(rhs.selection_);
+        buffer_ = std::move(rhs.buffer_);
+        pending_.store(rhs.pending_.exchange(false));
+    }
+    return *this;
+}
+
+template <typename T>
+ColumnBuffer<T>& ColumnBuffer<T>::operator=(std::shared_ptr<Buffer<T>> buffer) {
+    selection_.reset();
+    buffer_ = std::move(buffer);
+    pending_.store(false);
+    return *this;
+}
+
+template <typename T>
+const std::shared_ptr<Buffer<T>>& ColumnBuffer<T>::buffer() const {
+    if (isPending()) gather();
+    return buffer_;
+}
+
+template <typename T>
+const std::shared_ptr<Buffer<T>>& ColumnBuffer<T>::buffer() {
+    if (isPending()) gather();
+    selection_.reset();
+    return buffer_;
+}
+
+template <typename T>
+T ColumnBuffer<T>::operator[](size_t idx) const {
+    if (isPending()) {
+        const auto& src = selection_->source->getRAMRepresentation()->getDataContainer();
+        return src[(*selection_->rows)[idx]];
+    }
+    return buffer_->getRAMRepresentation()->getDataContainer()[idx];
+}
+
+template <typename T>
+size_t ColumnBuffer<T>::size() const {
+    return isPending() ? selection_->rows->size() : buffer_->getSize();
+}
+
+template <typename T>
+std::shared_ptr<Buffer<T>> ColumnBuffer<T>::gather(const Buffer<T>& source,
+                                                   const std::vector<std::uint32_t>& rows) {
+    auto buffer = std::make_shared<Buffer<T>>(rows.size());
+    const auto& src = source.getRAMRepresentation()->getDataContainer();
+    auto& dst = buffer->getEditableRAMRepresentation()->getDataContainer();
+    for (size_t i = 0; i < rows.size(); ++i) {
+        dst[i] = src[rows[i]];
+    }
+    return buffer;
+}
+
+template <typename T>
+void ColumnBuffer<T>::gather() const {
+    std::scoped_lock lock{mutex_};
+    if (!pending_.load(std::memory_order_relaxed)) return;
+
+    buffer_ = gather(*selection_->source, *selection_->rows);
+    pending_.store(false, std::memory_order_release);
+}
+
+}  // namespace inviwo
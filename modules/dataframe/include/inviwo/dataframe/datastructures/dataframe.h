@@ -96,6 +96,13 @@ public:
     DataFrame(std::uint32_t size = 0);
     DataFrame(const DataFrame& df);
     DataFrame(const DataFrame& df, const std::vector<std::uint32_t>& rowSelection);
+    /**
+     * Create a DataFrame holding the rows in @p rowSelection of @p df. The columns refer to the
+     * columns of @p df and the selected rows are only copied once the buffer of a column is
+     * requested. @p df must therefore not be modified while the new DataFrame is in use.
+     * @see ColumnBuffer
+     */
+    DataFrame(const DataFrame& df, std::shared_ptr<const std::vector<std::uint32_t>> rowSelection);
     DataFrame& operator=(const DataFrame& df);
     DataFrame(DataFrame&& df);
     DataFrame& operator=(DataFrame&& df);
@@ -0,0 +1,76 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFRAME_API
+
+#include <array>    // for array
+#include <cstdint>  // for uint32_t, uint64_t
+
+namespace inviwo {
+
+/**
+ * Definitions of the binary DataFrame format read by BinaryDataFrameReader and written by
+ * BinaryDataFrameWriter. The file consists of
+ *  * a FileHeader,
+ *  * one block of raw column data per column, in native byte order. Categorical columns store
+ *    their uint32 category indices followed by a dictionary block with count + 1 uint64 offsets
+ *    into the concatenated category strings.
+ *  * a JSON metadata block describing the columns, i.e. header, column type, data format, unit,
+ *    custom range, and the offset and size of their blocks.
+ *
+ * All data blocks start at a multiple of binarydataframe::alignment bytes.
+ */
+namespace binarydataframe {
+
+inline constexpr std::array<char, 8> magic{'I', 'V', 'W', 'D', 'F', 'B', 'I', 'N'};
+inline constexpr std::uint32_t version = 1;
+/// Written in native byte order, used to detect files written on a machine of other endianness
+inline constexpr std::uint32_t endianTag = 0x01020304;
+inline constexpr std::uint64_t alignment = 64;
+
+struct FileHeader {
+    std::array<char, 8> magic = binarydataframe::magic;
+    std::uint32_t version = binarydataframe::version;
+    std::uint32_t endianTag = binarydataframe::endianTag;
+    std::uint64_t rows = 0;
+    std::uint64_t metadataOffset = 0;
+    std::uint64_t metadataSize = 0;
+    std::array<char, 24> reserved{};
+};
+static_assert(sizeof(FileHeader) == alignment);
+
+constexpr std::uint64_t align(std::uint64_t offset) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace binarydataframe
+
+}  // namespace inviwo
@@ -54,6 +54,9 @@ class DataFrame;
  * \brief A reader for comma separated value (CSV) files with customizable delimiters and filters.
  * The default delimiter is ',' and headers are included. Floating point values are stored as
  * float32 unless double precision is enabled.
+ *
+ * Files are memory mapped and split into chunks of whole rows, the column types are determined
+ * from a sample of the first rows and the chunks are then parsed in parallel on the thread pool.
  */
 class IVW_MODULE_DATAFRAME_API CSVReader : public DataReaderType<DataFrame> {
 public:
@@ -103,6 +106,14 @@ public:
     CSVReader& setNumberOfExampleRows(size_t rows);
     size_t getNumberOfExamplesRows() const;
 
+    /**
+     * Sets the approximate size in bytes of the chunks that are parsed in parallel. The chunks
+     * are split at row boundaries, i.e. a chunk might be larger than @p bytes.
+     * @see CSVReader::defaultChunkSize
+     */
+    CSVReader& setChunkSize(size_t bytes);
+    size_t getChunkSize() const;
+
     /** @see CSVReader::defaultLocale */
     CSVReader& setLocale(std::string_view loc);
     const std::string& getLocale() const;
@@ -164,6 +175,7 @@ public:
      * * UnitRegexp (sting)
      * * DoublePrecision (bool)
      * * NumberOfExampleRows (size_t)
+     * * ChunkSize (size_t)
      * * Locale (string)
      * * HandleEmptyFields (EmptyField)
      * * Filters (csvfilters::Filters)
@@ -180,6 +192,7 @@ public:
      * * UnitRegexp (sting)
      * * DoublePrecision (bool)
      * * NumberOfExampleRows (size_t)
+     * * ChunkSize (size_t)
      * * Locale (string)
      * * HandleEmptyFields (EmptyField)
      * * Filters (csvfilters::Filters)
@@ -202,6 +215,8 @@ public:
     static constexpr bool defaultDoublePrecision = false;
     /** @see CSVReader::setNumberOfExampleRows */
     static constexpr size_t defaultNumberOfExampleRows = 50;
+    /** @see CSVReader::setChunkSize */
+    static constexpr size_t defaultChunkSize = 8 * 1024 * 1024;
     /** @see CSVReader::setLocale */
     static constexpr std::string_view defaultLocale = "C";
     /** @see CSVReader::setHandleEmptyFields */
@@ -215,9 +230,13 @@ private:
         bool index = false;
     };
 
-    std::vector<TypeCounts> findCellTypes(
-        size_t nCol, const std::vector<std::pair<std::string_view, size_t>>& rows,
-        size_t sampleRows) const;
+    /**
+     * Parse the CSV data in @p content, which has to stay valid during the call.
+     */
+    std::shared_ptr<DataFrame> parse(std::string_view content) const;
+
+    std::vector<TypeCounts> findCellTypes(size_t nCol, std::string_view data, size_t firstLine,
+                                          size_t sampleRows) const;
 
     std::vector<std::function<void(std::string_view, size_t, size_t)>> addColumns(
         DataFrame& df, const std::vector<TypeCounts>& types,
@@ -233,6 +252,7 @@ private:
     std::string unitRegexp_;
     bool doublePrecision_;
     size_t exampleRows_;
+    size_t chunkSize_;
     std::string locale_;
     EmptyField emptyField_;
     csvfilters::Filters filters_;
@@ -49,6 +49,7 @@
 
 namespace inviwo {
 class BufferBase;
+class ProcessorNetworkEvaluator;
 
 /**
  * Utility functions for DataFrame operations
@@ -95,7 +96,8 @@ IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> appendRows(const DataFrame&
  * \brief create a new DataFrame by using an inner join of DataFrame \p left and DataFrame \p right.
  * That is only rows with matching keys are kept. The row indices of \p left will be reused.
  *
- * It is assumed that the entries in the key columns are unique. Otherwise results are undefined.
+ * If several rows of \p right match a row of \p left, the first one is used.
+ * @see dataframe::matchingRows
  * @param left
  * @param right
  * @param keyColumns   headers of the columns used as keys for the join operation (default: index
@@ -111,7 +113,8 @@ IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> innerJoin(
  * \brief create a new DataFrame by using an inner join of DataFrame \p left and DataFrame \p right.
  * That is only rows with matching keys are kept. The row indices of \p left will be reused.
  *
- * It is assumed that the entries in the key columns are unique. Otherwise results are undefined.
+ * If several rows of \p right match a row of \p left, the first one is used.
+ * @see dataframe::matchingRows
  * @param left
  * @param right
  * @param keyColumns   headers of the columns used as keys for the join operation
@@ -127,8 +130,8 @@ IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> innerJoin(
  * right. That is all rows of \p left are augmented with matching rows from \p right.  The row
  * indices of \p left will be reused.
  *
- * It is assumed that the entries in the key columns of \p right are unique. Otherwise results are
- * undefined.
+ * If several rows of \p right match a row of \p left, the first one is used.
+ * @see dataframe::matchingRows
  *
  * @param left
  * @param right
@@ -146,8 +149,8 @@ IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> leftJoin(
  * right. That is all rows of \p left are augmented with matching rows from \p right.  The row
  * indices of \p left will be reused.
  *
- * It is assumed that the entries in the key columns of \p right are unique. Otherwise results are
- * undefined.
+ * If several rows of \p right match a row of \p left, the first one is used.
+ * @see dataframe::matchingRows
  *
  * @param left
  * @param right
@@ -210,6 +213,10 @@ IVW_MODULE_DATAFRAME_API std::vector<std::uint32_t> selectRows(
  * \brief apply the \p filters to each row of \p dataframe and return the row indices where
  * any of the include filters and no exclude filter evaluates to true.
  *
+ * The filters are compiled into kernels per column, where filters with a known predicate, see
+ * ItemFilter::predicate, become plain comparison loops and filters on categorical columns are
+ * evaluated once per category. The rows are evaluated in parallel blocks.
+ *
  * @param dataframe   column containing data for filtering
  * @param filters     predicate to check values from \p col
  * @return list of row indices where rows satisfy all \p filters
@@ -220,6 +227,21 @@ IVW_MODULE_DATAFRAME_API std::vector<std::uint32_t> selectRows(const DataFrame&
 
 IVW_MODULE_DATAFRAME_API std::string createToolTipForRow(const DataFrame& dataframe, size_t rowId);
 
+/**
+ * \brief create a DataFrame from the evaluation metrics gathered by \p evaluator
+ *
+ * The DataFrame holds one row for each sample in the metrics histories, ordered by processor
+ * identifier and then by evaluation. The columns are "Processor" (categorical identifier),
+ * "Evaluation" (the running evaluation number of the processor), and the "Process",
+ * "OnChange", "InitializeResources", and "Invalid" times in milliseconds.
+ *
+ * @param evaluator   the evaluator providing the metrics
+ * @return DataFrame with the metrics history of all processors
+ * @see ProcessorNetworkEvaluator::getMetrics
+ */
+IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> createFromEvaluationMetrics(
+    const ProcessorNetworkEvaluator& evaluator);
+
 #include <warn/push>
 #include <warn/ignore/conversion>
 template <typename Pred>
@@ -48,6 +48,24 @@ enum class StringComp { Equal, NotEqual, Regex, RegexPartial };
 
 enum class NumberComp { Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual };
 
+/**
+ * Numeric comparison `item op value`. Items within @c epsilon of @c value are considered equal by
+ * NumberComp::Equal and NumberComp::NotEqual.
+ */
+template <typename T>
+struct NumberCompare {
+    NumberComp op;
+    T value;
+    T epsilon;
+};
+
+/// Inclusive numeric range test `min <= item <= max`
+template <typename T>
+struct NumberRange {
+    T min;
+    T max;
+};
+
 /**
  * Predicate functor for filtering items in a specific column of a row. Column indices are
  * zero-based.
@@ -58,6 +76,9 @@ enum class NumberComp { Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual
 struct ItemFilter {
     using FilterFunc = std::variant<std::function<bool(std::string_view)>,
                                     std::function<bool(std::int64_t)>, std::function<bool(double)>>;
+    using Predicate =
+        std::variant<std::monostate, NumberCompare<std::int64_t>, NumberCompare<double>,
+                     NumberRange<std::int64_t>, NumberRange<double>>;
 
     /**
      * Predicate function for filtering a column. The data item of @c ItemFilter::column is
@@ -68,6 +89,13 @@ struct ItemFilter {
     FilterFunc filter;
     int column;  //!< zero-based column index
     bool filterOnHeader;
+    /**
+     * Optional description of the comparison performed by @c filter, which allows evaluating the
+     * filter for entire columns at once instead of calling @c filter for each item. It is set by
+     * intMatch, doubleMatch, intRange, and doubleRange and must match @c filter.
+     * @see dataframe::selectRows
+     */
+    Predicate predicate = {};
 };
 
 /// create an item filter matching strings with @p match based on @p op
@@ -0,0 +1,95 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFRAME_API
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <span>     // for span
+#include <string>   // for string
+#include <utility>  // for pair
+#include <vector>   // for vector
+
+namespace inviwo {
+class DataFrame;
+
+namespace dataframe {
+
+enum class JoinMatch {
+    All,   //!< all matching rows are returned
+    First  //!< only the first matching row, i.e. the one with the lowest row index, is returned
+};
+
+/**
+ * \brief Matching rows of a join in compressed sparse row layout
+ *
+ * The rows of the right DataFrame matching row \p i of the left DataFrame are stored in ascending
+ * order in `rows[offsets[i]]` to `rows[offsets[i + 1] - 1]`.
+ */
+struct IVW_MODULE_DATAFRAME_API JoinMatches {
+    std::vector<size_t> offsets{0};
+    std::vector<std::uint32_t> rows;
+
+    /// number of rows in the left DataFrame
+    size_t size() const { return offsets.size() - 1; }
+    /// matching rows in the right DataFrame for row \p row of the left DataFrame
+    std::span<const std::uint32_t> operator[](size_t row) const {
+        return std::span<const std::uint32_t>{rows}.subspan(offsets[row],
+                                                            offsets[row + 1] - offsets[row]);
+    }
+};
+
+/**
+ * \brief for each row in DataFrame \p left find the rows in DataFrame \p right with matching keys
+ *
+ * Two rows match if all of their key columns are equal. Categorical key columns are compared by
+ * their category names, other key columns by value. Floating point keys containing NaN never match.
+ *
+ * The keys of \p right are hashed into a set of open addressing hash tables, one for each
+ * partition of the key hashes, which are built in parallel. The rows of \p left are then probed
+ * in parallel. If there is a single integral key column which is sorted in both DataFrames, for
+ * example the index columns, the rows are matched by a parallel merge instead.
+ *
+ * @param left
+ * @param right
+ * @param keyColumns   headers of the key columns in \p left and \p right
+ * @param match        whether all matching rows or only the first one are returned
+ * @return the matching rows of \p right for each row of \p left
+ * @throws Exception if \p keyColumns is empty, a key column does not exist in either \p left or
+ *         \p right, or the formats of two key columns do not match
+ */
+IVW_MODULE_DATAFRAME_API JoinMatches
+matchingRows(const DataFrame& left, const DataFrame& right,
+             const std::vector<std::pair<std::string, std::string>>& keyColumns,
+             JoinMatch match = JoinMatch::All);
+
+}  // namespace dataframe
+
+}  // namespace inviwo
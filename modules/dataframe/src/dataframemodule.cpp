@@ -43,6 +43,8 @@
 #include <inviwo/core/util/stringconversion.h>                        // for htmlEncode
 #include <inviwo/dataframe/datastructures/dataframe.h>                // for DataFrame
 #include <inviwo/dataframe/io/json/dataframepropertyjsonconverter.h>  // IWYU pragma: keep
+#include <inviwo/dataframe/io/binarydataframereader.h>                // for BinaryDataFrameReader
+#include <inviwo/dataframe/io/binarydataframewriter.h>                // for BinaryDataFrameWriter
 #include <inviwo/dataframe/io/csvreader.h>                            // for CSVReader
 #include <inviwo/dataframe/io/csvwriter.h>                            // for CSVWriter
 #include <inviwo/dataframe/io/jsonreader.h>                           // for JSONDataFrameReader
@@ -129,9 +131,11 @@ DataFrameModule::DataFrameModule(InviwoApplication* app) : InviwoModule(app, "Da
 
     // Readers and writes
     registerDataReader(std::make_unique<CSVReader>());
+    registerDataReader(std::make_unique<BinaryDataFrameReader>());
     registerDataReader(std::make_unique<JSONDataFrameReader>());
 
     registerDataWriter(std::make_unique<CSVWriter>());
+    registerDataWriter(std::make_unique<BinaryDataFrameWriter>());
     registerDataWriter(std::make_unique<XMLWriter>());
 
     // Data converters
@@ -40,8 +40,12 @@
 #include <inviwo/core/util/stdextensions.h>                             // for transform
 #include <inviwo/core/util/zip.h>
 
+#include <cstdint>        // for uint32_t
+#include <limits>         // for numeric_limits
 #include <sstream>        // for basic_stringbuf<>...
 #include <unordered_map>  // for unordered_map
+#include <utility>        // for move
+#include <vector>         // for vector
 
 #include <glm/gtc/type_precision.hpp>  // for uint32_t
 
@@ -56,10 +60,18 @@ IndexColumn::IndexColumn(std::string_view header, std::vector<std::uint32_t> dat
 IndexColumn::IndexColumn(const IndexColumn& rhs, const std::vector<std::uint32_t>& rowSelection)
     : TemplateColumn<std::uint32_t>(rhs, rowSelection) {}
 
+IndexColumn::IndexColumn(const IndexColumn& rhs,
+                         std::shared_ptr<const std::vector<std::uint32_t>> rowSelection)
+    : TemplateColumn<std::uint32_t>(rhs, std::move(rowSelection)) {}
+
 IndexColumn* IndexColumn::clone() const { return new IndexColumn(*this); }
 IndexColumn* IndexColumn::clone(const std::vector<std::uint32_t>& rowSelection) const {
     return new IndexColumn(*this, rowSelection);
 }
+IndexColumn* IndexColumn::clone(
+    std::shared_ptr<const std::vector<std::uint32_t>> rowSelection) const {
+    return new IndexColumn(*this, std::move(rowSelection));
+}
 
 ColumnType IndexColumn::getColumnType() const { return ColumnType::Index; }
 
@@ -91,7 +103,7 @@ CategoricalColumn::CategoricalColumn(const CategoricalColumn& rhs)
     : header_{rhs.header_}
     , unit_{rhs.unit_}
     , range_{rhs.range_}
-    , buffer_{std::shared_ptr<Buffer<std::uint32_t>>(rhs.buffer_->clone())}
+    , buffer_{rhs.buffer_}
     , lookUpTable_{rhs.lookUpTable_}
     , lookupMap_{rhs.lookupMap_} {}
 
@@ -100,23 +112,25 @@ CategoricalColumn::CategoricalColumn(const CategoricalColumn& rhs,
     : header_{rhs.header_}
     , unit_{rhs.unit_}
     , range_{rhs.range_}
-    , buffer_{std::make_shared<Buffer<std::uint32_t>>(rowSelection.size())}
+    , buffer_{rhs.buffer_, rowSelection}
     , lookUpTable_{rhs.lookUpTable_}
-    , lookupMap_{rhs.lookupMap_} {
+    , lookupMap_{rhs.lookupMap_} {}
 
-    const auto& src = rhs.buffer_->getRAMRepresentation()->getDataContainer();
-    auto& dst = buffer_->getEditableRAMRepresentation()->getDataContainer();
-    for (size_t i = 0; i < rowSelection.size(); ++i) {
-        dst[i] = src[rowSelection[i]];
-    }
-}
+CategoricalColumn::CategoricalColumn(
+    const CategoricalColumn& rhs, std::shared_ptr<const std::vector<std::uint32_t>> rowSelection)
+    : header_{rhs.header_}
+    , unit_{rhs.unit_}
+    , range_{rhs.range_}
+    , buffer_{rhs.buffer_, std::move(rowSelection)}
+    , lookUpTable_{rhs.lookUpTable_}
+    , lookupMap_{rhs.lookupMap_} {}
 
 CategoricalColumn& CategoricalColumn::operator=(const CategoricalColumn& rhs) {
     if (this != &rhs) {
         header_ = rhs.getHeader();
         unit_ = rhs.unit_;
         range_ = rhs.range_;
-        buffer_ = std::shared_ptr<Buffer<std::uint32_t>>(rhs.buffer_->clone());
+        buffer_ = rhs.buffer_;
         lookUpTable_ = rhs.lookUpTable_;
         lookupMap_ = rhs.lookupMap_;
     }
@@ -141,6 +155,11 @@ CategoricalColumn* CategoricalColumn::clone(const std::vector<std::uint32_t>& ro
     return new CategoricalColumn(*this, rowSelection);
 }
 
+CategoricalColumn* CategoricalColumn::clone(
+    std::shared_ptr<const std::vector<std::uint32_t>> rowSelection) const {
+    return new CategoricalColumn(*this, std::move(rowSelection));
+}
+
 ColumnType CategoricalColumn::getColumnType() const { return ColumnType::Categorical; }
 
 const std::string& CategoricalColumn::getHeader() const { return header_; }
@@ -169,7 +188,7 @@ dvec2 CategoricalColumn::getRange() const {
     }
 }
 
-size_t CategoricalColumn::getSize() const { return buffer_->getSize(); }
+size_t CategoricalColumn::getSize() const { return buffer_.size(); }
 
 void CategoricalColumn::set(size_t idx, std::string_view str) {
     auto id = addOrGetID(str);
@@ -186,7 +205,7 @@ void CategoricalColumn::set(size_t idx, std::uint32_t id) {
 const std::string& CategoricalColumn::get(size_t idx) const { return lookUpTable_[getId(idx)]; }
 
 std::uint32_t CategoricalColumn::getId(size_t idx) const {
-    return buffer_->getRAMRepresentation()->get(idx);
+    return buffer_[idx];
 }
 
 double CategoricalColumn::getAsDouble(size_t idx) const { return static_cast<double>(getId(idx)); }
@@ -213,10 +232,15 @@ void CategoricalColumn::append(const Column& col) {
 
     if (auto srccol = dynamic_cast<const CategoricalColumn*>(&col)) {
         auto& values = buffer_->getEditableRAMRepresentation()->getDataContainer();
-
-        for (auto idx : srccol->buffer_->getRAMRepresentation()->getDataContainer()) {
-            const auto& value = srccol->lookUpTable_[idx];
-            values.push_back(addOrGetID(value));
+        const auto& srcValues = srccol->buffer_->getRAMRepresentation()->getDataContainer();
+        values.reserve(values.size() + srcValues.size());
+
+        // map the categories of srccol to ours on first use, only categories in use are added
+        constexpr auto unmapped = std::numeric_limits<std::uint32_t>::max();
+        std::vector<std::uint32_t> ids(srccol->lookUpTable_.size(), unmapped);
+        for (auto idx : srcValues) {
+            if (ids[idx] == unmapped) ids[idx] = addOrGetID(srccol->lookUpTable_[idx]);
+            values.push_back(ids[idx]);
         }
 
     } else {
@@ -247,14 +271,16 @@ glm::uint32_t CategoricalColumn::addOrGetID(std::string_view str) {
     }
 }
 
-std::shared_ptr<BufferBase> CategoricalColumn::getBuffer() { return buffer_; }
+std::shared_ptr<BufferBase> CategoricalColumn::getBuffer() { return buffer_.buffer(); }
 
-std::shared_ptr<const BufferBase> CategoricalColumn::getBuffer() const { return buffer_; }
+std::shared_ptr<const BufferBase> CategoricalColumn::getBuffer() const { return buffer_.buffer(); }
 
-std::shared_ptr<Buffer<std::uint32_t>> CategoricalColumn::getTypedBuffer() { return buffer_; }
+std::shared_ptr<Buffer<std::uint32_t>> CategoricalColumn::getTypedBuffer() {
+    return buffer_.buffer();
+}
 
 std::shared_ptr<const Buffer<std::uint32_t>> CategoricalColumn::getTypedBuffer() const {
-    return buffer_;
+    return buffer_.buffer();
 }
 
 std::string_view enumToStr(ColumnType type) {
@@ -70,6 +70,13 @@ DataFrame::DataFrame(const DataFrame& rhs, const std::vector<std::uint32_t>& row
         columns_.emplace_back(col->clone(rowSelection));
     }
 }
+DataFrame::DataFrame(const DataFrame& rhs,
+                     std::shared_ptr<const std::vector<std::uint32_t>> rowSelection)
+    : columns_{} {
+    for (const auto& col : rhs.columns_) {
+        columns_.emplace_back(col->clone(rowSelection));
+    }
+}
 DataFrame& DataFrame::operator=(const DataFrame& that) {
     if (this != &that) {
         DataFrame tmp(that);
@@ -0,0 +1,238 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/io/binarydataframereader.h>
+
+#include <inviwo/core/datastructures/unitsystem.h>      // for Unit
+#include <inviwo/core/io/datareader.h>                  // for DataReaderType
+#include <inviwo/core/io/datareaderexception.h>         // for DataReaderException
+#include <inviwo/core/io/memorymappedfile.h>            // for MemoryMappedFile
+#include <inviwo/core/util/exception.h>                 // for Exception
+#include <inviwo/core/util/fileextension.h>             // for FileExtension
+#include <inviwo/core/util/foreach.h>                   // for forEachParallel
+#include <inviwo/core/util/formatdispatching.h>         // for singleDispatch
+#include <inviwo/core/util/formats.h>                   // for DataFormatBase, DataFormatExc...
+#include <inviwo/core/util/glmvec.h>                    // for dvec2
+#include <inviwo/core/util/sourcecontext.h>             // for IVW_CONTEXT
+#include <inviwo/dataframe/datastructures/column.h>     // for CategoricalColumn
+#include <inviwo/dataframe/datastructures/dataframe.h>  // for DataFrame
+#include <inviwo/dataframe/io/binarydataframeformat.h>  // for FileHeader
+
+#include <algorithm>    // for any_of
+#include <cstddef>      // for byte
+#include <cstdint>      // for uint64_t
+#include <cstring>      // for memcpy
+#include <optional>     // for optional
+#include <span>         // for span
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+#include <fmt/std.h>
+#include <nlohmann/json.hpp>  // for json
+
+namespace inviwo {
+
+BinaryDataFrameReader::BinaryDataFrameReader() : DataReaderType<DataFrame>() {
+    addExtension(FileExtension("ivdf", "Inviwo binary DataFrame"));
+}
+
+BinaryDataFrameReader* BinaryDataFrameReader::clone() const {
+    return new BinaryDataFrameReader(*this);
+}
+
+std::shared_ptr<DataFrame> BinaryDataFrameReader::readData(const std::filesystem::path& fileName) {
+    using json = nlohmann::json;
+
+    checkExists(fileName);
+    const MemoryMappedFile file{fileName};
+    const auto bytes = file.bytes();
+
+    binarydataframe::FileHeader header;
+    if (bytes.size() < sizeof(header)) {
+        throw DataReaderException(IVW_CONTEXT, "Not a binary DataFrame file: {}", fileName);
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (header.magic != binarydataframe::magic) {
+        throw DataReaderException(IVW_CONTEXT, "Not a binary DataFrame file: {}", fileName);
+    }
+    if (header.version != binarydataframe::version) {
+        throw DataReaderException(IVW_CONTEXT, "Unsupported binary DataFrame version {} in {}",
+                                  header.version, fileName);
+    }
+    if (header.endianTag != binarydataframe::endianTag) {
+        throw DataReaderException(IVW_CONTEXT,
+                                  "Binary DataFrame {} was written with a different endianness",
+                                  fileName);
+    }
+
+    const auto block = [&](std::uint64_t offset, std::uint64_t size) {
+        if (offset > bytes.size() || size > bytes.size() - offset) {
+            throw DataReaderException(IVW_CONTEXT, "Truncated binary DataFrame file: {}",
+                                      fileName);
+        }
+        return bytes.subspan(offset, size);
+    };
+    const auto dataBlock = [&](const json& item, std::uint64_t expectedSize) {
+        const auto data =
+            block(item.at("offset").get<std::uint64_t>(), item.at("size").get<std::uint64_t>());
+        if (data.size() != expectedSize) {
+            throw DataReaderException(IVW_CONTEXT, "Invalid column size in {}", fileName);
+        }
+        return data;
+    };
+
+    const auto metadataBytes = block(header.metadataOffset, header.metadataSize);
+    const std::string_view metadataString{reinterpret_cast<const char*>(metadataBytes.data()),
+                                          metadataBytes.size()};
+
+    // The column buffers are allocated here and the column blocks copied in parallel afterwards.
+    // For categorical columns the copied indices are checked against the number of categories.
+    struct Copy {
+        void* dst;
+        std::span<const std::byte> src;
+        std::optional<std::uint64_t> categories = std::nullopt;
+    };
+    std::vector<Copy> copies;
+
+    const auto rows = static_cast<size_t>(header.rows);
+    auto dataframe = std::make_shared<DataFrame>();
+    bool hasIndex = false;
+    try {
+        const auto metadata = json::parse(metadataString);
+        for (const auto& item : metadata.at("columns")) {
+            const auto columnHeader = item.at("header").get<std::string>();
+            const auto type = item.at("type").get<std::string>();
+            const auto formatName = item.at("format").get<std::string>();
+            const DataFormatBase* format = nullptr;
+            try {
+                format = DataFormatBase::get(formatName);
+            } catch (const DataFormatException&) {
+                throw DataReaderException(IVW_CONTEXT, "Unknown column format '{}' in {}",
+                                          formatName, fileName);
+            }
+            const auto unit = units::unit_from_string(item.at("unit").get<std::string>());
+            std::optional<dvec2> range;
+            if (auto it = item.find("range"); it != item.end()) {
+                range = dvec2{it->at(0).get<double>(), it->at(1).get<double>()};
+            }
+            const auto data = dataBlock(item.at("data"), rows * format->getSizeInBytes());
+
+            if (type == "index") {
+                if (format != DataFormat<std::uint32_t>::get()) {
+                    throw DataReaderException(IVW_CONTEXT, "Invalid index column format in {}",
+                                              fileName);
+                }
+                hasIndex = true;
+                auto index = dataframe->getIndexColumn();
+                index->setHeader(columnHeader);
+                index->setUnit(unit);
+                index->setCustomRange(range);
+                auto& container =
+                    index->getTypedBuffer()->getEditableRAMRepresentation()->getDataContainer();
+                container.resize(rows);
+                copies.push_back(Copy{container.data(), data});
+            } else if (type == "categorical") {
+                if (format != DataFormat<std::uint32_t>::get()) {
+                    throw DataReaderException(IVW_CONTEXT,
+                                              "Invalid categorical column format in {}", fileName);
+                }
+                const auto& categoriesItem = item.at("categories");
+                const auto count = categoriesItem.at("count").get<std::uint64_t>();
+                const auto offsetsBlock =
+                    dataBlock(categoriesItem.at("offsets"), (count + 1) * sizeof(std::uint64_t));
+                const auto& stringsItem = categoriesItem.at("strings");
+                const auto stringsBlock = block(stringsItem.at("offset").get<std::uint64_t>(),
+                                                stringsItem.at("size").get<std::uint64_t>());
+
+                std::vector<std::uint64_t> offsets(count + 1);
+                std::memcpy(offsets.data(), offsetsBlock.data(), offsetsBlock.size());
+                const std::string_view strings{reinterpret_cast<const char*>(stringsBlock.data()),
+                                               stringsBlock.size()};
+                std::vector<std::string> categories;
+                categories.reserve(count);
+                for (size_t i = 0; i < count; ++i) {
+                    if (offsets[i] > offsets[i + 1] || offsets[i + 1] > strings.size()) {
+                        throw DataReaderException(IVW_CONTEXT, "Invalid categories in {}",
+                                                  fileName);
+                    }
+                    categories.emplace_back(
+                        strings.substr(offsets[i], offsets[i + 1] - offsets[i]));
+                }
+
+                auto col = std::make_shared<CategoricalColumn>(
+                    columnHeader, std::vector<std::uint32_t>(rows), std::move(categories), unit,
+                    range);
+                copies.push_back(
+                    Copy{col->getTypedBuffer()->getEditableRAMRepresentation()->getData(), data,
+                         count});
+                dataframe->addColumn(col);
+            } else if (type == "ordinal") {
+                auto col = dispatching::singleDispatch<std::shared_ptr<Column>,
+                                                       dispatching::filter::All>(
+                    format->getId(), [&]<typename T>() -> std::shared_ptr<Column> {
+                        auto col = std::make_shared<TemplateColumn<T>>(
+                            columnHeader, std::vector<T>(rows), unit, range);
+                        copies.push_back(Copy{
+                            col->getTypedBuffer()->getEditableRAMRepresentation()->getData(),
+                            data});
+                        return col;
+                    });
+                dataframe->addColumn(col);
+            } else {
+                throw DataReaderException(IVW_CONTEXT, "Unknown column type '{}' in {}", type,
+                                          fileName);
+            }
+        }
+    } catch (const json::exception& e) {
+        throw DataReaderException(IVW_CONTEXT, "Invalid metadata in {}: {}", fileName, e.what());
+    }
+
+    file.adviseSequential();
+    std::vector<char> invalidIndices(copies.size(), 0);
+    util::forEachParallel(copies, [&](const Copy& copy, size_t id) {
+        std::memcpy(copy.dst, copy.src.data(), copy.src.size());
+        if (copy.categories) {
+            const std::span indices{static_cast<const std::uint32_t*>(copy.dst),
+                                    copy.src.size() / sizeof(std::uint32_t)};
+            invalidIndices[id] = std::ranges::any_of(
+                indices, [&](std::uint32_t i) { return i >= *copy.categories; });
+        }
+    });
+    if (std::ranges::any_of(invalidIndices, [](char invalid) { return invalid != 0; })) {
+        throw DataReaderException(IVW_CONTEXT, "Categorical index out of range in {}", fileName);
+    }
+    if (!hasIndex) {
+        dataframe->updateIndexBuffer();
+    }
+
+    return dataframe;
+}
+
+}  // namespace inviwo
@@ -0,0 +1,168 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/io/binarydataframewriter.h>
+
+#include <inviwo/core/datastructures/buffer/bufferram.h>  // for BufferRAM
+#include <inviwo/core/datastructures/unitsystem.h>        // for Unit
+#include <inviwo/core/io/datawriter.h>                    // for DataWriterType
+#include <inviwo/core/io/datawriterexception.h>           // for DataWriterException
+#include <inviwo/core/util/fileextension.h>               // for FileExtension
+#include <inviwo/core/util/formats.h>                     // for DataFormatBase
+#include <inviwo/core/util/sourcecontext.h>               // for IVW_CONTEXT
+#include <inviwo/dataframe/datastructures/column.h>       // for CategoricalColumn
+#include <inviwo/dataframe/datastructures/dataframe.h>    // for DataFrame
+#include <inviwo/dataframe/io/binarydataframeformat.h>    // for FileHeader
+
+#include <array>    // for array
+#include <cstdint>  // for uint64_t
+#include <deque>    // for deque
+#include <fstream>  // for ofstream
+#include <sstream>  // for stringstream
+#include <string>   // for string
+
+#include <nlohmann/json.hpp>  // for json
+
+namespace inviwo {
+
+BinaryDataFrameWriter::BinaryDataFrameWriter() : DataWriterType<DataFrame>() {
+    addExtension(FileExtension("ivdf", "Inviwo binary DataFrame"));
+}
+
+BinaryDataFrameWriter* BinaryDataFrameWriter::clone() const {
+    return new BinaryDataFrameWriter(*this);
+}
+
+void BinaryDataFrameWriter::writeData(const DataFrame* data,
+                                      const std::filesystem::path& filePath) const {
+    auto f = open(filePath, std::ios_base::out | std::ios_base::binary);
+    writeData(data, f);
+}
+
+std::unique_ptr<std::vector<unsigned char>> BinaryDataFrameWriter::writeDataToBuffer(
+    const DataFrame* data, std::string_view /*fileExtension*/) const {
+    std::stringstream ss{std::ios_base::out | std::ios_base::binary};
+    writeData(data, ss);
+    auto stringData = std::move(ss).str();
+    return std::make_unique<std::vector<unsigned char>>(stringData.begin(), stringData.end());
+}
+
+void BinaryDataFrameWriter::writeData(const DataFrame* dataFrame, std::ostream& os) const {
+    using json = nlohmann::json;
+
+    struct Block {
+        const void* data;
+        std::uint64_t size;
+        std::uint64_t offset;
+    };
+    std::vector<Block> blocks;
+    std::uint64_t offset = sizeof(binarydataframe::FileHeader);
+    const auto addBlock = [&](const void* data, std::uint64_t size) {
+        offset = binarydataframe::align(offset);
+        blocks.push_back(Block{data, size, offset});
+        json block = {{"offset", offset}, {"size", size}};
+        offset += size;
+        return block;
+    };
+
+    // the category dictionaries, deques since the blocks point into the elements
+    std::deque<std::vector<std::uint64_t>> dictionaryOffsets;
+    std::deque<std::string> dictionaryStrings;
+
+    const auto rows = dataFrame->getNumberOfRows();
+    json columns = json::array();
+    for (const auto& col : *dataFrame) {
+        if (col->getSize() != rows) {
+            throw DataWriterException(IVW_CONTEXT,
+                                      "Column '{}' has {} rows, expected {} as the other columns",
+                                      col->getHeader(), col->getSize(), rows);
+        }
+
+        const auto* format = col->getBuffer()->getDataFormat();
+        json item = {{"header", col->getHeader()},
+                     {"format", format->getString()},
+                     {"unit", units::to_string(col->getUnit())}};
+        if (auto range = col->getCustomRange()) {
+            item["range"] = {range->x, range->y};
+        }
+        item["data"] = addBlock(col->getBuffer()->getRepresentation<BufferRAM>()->getData(),
+                                rows * format->getSizeInBytes());
+
+        switch (col->getColumnType()) {
+            case ColumnType::Index:
+                item["type"] = "index";
+                break;
+            case ColumnType::Ordinal:
+                item["type"] = "ordinal";
+                break;
+            case ColumnType::Categorical: {
+                item["type"] = "categorical";
+                const auto& categories =
+                    static_cast<const CategoricalColumn&>(*col).getCategories();
+                auto& offsets = dictionaryOffsets.emplace_back();
+                auto& strings = dictionaryStrings.emplace_back();
+                offsets.reserve(categories.size() + 1);
+                offsets.push_back(0);
+                for (const auto& category : categories) {
+                    strings.append(category);
+                    offsets.push_back(strings.size());
+                }
+                item["categories"] = {
+                    {"count", categories.size()},
+                    {"offsets", addBlock(offsets.data(), offsets.size() * sizeof(std::uint64_t))},
+                    {"strings", addBlock(strings.data(), strings.size())}};
+                break;
+            }
+        }
+        columns.push_back(std::move(item));
+    }
+
+    const auto metadata = json{{"columns", std::move(columns)}}.dump();
+
+    binarydataframe::FileHeader header;
+    header.rows = rows;
+    header.metadataOffset = offset;
+    header.metadataSize = metadata.size();
+
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    std::uint64_t pos = sizeof(header);
+    const std::array<char, binarydataframe::alignment> padding{};
+    for (const auto& block : blocks) {
+        os.write(padding.data(), static_cast<std::streamsize>(block.offset - pos));
+        os.write(static_cast<const char*>(block.data), static_cast<std::streamsize>(block.size));
+        pos = block.offset + block.size;
+    }
+    os.write(metadata.data(), static_cast<std::streamsize>(metadata.size()));
+
+    if (!os) {
+        throw DataWriterException("Failed to write binary DataFrame", IVW_CONTEXT);
+    }
+}
+
+}  // namespace inviwo
@@ -35,27 +35,31 @@
 #include <inviwo/core/datastructures/unitsystem.h>                      // for Unit
 #include <inviwo/core/io/datareader.h>                                  // for DataReaderType
 #include <inviwo/core/io/datareaderexception.h>                         // for DataReaderException
+#include <inviwo/core/io/memorymappedfile.h>                            // for MemoryMappedFile
 #include <inviwo/core/util/detected.h>                                  // for alwaysFalse
 #include <inviwo/core/util/fileextension.h>                             // for FileExtension
-#include <inviwo/core/util/filesystem.h>                                // for skipByteOrderMark
 #include <inviwo/core/util/logcentral.h>                                // for LogCentral, LogWarn
 #include <inviwo/core/util/raiiutils.h>                                 // for OnScopeExit, OnSc...
 #include <inviwo/core/util/safecstr.h>                                  // for SafeCStr
 #include <inviwo/core/util/sourcecontext.h>                             // for IVW_CONTEXT_CUSTOM
 #include <inviwo/core/util/stdextensions.h>                             // for overloaded
 #include <inviwo/core/util/stringconversion.h>                          // for trim
+#include <inviwo/core/util/threadutil.h>                                // for dispatchPool
 #include <inviwo/core/util/zip.h>                                       // for zipIterator, zipper
 #include <inviwo/dataframe/datastructures/column.h>                     // for CategoricalColumn...
 #include <inviwo/dataframe/datastructures/dataframe.h>                  // for DataFrame
 #include <inviwo/dataframe/util/filters.h>                              // for Filters, ItemFilter
 
 #include <algorithm>      // for any_of, none_of
+#include <array>          // for array
 #include <charconv>       // for from_chars
 #include <clocale>        // for setlocale, LC_ALL
 #include <cstdint>        // for int64_t
 #include <cstdlib>        // for size_t, strtod
+#include <filesystem>     // for file_size
 #include <fstream>        // for char_traits, basi...
 #include <functional>     // for function, __base
+#include <future>         // for future
 #include <iterator>       // for istreambuf_iterator
 #include <limits>         // for numeric_limits
 #include <optional>       // for optional, nullopt
@@ -92,6 +96,7 @@ CSVReader::CSVReader(std::string_view delim, bool hasHeader, bool doublePrecisio
     , unitRegexp_(defaultUnitRegexp)
     , doublePrecision_(doublePrecision)
     , exampleRows_{defaultNumberOfExampleRows}
+    , chunkSize_{defaultChunkSize}
     , locale_{defaultLocale}
     , emptyField_{defaultEmptyField} {
     addExtension(FileExtension("csv", "Comma Separated Values"));
@@ -148,6 +153,12 @@ CSVReader& CSVReader::setNumberOfExampleRows(size_t rows) {
 }
 size_t CSVReader::getNumberOfExamplesRows() const { return exampleRows_; }
 
+CSVReader& CSVReader::setChunkSize(size_t bytes) {
+    chunkSize_ = std::max<size_t>(bytes, 1);
+    return *this;
+}
+size_t CSVReader::getChunkSize() const { return chunkSize_; }
+
 CSVReader& CSVReader::setLocale(std::string_view loc) {
     locale_ = loc;
     return *this;
@@ -197,6 +208,9 @@ bool CSVReader::setOption(std::string_view key, std::any value) {
     } else if (auto* rows = std::any_cast<size_t>(&value); rows && key == "NumberOfExampleRows") {
         setNumberOfExampleRows(*rows);
         return true;
+    } else if (auto* chunkSize = std::any_cast<size_t>(&value); chunkSize && key == "ChunkSize") {
+        setChunkSize(*chunkSize);
+        return true;
     } else if (auto* locale = std::any_cast<std::string>(&value); locale && key == "Locale") {
         setLocale(*locale);
         return true;
@@ -230,6 +244,8 @@ std::any CSVReader::getOption(std::string_view key) {
         return hasDoublePrecision();
     } else if (key == "NumberOfExampleRows") {
         return getNumberOfExamplesRows();
+    } else if (key == "ChunkSize") {
+        return getChunkSize();
     } else if (key == "Locale") {
         return getLocale();
     } else if (key == "HandleEmptyFields") {
@@ -241,17 +257,16 @@ std::any CSVReader::getOption(std::string_view key) {
 }
 
 std::shared_ptr<DataFrame> CSVReader::readData(const std::filesystem::path& fileName) {
-    auto file = open(fileName);
+    checkExists(fileName);
 
-    file.seekg(0, std::ios::end);
-    std::streampos len = file.tellg();
-    file.seekg(0, std::ios::beg);
-
-    if (len == std::streampos(0)) {
+    std::error_code ec;
+    if (std::filesystem::file_size(fileName, ec) == 0 || ec) {
         throw DataReaderException(IVW_CONTEXT, "Emtpy file: {}", fileName);
     }
 
-    return readData(file);
+    const MemoryMappedFile file{fileName};
+    file.adviseSequential();
+    return parse(std::string_view{static_cast<const char*>(file.data()), file.size()});
 }
 
 namespace util {
@@ -435,18 +450,153 @@ std::string_view stripQuotes(std::string_view str) {
     return str;
 };
 
+/**
+ * Calls @p func with each trimmed row of @p str and its line number, starting at @p lineNumber.
+ * Rows are separated by line breaks outside of quotes, a trailing line break does not start a new
+ * row. The iteration stops if @p func returns false.
+ * @return the offset and line number of the row following the last visited row
+ */
+template <typename Func>
+std::pair<size_t, size_t> forEachRow(std::string_view str, size_t lineNumber, Func&& func) {
+    for (size_t first = 0; first < str.size();) {
+        const size_t rowLine = lineNumber;
+        size_t pos = first;
+        bool quoted = false;
+        while (true) {
+            pos = str.find_first_of("\"\n", pos);
+            if (pos == std::string_view::npos) break;
+            if (str[pos] == '"') {
+                quoted = !quoted;
+            } else {
+                ++lineNumber;
+                if (!quoted) break;
+            }
+            ++pos;
+        }
+        if (quoted) {
+            throw DataReaderException(IVW_CONTEXT_CUSTOM("CSVReader"),
+                                      "Detected unmatched quote starting on line: {}", rowLine);
+        }
+
+        const auto last = std::min(pos, str.size());
+        if (!std::invoke(func, util::trim(str.substr(first, last - first)), rowLine)) {
+            return {std::min(last + 1, str.size()), lineNumber};
+        }
+        first = last + 1;
+    }
+    return {str.size(), lineNumber};
+}
+
+/**
+ * Calls @p func(i) for i in [0, @p count) on the thread pool, or serially if there is no pool,
+ * and passes the results in order to @p consume on the calling thread.
+ */
+template <typename Func, typename Consume>
+void forEachChunk(size_t count, Func&& func, Consume&& consume) {
+    if (count <= 1 || util::getPoolSize() == 0) {
+        for (size_t i = 0; i < count; ++i) consume(func(i));
+        return;
+    }
+
+    using Result = std::invoke_result_t<Func, size_t>;
+    std::vector<std::future<Result>> futures;
+    futures.reserve(count);
+    // the tasks reference data of the caller, make sure they are all done before returning
+    const util::OnScopeExit waitForAll{[&]() {
+        for (const auto& future : futures) {
+            if (future.valid()) util::getThreadPool().wait(future);
+        }
+    }};
+    for (size_t i = 0; i < count; ++i) {
+        futures.push_back(util::dispatchPool([&func, i]() { return func(i); }));
+    }
+    for (auto& future : futures) {
+        util::getThreadPool().wait(future);
+        consume(future.get());
+    }
+}
+
+struct Chunk {
+    std::string_view data;
+    size_t firstLine;
+};
+
+/**
+ * Split @p data into chunks of about @p chunkSize bytes that only contain whole rows. The data is
+ * divided into ranges of @p chunkSize bytes that are scanned in parallel for the first line break
+ * following an even and an odd number of quotes. The number of quotes in the preceding ranges
+ * then determines which of them is a row boundary.
+ */
+std::vector<Chunk> splitRows(std::string_view data, size_t firstLine, size_t chunkSize) {
+    const size_t nRanges = (data.size() + chunkSize - 1) / chunkSize;
+    if (nRanges <= 1) return {Chunk{data, firstLine}};
+
+    struct RangeInfo {
+        size_t quotes = 0;
+        size_t lineBreaks = 0;
+        // offset of the first line break after an even/odd number of quotes within the range
+        std::array<size_t, 2> boundary{std::string_view::npos, std::string_view::npos};
+        // the number of line breaks before each boundary
+        std::array<size_t, 2> lineBreaksBefore{0, 0};
+    };
+
+    std::vector<RangeInfo> ranges;
+    ranges.reserve(nRanges);
+    forEachChunk(
+        nRanges,
+        [&](size_t i) {
+            const auto range = data.substr(i * chunkSize, chunkSize);
+            RangeInfo info;
+            for (size_t pos = 0; pos < range.size(); ++pos) {
+                if (range[pos] == '"') {
+                    ++info.quotes;
+                } else if (range[pos] == '\n') {
+                    const auto parity = info.quotes % 2;
+                    if (info.boundary[parity] == std::string_view::npos) {
+                        info.boundary[parity] = pos;
+                        info.lineBreaksBefore[parity] = info.lineBreaks;
+                    }
+                    ++info.lineBreaks;
+                }
+            }
+            return info;
+        },
+        [&](const RangeInfo& info) { ranges.push_back(info); });
+
+    std::vector<Chunk> chunks;
+    size_t start = 0;
+    size_t startLine = firstLine;
+    size_t line = firstLine;
+    size_t parity = 0;
+    for (auto&& [i, info] : util::enumerate(ranges)) {
+        if (i > 0 && info.boundary[parity] != std::string_view::npos) {
+            const size_t end = i * chunkSize + info.boundary[parity] + 1;
+            chunks.push_back(Chunk{data.substr(start, end - start), startLine});
+            start = end;
+            startLine = line + info.lineBreaksBefore[parity] + 1;
+        }
+        parity = (parity + info.quotes) % 2;
+        line += info.lineBreaks;
+    }
+    chunks.push_back(Chunk{data.substr(start), startLine});
+    return chunks;
+}
+
 }  // namespace util
 
-std::vector<CSVReader::TypeCounts> CSVReader::findCellTypes(
-    size_t nCol, const std::vector<std::pair<std::string_view, size_t>>& rows,
-    size_t sampleRows) const {
+std::vector<CSVReader::TypeCounts> CSVReader::findCellTypes(size_t nCol, std::string_view data,
+                                                            size_t firstLine,
+                                                            size_t sampleRows) const {
     size_t sampledRows = sampleRows;
     std::vector<TypeCounts> counts(nCol);
 
     const bool cLocale = locale_ == "C";
 
-    for (auto [i, row] : util::enumerate(rows)) {
-        util::parse(row.first, delimiters_, nCol, row.second,
+    size_t i = 0;
+    util::forEachRow(data, firstLine, [&](std::string_view row, size_t lineNumber) {
+        if (skipRow(row, lineNumber, true)) return true;
+
+        util::parse(row, delimiters_, nCol, lineNumber,
                     [&](std::string_view cell, size_t index, [[maybe_unused]] size_t part) {
                         if (cell.empty()) {
                             // Ignore empty cells.
@@ -459,16 +609,17 @@ std::vector<CSVReader::TypeCounts> CSVReader::findCellTypes(
                             ++counts[index].string;
                         }
                     });
-        if (i > sampledRows) {
+        if (i++ > sampledRows) {
             if (std::any_of(counts.begin(), counts.end(), [](const TypeCounts& type) {
                     return type.integer == 0 && type.real == 0 && type.string == 0;
                 })) {
                 sampledRows *= 2;
             } else {
-                break;
+                return false;
             }
         }
-    }
+        return true;
+    });
     if (sampledRows != sampleRows) {
         LogWarn(
             "Could not find any data for some columns, sampled more rows to determine column "
@@ -648,7 +799,15 @@ bool CSVReader::skipRow(std::string_view row, size_t lineNumber, bool filterOnHe
 }
 
 std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
-    filesystem::skipByteOrderMark(stream);
+    const std::string content{std::istreambuf_iterator<char>(stream),
+                              std::istreambuf_iterator<char>()};
+    return parse(content);
+}
+
+std::shared_ptr<DataFrame> CSVReader::parse(std::string_view content) const {
+    if (content.starts_with("\xEF\xBB\xBF")) {
+        content.remove_prefix(3);
+    }
 
     util::OnScopeExit cleanup{nullptr};
     if (!config::charconv || locale_ != "C") {
@@ -661,44 +820,43 @@ std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
         cleanup.setAction([prev]() { std::setlocale(LC_ALL, prev.c_str()); });
     }
 
-    std::string content{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
-    std::string_view trimmed{content};
-    if (auto pos = trimmed.find_last_not_of(" \f\n\r\t\v"); pos != std::string_view::npos) {
-        trimmed = trimmed.substr(0, pos + 1);
+    if (auto pos = content.find_last_not_of(" \f\n\r\t\v"); pos != std::string_view::npos) {
+        content = content.substr(0, pos + 1);
     }
 
-    std::vector<std::pair<std::string_view, size_t>> rows;
-    util::parse(trimmed, "\n", std::nullopt, std::nullopt,
-                [&](std::string_view line, [[maybe_unused]] size_t index, size_t lineNumber) {
-                    if (!skipRow(line, lineNumber, true)) {
-                        rows.emplace_back(line, lineNumber);
-                    }
-                });
-
-    if (rows.empty()) {
+    // find the first row
+    std::string_view firstRow;
+    size_t firstRowLine = 0;
+    const auto [next, nextLine] =
+        util::forEachRow(content, 1, [&](std::string_view row, size_t lineNumber) {
+            if (skipRow(row, lineNumber, true)) return true;
+            firstRow = row;
+            firstRowLine = lineNumber;
+            return false;
+        });
+
+    if (firstRowLine == 0) {
         throw DataReaderException("No data", IVW_CONTEXT);
     }
 
     // extract first row
     std::vector<std::string> headers;
-    util::parse(rows.front().first, delimiters_, std::nullopt, rows.front().second,
+    util::parse(firstRow, delimiters_, std::nullopt, firstRowLine,
                 [&](std::string_view cell, [[maybe_unused]] size_t index,
                     [[maybe_unused]] size_t partNumber) {
                     headers.emplace_back(stripQuotes_ ? util::stripQuotes(cell) : cell);
                     return true;
                 });
 
-    if (firstRowHeader_) {
-        rows.erase(rows.begin());
-    } else {
+    if (!firstRowHeader_) {
         for (auto&& [i, header] : util::enumerate(headers)) {
             header = fmt::format("Column {}", i + 1);
         }
     }
+    const auto data = firstRowHeader_ ? content.substr(next) : content;
+    const size_t dataLine = firstRowHeader_ ? nextLine : 1;
 
-    // Construct Data Frame
-    auto df = std::make_shared<DataFrame>();
-    auto types = findCellTypes(headers.size(), rows, exampleRows_);
+    auto types = findCellTypes(headers.size(), data, dataLine, exampleRows_);
     if (firstColIndices_) {
         if (!types.empty() && types.front().string == 0 && types.front().real == 0) {
             types.front().index = true;
@@ -706,17 +864,42 @@ std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
             throw Exception("Unable to use first column as index, invalid data found");
         }
     }
-    const auto appenders = addColumns(*df, types, headers);
-
-    for (const auto& [row, lineNumber] : rows) {
-        if (!skipRow(row, lineNumber, false)) {
-            util::parse(row, delimiters_, headers.size(), lineNumber,
-                        [&, l = lineNumber](std::string_view cell, size_t index,
-                                            [[maybe_unused]] size_t part) {
-                            appenders[index](cell, l, index + 1);
-                        });
-        }
-    }
+
+    // Without a header all filters are applied to all rows
+    const auto skipDataRow = [&](std::string_view row, size_t lineNumber) {
+        return skipRow(row, lineNumber, true) ||
+               (firstRowHeader_ && skipRow(row, lineNumber, false));
+    };
+
+    // Parse the chunks into separate data frames and concatenate them in order
+    const auto chunks = util::splitRows(data, dataLine, chunkSize_);
+    std::shared_ptr<DataFrame> df;
+    util::forEachChunk(
+        chunks.size(),
+        [&](size_t i) {
+            DataFrame part;
+            const auto appenders = addColumns(part, types, headers);
+            util::forEachRow(chunks[i].data, chunks[i].firstLine,
+                             [&](std::string_view row, size_t lineNumber) {
+                                 if (skipDataRow(row, lineNumber)) return true;
+                                 util::parse(row, delimiters_, headers.size(), lineNumber,
+                                             [&](std::string_view cell, size_t index,
+                                                 [[maybe_unused]] size_t partNumber) {
+                                                 appenders[index](cell, lineNumber, index + 1);
+                                             });
+                                 return true;
+                             });
+            return part;
+        },
+        [&](DataFrame part) {
+            if (!df) {
+                df = std::make_shared<DataFrame>(std::move(part));
+            } else {
+                for (size_t col = 0; col < df->getNumberOfColumns(); ++col) {
+                    df->getColumn(col)->append(*part.getColumn(col));
+                }
+            }
+        });
 
     if (!firstColIndices_) {
         df->updateIndexBuffer();
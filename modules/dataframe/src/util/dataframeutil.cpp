@@ -35,13 +35,15 @@
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>       // for BufferRAMPrecision
 #include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
+#include <inviwo/core/network/processornetworkevaluator.h>              // for ProcessorNetworkE...
+#include <inviwo/core/processors/processor.h>                           // for Processor
 #include <inviwo/core/util/assertion.h>                                 // for IVW_ASSERT
 #include <inviwo/core/util/document.h>                                  // for Document, TableBu...
 #include <inviwo/core/util/exception.h>                                 // for Exception
+#include <inviwo/core/util/foreach.h>                                   // for forEachParallel
 #include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
 #include <inviwo/core/util/formats.h>                                   // for DataFormatBase
 #include <inviwo/core/util/glmvec.h>                                    // for ivec2
-#include <inviwo/core/util/iterrange.h>                                 // for iter_range, as_range
 #include <inviwo/core/util/sourcecontext.h>                             // for IVW_CONTEXT_CUSTOM
 #include <inviwo/core/util/stdextensions.h>                             // for transform, contains
 #include <inviwo/core/util/stringconversion.h>                          // for toLower
@@ -50,22 +52,27 @@
 #include <inviwo/dataframe/datastructures/column.h>                     // for CategoricalColumn
 #include <inviwo/dataframe/datastructures/dataframe.h>                  // for DataFrame
 #include <inviwo/dataframe/util/filters.h>                              // for ItemFilter, Filters
+#include <inviwo/dataframe/util/join.h>                                 // for matchingRows, Joi...
 
-#include <algorithm>      // for any_of
+#include <algorithm>      // for min, fill
+#include <array>          // for array
+#include <cmath>          // for abs
 #include <functional>     // for function
 #include <iterator>       // for distance
 #include <map>            // for operator==, map
+#include <numeric>        // for iota, accumulate
 #include <optional>       // for optional
+#include <span>           // for span
 #include <string_view>    // for string_view, oper...
+#include <type_traits>    // for conditional_t, is_integral_v
 #include <unordered_map>  // for operator==, unord...
 #include <utility>        // for move, pair
-#include <variant>        // for visit
+#include <variant>        // for get_if
 
-#include <fmt/core.h>        // for format, basic_str...
-#include <glm/gtx/hash.hpp>  // for hash<>::operator()
-#include <glm/vec2.hpp>      // for operator==, opera...
-#include <glm/vec3.hpp>      // for operator==, opera...
-#include <glm/vec4.hpp>      // for operator==, opera...
+#include <fmt/core.h>    // for format, basic_str...
+#include <glm/vec2.hpp>  // for operator==, opera...
+#include <glm/vec3.hpp>  // for operator==, opera...
+#include <glm/vec4.hpp>  // for operator==, opera...
 
 namespace inviwo {
 
@@ -185,129 +192,11 @@ std::shared_ptr<DataFrame> appendRows(const DataFrame& top, const DataFrame& bot
 
 namespace detail {
 
-void columnCheck(const DataFrame& left, const DataFrame& right,
-                 const std::vector<std::pair<std::string, std::string>>& keyColumns,
-                 const std::string& context) {
-    for (const auto& [leftCol, rightCol] : keyColumns) {
-        auto indexCol1 = left.getColumn(leftCol);
-        auto indexCol2 = right.getColumn(rightCol);
-        if (!indexCol1) {
-            throw Exception(IVW_CONTEXT_CUSTOM(context),
-                            "key column '{}' missing in the left data frame", leftCol);
-        }
-        if (!indexCol2) {
-            throw Exception(IVW_CONTEXT_CUSTOM(context),
-                            "key column '{}' missing in the right data frame", rightCol);
-        }
-
-        const bool catcol1 = indexCol1->getColumnType() == ColumnType::Categorical;
-        const bool catcol2 = indexCol2->getColumnType() == ColumnType::Categorical;
-        // check only for categorical types and do not compare column types directly.
-        // This enables combining a regular column with an index column, e.g. for indexing.
-        if (catcol1 != catcol2) {
-            throw Exception(IVW_CONTEXT_CUSTOM(context),
-                            "column type mismatch in key columns '{}' = {}, '{}' = {}", leftCol,
-                            indexCol1->getColumnType(), rightCol, indexCol2->getColumnType());
-        }
-
-        if (indexCol1->getBuffer()->getDataFormat()->getId() !=
-            indexCol2->getBuffer()->getDataFormat()->getId()) {
-            throw Exception(IVW_CONTEXT_CUSTOM(context),
-                            "format mismatch in key columns '{}' = {}, '{}' = {}", leftCol,
-                            indexCol1->getBuffer()->getDataFormat()->getString(), rightCol,
-                            indexCol2->getBuffer()->getDataFormat()->getString());
-        }
-    }
-}
-
-template <typename T, bool firstMatchOnly, typename Cont>
-std::vector<std::vector<std::uint32_t>> matchingRows(const Cont& left, const Cont& right) {
-    std::unordered_map<T, std::vector<std::uint32_t>> matches;
-    for (auto&& [r, value] : util::enumerate<std::uint32_t>(right)) {
-        if constexpr (firstMatchOnly) {
-            if (matches.find(value) == matches.end()) {
-                matches[value].push_back(r);
-            }
-        } else {
-            matches[value].push_back(r);
-        }
-    }
-    std::vector<std::vector<std::uint32_t>> rows(std::distance(left.begin(), left.end()));
-    for (auto&& [i, key] : util::enumerate<std::uint32_t>(left)) {
-        rows[i] = matches[key];
-    }
-    return rows;
-}
-
-/**
- * \brief for each row in leftCol return a list of matching row indices in rightCol
- */
-template <bool firstMatchOnly = false>
-std::vector<std::vector<std::uint32_t>> getMatchingRows(std::shared_ptr<const Column> leftCol,
-                                                        std::shared_ptr<const Column> rightCol) {
-    if (auto catCol1 = dynamic_cast<const CategoricalColumn*>(leftCol.get())) {
-        // need to match values of categorical columns instead of indices stored in buffer
-        auto catCol2 = dynamic_cast<const CategoricalColumn*>(rightCol.get());
-        IVW_ASSERT(catCol2, "right column is not categorical");
-
-        return matchingRows<std::string_view, firstMatchOnly>(*catCol1, *catCol2);
-    } else {
-        using retval = std::vector<std::vector<std::uint32_t>>;
-
-        return leftCol->getBuffer()->getRepresentation<BufferRAM>()->dispatch<retval>(
-            [rightBuffer = rightCol->getBuffer()](auto typedBuf) {
-                using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
-
-                const auto& left = typedBuf->getDataContainer();
-                const auto& right = static_cast<const BufferRAMPrecision<ValueType>*>(
-                                        rightBuffer->getRepresentation<BufferRAM>())
-                                        ->getDataContainer();
-
-                return matchingRows<ValueType, firstMatchOnly>(left, right);
-            });
-    }
-}
-
-std::vector<std::vector<std::uint32_t>> getMatchingRows(
-    const DataFrame& left, const DataFrame& right,
-    const std::vector<std::pair<std::string, std::string>>& keyColumns) {
-
-    auto indexCol1 = left.getColumn(keyColumns.front().first);
-    auto indexCol2 = right.getColumn(keyColumns.front().second);
-
-    auto rows = detail::getMatchingRows(indexCol1, indexCol2);
-    // narrow down row selection by filtering with remaining keys
-    for (auto&& [leftName, rightName] : util::as_range(keyColumns.begin() + 1, keyColumns.end())) {
-        auto leftCol = left.getColumn(leftName);
-        auto rightCol = right.getColumn(rightName);
-
-        if (auto catCol1 = dynamic_cast<const CategoricalColumn*>(leftCol.get())) {
-            auto catCol2 = dynamic_cast<const CategoricalColumn*>(rightCol.get());
-            IVW_ASSERT(catCol2, "right column is not categorical");
-
-            auto valuesLeftIt = catCol1->begin();
-            auto valuesRightIt = catCol2->begin();
-            for (auto&& [i, rowMatches] : util::enumerate<std::uint32_t>(rows)) {
-                std::erase_if(rowMatches, [key = *(valuesLeftIt + i), valuesRightIt](auto row) {
-                    return key != *(valuesRightIt + row);
-                });
-            }
-        } else {
-            leftCol->getBuffer()->getRepresentation<BufferRAM>()->dispatch<void>(
-                [&rows, rightBuffer = rightCol->getBuffer()](auto typedBuf) {
-                    using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
-
-                    const auto& left = typedBuf->getDataContainer();
-                    const auto& right = static_cast<const BufferRAMPrecision<ValueType>*>(
-                                            rightBuffer->getRepresentation<BufferRAM>())
-                                            ->getDataContainer();
-
-                    for (auto&& [i, rowMatches] : util::enumerate(rows)) {
-                        std::erase_if(rowMatches, [key = left[i], &right](auto row) {
-                            return key != right[row];
-                        });
-                    }
-                });
+std::vector<std::optional<std::uint32_t>> firstMatches(const JoinMatches& matches) {
+    std::vector<std::optional<std::uint32_t>> rows(matches.size());
+    for (size_t i = 0; i < matches.size(); ++i) {
+        if (const auto rowIndices = matches[i]; !rowIndices.empty()) {
+            rows[i] = rowIndices.front();
         }
     }
     return rows;
@@ -364,17 +253,13 @@ void addColumns(std::shared_ptr<DataFrame> dst, const DataFrame& srcDataFrame,
 
 std::shared_ptr<DataFrame> innerJoin(const DataFrame& left, const DataFrame& right,
                                      const std::pair<std::string, std::string>& keyColumn) {
-    detail::columnCheck(left, right, {keyColumn}, "dataframe::innerJoin");
-
-    auto indexCol1 = left.getColumn(keyColumn.first);
-    auto indexCol2 = right.getColumn(keyColumn.second);
+    const auto matches = matchingRows(left, right, {keyColumn}, JoinMatch::First);
 
     std::vector<std::uint32_t> rowsLeft;
     std::vector<std::uint32_t> rowsRight;
-    for (auto&& [i, rowIndices] :
-         util::enumerate<std::uint32_t>(detail::getMatchingRows<true>(indexCol1, indexCol2))) {
-        if (!rowIndices.empty()) {
-            rowsLeft.push_back(i);
+    for (size_t i = 0; i < matches.size(); ++i) {
+        if (const auto rowIndices = matches[i]; !rowIndices.empty()) {
+            rowsLeft.push_back(static_cast<std::uint32_t>(i));
             rowsRight.push_back(rowIndices.front());
         }
     }
@@ -394,18 +279,13 @@ std::shared_ptr<DataFrame> innerJoin(
     const DataFrame& left, const DataFrame& right,
     const std::vector<std::pair<std::string, std::string>>& keyColumns) {
 
-    if (keyColumns.empty()) {
-        throw Exception("no key columns given", IVW_CONTEXT_CUSTOM("dataframe::innerJoin"));
-    }
-
-    detail::columnCheck(left, right, keyColumns, "dataframe::innerJoin");
+    const auto matches = matchingRows(left, right, keyColumns, JoinMatch::First);
 
     std::vector<std::uint32_t> rowsLeft;
     std::vector<std::uint32_t> rowsRight;
-    for (auto&& [i, rowIndices] :
-         util::enumerate<std::uint32_t>(detail::getMatchingRows(left, right, keyColumns))) {
-        if (!rowIndices.empty()) {
-            rowsLeft.push_back(i);
+    for (size_t i = 0; i < matches.size(); ++i) {
+        if (const auto rowIndices = matches[i]; !rowIndices.empty()) {
+            rowsLeft.push_back(static_cast<std::uint32_t>(i));
             rowsRight.push_back(rowIndices.front());
         }
     }
@@ -430,22 +310,10 @@ std::shared_ptr<DataFrame> innerJoin(
 
 std::shared_ptr<DataFrame> leftJoin(const DataFrame& left, const DataFrame& right,
                                     const std::pair<std::string, std::string>& keyColumn) {
-    detail::columnCheck(left, right, {keyColumn}, "dataframe::leftJoin");
+    const auto rows =
+        detail::firstMatches(matchingRows(left, right, {keyColumn}, JoinMatch::First));
 
-    auto indexCol1 = left.getColumn(keyColumn.first);
-    auto indexCol2 = right.getColumn(keyColumn.second);
-
-    auto rows = util::transform(
-        detail::getMatchingRows<true>(indexCol1, indexCol2),
-        [](const std::vector<std::uint32_t>& rowIndices) -> std::optional<std::uint32_t> {
-            if (rowIndices.empty()) {
-                return {};
-            } else {
-                return rowIndices.front();
-            }
-        });
-
-    IVW_ASSERT(indexCol1->getSize() == rows.size(), "incorrect number of matching row indices");
+    IVW_ASSERT(left.getNumberOfRows() == rows.size(), "incorrect number of matching row indices");
 
     auto dataframe = std::make_shared<DataFrame>();
     dataframe->dropColumn(0);
@@ -460,21 +328,7 @@ std::shared_ptr<DataFrame> leftJoin(
     const DataFrame& left, const DataFrame& right,
     const std::vector<std::pair<std::string, std::string>>& keyColumns) {
 
-    if (keyColumns.empty()) {
-        throw Exception("no key columns given", IVW_CONTEXT_CUSTOM("dataframe::leftJoin"));
-    }
-
-    detail::columnCheck(left, right, keyColumns, "dataframe::leftJoin");
-
-    auto rows = util::transform(
-        detail::getMatchingRows(left, right, keyColumns),
-        [](const std::vector<std::uint32_t>& rowIndices) -> std::optional<std::uint32_t> {
-            if (rowIndices.empty()) {
-                return {};
-            } else {
-                return rowIndices.front();
-            }
-        });
+    const auto rows = detail::firstMatches(matchingRows(left, right, keyColumns, JoinMatch::First));
 
     std::vector<std::string> leftKeys;
     std::transform(keyColumns.begin(), keyColumns.end(), std::back_inserter(leftKeys),
@@ -574,64 +428,197 @@ std::shared_ptr<DataFrame> combineDataFrames(std::vector<std::shared_ptr<DataFra
     return newDataFrame;
 }
 
-#include <warn/push>
-#include <warn/ignore/conversion>
-std::vector<std::uint32_t> selectRows(const Column& col,
-                                      const std::vector<dataframefilters::ItemFilter>& filters) {
-    if (filters.empty()) return {};
-
-    if (col.getColumnType() == ColumnType::Categorical) {
-        const auto& catCol = dynamic_cast<const CategoricalColumn&>(col);
-        std::vector<std::uint32_t> rows;
-        for (auto&& [row, value] : util::enumerate<std::uint32_t>(catCol.values())) {
-            auto test = util::overloaded{
-                [v = value](const std::function<bool(std::string_view)>& func) { return func(v); },
-                [](const std::function<bool(int64_t)>&) { return false; },
-                [](const std::function<bool(double)>&) { return false; }};
-            auto op = [&](const auto& f) { return std::visit(test, f.filter); };
-            if (std::any_of(filters.begin(), filters.end(), op)) {
-                rows.push_back(row);
+namespace detail {
+
+// rows are evaluated in blocks, with one byte per row holding the result of the filters
+constexpr size_t filterBlockSize = 4096;
+// number of rows evaluated per task, matches the size of the containers of a BitSet
+constexpr size_t filterTaskSize = size_t{1} << 16;
+
+/**
+ * Evaluates a filter for the rows [begin, begin + mask.size()) and combines the results with
+ * \p mask using a bitwise or.
+ */
+using FilterKernel = std::function<void(size_t begin, std::span<std::uint8_t> mask)>;
+
+template <typename T, typename Pred>
+FilterKernel filterKernel(const std::vector<T>& data, Pred pred) {
+    return [&data, pred](size_t begin, std::span<std::uint8_t> mask) {
+        const T* values = data.data() + begin;
+        for (size_t i = 0; i < mask.size(); ++i) {
+            mask[i] |= static_cast<std::uint8_t>(pred(values[i]));
+        }
+    };
+}
+
+template <typename T, typename U>
+FilterKernel compareKernel(const std::vector<T>& data, const filters::NumberCompare<U>& compare) {
+    // the items are converted to U before comparing, as when calling the filter function
+    const auto v = compare.value;
+    const auto eps = compare.epsilon;
+    switch (compare.op) {
+        case filters::NumberComp::Equal:
+        default:
+            if constexpr (std::is_integral_v<U>) {
+                return filterKernel(data, [v](T x) { return static_cast<U>(x) == v; });
+            } else {
+                return filterKernel(
+                    data, [v, eps](T x) { return std::abs(static_cast<U>(x) - v) <= eps; });
+            }
+        case filters::NumberComp::NotEqual:
+            if constexpr (std::is_integral_v<U>) {
+                return filterKernel(data, [v](T x) { return static_cast<U>(x) != v; });
+            } else {
+                return filterKernel(
+                    data, [v, eps](T x) { return std::abs(static_cast<U>(x) - v) > eps; });
             }
+        case filters::NumberComp::Less:
+            return filterKernel(data, [v](T x) { return static_cast<U>(x) < v; });
+        case filters::NumberComp::LessEqual:
+            return filterKernel(data, [v](T x) { return static_cast<U>(x) <= v; });
+        case filters::NumberComp::Greater:
+            return filterKernel(data, [v](T x) { return static_cast<U>(x) > v; });
+        case filters::NumberComp::GreaterEqual:
+            return filterKernel(data, [v](T x) { return static_cast<U>(x) >= v; });
+    }
+}
+
+template <typename T, typename U>
+FilterKernel rangeKernel(const std::vector<T>& data, const filters::NumberRange<U>& range) {
+    return filterKernel(data, [min = range.min, max = range.max](T x) {
+        const auto value = static_cast<U>(x);
+        return (value >= min) & (value <= max);
+    });
+}
+
+/**
+ * Compile \p filter into a kernel for a column holding \p data. Integral columns are matched by
+ * integer filters and floating point columns by double filters. Filters with a known predicate are
+ * turned into comparison loops the compiler can vectorize, other filters call the filter function
+ * for each item.
+ *
+ * @return the kernel or std::nullopt if the filter never matches items of type T
+ */
+template <typename T>
+std::optional<FilterKernel> compileFilter(const std::vector<T>& data,
+                                          const dataframefilters::ItemFilter& filter) {
+    using U = std::conditional_t<std::is_integral_v<T>, std::int64_t, double>;
+    if constexpr (std::is_integral_v<T> || std::is_floating_point_v<T>) {
+        if (auto compare = std::get_if<filters::NumberCompare<U>>(&filter.predicate)) {
+            return compareKernel(data, *compare);
+        } else if (auto range = std::get_if<filters::NumberRange<U>>(&filter.predicate)) {
+            return rangeKernel(data, *range);
+        } else if (auto func = std::get_if<std::function<bool(U)>>(&filter.filter)) {
+            return filterKernel(data, [func = *func](T x) { return func(static_cast<U>(x)); });
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * Compile \p filter into a kernel for categorical column \p col. The filter function is called
+ * once per category and the rows look up the result of their category.
+ */
+std::optional<FilterKernel> compileFilter(const CategoricalColumn& col,
+                                          const dataframefilters::ItemFilter& filter) {
+    auto func = std::get_if<std::function<bool(std::string_view)>>(&filter.filter);
+    if (!func) return std::nullopt;
+
+    auto lookup = util::transform(col.getCategories(), [&](const std::string& category) {
+        return static_cast<std::uint8_t>((*func)(category));
+    });
+    const auto& indices = col.getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+    return [&indices, lookup = std::move(lookup)](size_t begin, std::span<std::uint8_t> mask) {
+        const auto* values = indices.data() + begin;
+        for (size_t i = 0; i < mask.size(); ++i) {
+            mask[i] |= lookup[values[i]];
+        }
+    };
+}
+
+void compileFilters(const Column& col, const std::vector<dataframefilters::ItemFilter>& filters,
+                    std::vector<FilterKernel>& kernels) {
+    if (filters.empty()) return;
+
+    if (auto catCol = dynamic_cast<const CategoricalColumn*>(&col)) {
+        for (const auto& filter : filters) {
+            if (auto kernel = compileFilter(*catCol, filter)) kernels.push_back(std::move(*kernel));
         }
-        return rows;
     } else {
-        return col.getBuffer()
+        col.getBuffer()
             ->getRepresentation<BufferRAM>()
-            ->dispatch<std::vector<std::uint32_t>, dispatching::filter::Scalars>(
-                [filters](auto typedBuf) {
-                    using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
-                    std::vector<std::uint32_t> rows;
-                    for (auto&& [row, value] :
-                         util::enumerate<std::uint32_t>(typedBuf->getDataContainer())) {
-                        auto test = util::overloaded{
-                            [&v = value](
-                                [[maybe_unused]] const std::function<bool(std::int64_t)>& func) {
-                                if constexpr (std::is_integral_v<ValueType>) {
-                                    return func(static_cast<std::int64_t>(v));
-                                } else {
-                                    (void)v;
-                                    return false;
-                                }
-                            },
-                            [v = value]([[maybe_unused]] const std::function<bool(double)>& func) {
-                                if constexpr (std::is_floating_point_v<ValueType>) {
-                                    return func(v);
-                                } else {
-                                    (void)v;
-                                    return false;
-                                }
-                            },
-                            [](const std::function<bool(std::string_view)>&) { return false; }};
-                        auto op = [&](const auto& f) { return std::visit(test, f.filter); };
-                        if (std::any_of(filters.begin(), filters.end(), op)) {
-                            rows.push_back(row);
-                        }
+            ->dispatch<void, dispatching::filter::Scalars>([&](auto typedBuf) {
+                const auto& data = typedBuf->getDataContainer();
+                for (const auto& filter : filters) {
+                    if (auto kernel = compileFilter(data, filter)) {
+                        kernels.push_back(std::move(*kernel));
                     }
-                    return rows;
-                });
+                }
+            });
+    }
+}
+
+/**
+ * Evaluate the filter kernels for \p rows rows in parallel and return the rows matching any of the
+ * \p include kernels and none of the \p exclude kernels. The kernels of each block of rows are
+ * combined using bitwise operations on byte masks, which are then compacted into row indices.
+ */
+std::vector<std::uint32_t> evaluateFilters(size_t rows, const std::vector<FilterKernel>& include,
+                                           const std::vector<FilterKernel>& exclude) {
+    if (include.empty()) return {};
+
+    std::vector<size_t> tasks((rows + filterTaskSize - 1) / filterTaskSize);
+    std::iota(tasks.begin(), tasks.end(), size_t{0});
+    std::vector<std::vector<std::uint32_t>> selected(tasks.size());
+    util::forEachParallel(tasks, [&](size_t task) {
+        std::array<std::uint8_t, filterBlockSize> includeMask;
+        std::array<std::uint8_t, filterBlockSize> excludeMask;
+        auto& result = selected[task];
+
+        const size_t taskEnd = std::min(rows, (task + 1) * filterTaskSize);
+        for (size_t begin = task * filterTaskSize; begin < taskEnd; begin += filterBlockSize) {
+            const size_t size = std::min(filterBlockSize, taskEnd - begin);
+            const std::span<std::uint8_t> mask{includeMask.data(), size};
+            std::fill(mask.begin(), mask.end(), std::uint8_t{0});
+            for (const auto& kernel : include) kernel(begin, mask);
+
+            if (!exclude.empty()) {
+                const std::span<std::uint8_t> excluded{excludeMask.data(), size};
+                std::fill(excluded.begin(), excluded.end(), std::uint8_t{0});
+                for (const auto& kernel : exclude) kernel(begin, excluded);
+                for (size_t i = 0; i < size; ++i) {
+                    mask[i] &= static_cast<std::uint8_t>(excluded[i] ^ 1);
+                }
+            }
+
+            const auto offset = result.size();
+            result.resize(offset + size);
+            size_t count = 0;
+            for (size_t i = 0; i < size; ++i) {
+                result[offset + count] = static_cast<std::uint32_t>(begin + i);
+                count += mask[i];
+            }
+            result.resize(offset + count);
+        }
+    });
+
+    std::vector<std::uint32_t> result;
+    result.reserve(std::accumulate(selected.begin(), selected.end(), size_t{0},
+                                   [](size_t sum, const auto& v) { return sum + v.size(); }));
+    for (const auto& rowIndices : selected) {
+        result.insert(result.end(), rowIndices.begin(), rowIndices.end());
     }
+    return result;
+}
+
+}  // namespace detail
+
+std::vector<std::uint32_t> selectRows(const Column& col,
+                                      const std::vector<dataframefilters::ItemFilter>& filters) {
+    std::vector<detail::FilterKernel> kernels;
+    detail::compileFilters(col, filters, kernels);
+    return detail::evaluateFilters(col.getSize(), kernels, {});
 }
-#include <warn/pop>
 
 std::vector<std::uint32_t> selectRows(const DataFrame& dataframe,
                                       dataframefilters::Filters filters) {
@@ -649,20 +636,14 @@ std::vector<std::uint32_t> selectRows(const DataFrame& dataframe,
         return {seq.begin(), seq.end()};
     }
 
-    if (filterCols.size() == 1) {
-        const auto& col = *dataframe.getColumn(filterCols.begin()->first).get();
-        return (BitSet(selectRows(col, filterCols.begin()->second.include)) -
-                BitSet(selectRows(col, filterCols.begin()->second.exclude)))
-            .toVector();
-    }
-    BitSet include;
-    BitSet exclude;
+    std::vector<detail::FilterKernel> include;
+    std::vector<detail::FilterKernel> exclude;
     for (auto&& [colIndex, f] : filterCols) {
-        const auto& col = *dataframe.getColumn(colIndex).get();
-        include.add(selectRows(col, f.include));
-        exclude.add(selectRows(col, f.exclude));
+        const auto& col = *dataframe.getColumn(colIndex);
+        detail::compileFilters(col, f.include, include);
+        detail::compileFilters(col, f.exclude, exclude);
     }
-    return (include - exclude).toVector();
+    return detail::evaluateFilters(dataframe.getNumberOfRows(), include, exclude);
 }
 
 std::string createToolTipForRow(const DataFrame& dataframe, size_t rowId) {
@@ -679,6 +660,47 @@ std::string createToolTipForRow(const DataFrame& dataframe, size_t rowId) {
     return doc;
 }
 
+std::shared_ptr<DataFrame> createFromEvaluationMetrics(const ProcessorNetworkEvaluator& evaluator) {
+    std::vector<std::pair<const Processor*, const ProcessorMetrics*>> processors;
+    for (const auto& [processor, metrics] : evaluator.getMetrics()) {
+        processors.emplace_back(processor, &metrics);
+    }
+    std::ranges::sort(processors, std::less<>{}, [](const auto& item) {
+        return std::string_view{item.first->getIdentifier()};
+    });
+
+    std::vector<std::string> identifiers;
+    std::vector<std::uint32_t> evaluations;
+    std::vector<double> process;
+    std::vector<double> onChange;
+    std::vector<double> initializeResources;
+    std::vector<double> invalid;
+    for (const auto& [processor, metrics] : processors) {
+        // the history only keeps the latest samples, number them by the total evaluation count
+        auto evaluation =
+            static_cast<std::uint32_t>(metrics->evaluations - metrics->history.size());
+        for (const auto& sample : metrics->history) {
+            identifiers.push_back(processor->getIdentifier());
+            evaluations.push_back(evaluation++);
+            process.push_back(sample.process);
+            onChange.push_back(sample.onChange);
+            initializeResources.push_back(sample.initializeResources);
+            invalid.push_back(sample.invalid);
+        }
+    }
+
+    auto dataframe = std::make_shared<DataFrame>(static_cast<std::uint32_t>(identifiers.size()));
+    dataframe->addCategoricalColumn("Processor", identifiers);
+    dataframe->addColumn("Evaluation", std::move(evaluations));
+    const Unit ms = units::precise::ms;
+    dataframe->addColumn("Process", std::move(process), ms);
+    dataframe->addColumn("OnChange", std::move(onChange), ms);
+    dataframe->addColumn("InitializeResources", std::move(initializeResources), ms);
+    dataframe->addColumn("Invalid", std::move(invalid), ms);
+    dataframe->updateIndexBuffer();
+    return dataframe;
+}
+
 }  // namespace dataframe
 
 }  // namespace inviwo
@@ -66,9 +66,9 @@ namespace detail {
 
 template <typename T>
 ItemFilter epsilonComparison(int column, filters::NumberComp op, T value, T epsilon) {
-    auto createFilter = [v = value, column](auto comp) {
+    auto createFilter = [v = value, column, op, epsilon](auto comp) {
         return ItemFilter{std::function<bool(T)>([v, comp](T value) { return comp(value, v); }),
-                          column, false};
+                          column, false, NumberCompare<T>{op, v, epsilon}};
     };
 
     switch (op) {
@@ -76,12 +76,12 @@ ItemFilter epsilonComparison(int column, filters::NumberComp op, T value, T epsi
             return ItemFilter{std::function<bool(T)>([v = value, eps = epsilon](T value) {
                                   return std::abs(value - v) <= eps;
                               }),
-                              column, false};
+                              column, false, NumberCompare<T>{op, value, epsilon}};
         case filters::NumberComp::NotEqual:
             return ItemFilter{std::function<bool(T)>([v = value, eps = epsilon](T value) {
                                   return std::abs(value - v) > eps;
                               }),
-                              column, false};
+                              column, false, NumberCompare<T>{op, value, epsilon}};
         case filters::NumberComp::Less:
             return createFilter(std::less<T>());
         case filters::NumberComp::LessEqual:
@@ -91,10 +91,11 @@ ItemFilter epsilonComparison(int column, filters::NumberComp op, T value, T epsi
         case filters::NumberComp::GreaterEqual:
             return createFilter(std::greater_equal<T>());
         default:
-            return ItemFilter{std::function<bool(T)>([v = value, eps = epsilon](T value) {
-                                  return std::abs(value - v) <= eps;
-                              }),
-                              column, false};
+            return ItemFilter{
+                std::function<bool(T)>([v = value, eps = epsilon](T value) {
+                    return std::abs(value - v) <= eps;
+                }),
+                column, false, NumberCompare<T>{filters::NumberComp::Equal, value, epsilon}};
     }
 }
 
@@ -102,16 +103,16 @@ template <typename T>
 ItemFilter rangeComparison(int column, T min, T max) {
     return ItemFilter{
         std::function<bool(T)>([min, max](T value) { return (value >= min) && (value <= max); }),
-        column, false};
+        column, false, NumberRange<T>{min, max}};
 }
 
 }  // namespace detail
 
 ItemFilter intMatch(int column, filters::NumberComp op, std::int64_t value) {
-    auto createFilter = [v = value, column](auto comp) {
+    auto createFilter = [v = value, column, op](auto comp) {
         return ItemFilter{std::function<bool(std::int64_t)>(
                               [v, comp](std::int64_t value) { return comp(value, v); }),
-                          column, false};
+                          column, false, NumberCompare<std::int64_t>{op, v, 0}};
     };
 
     switch (op) {
@@ -0,0 +1,534 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/util/join.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>              // for BufferBase, Buffer
+#include <inviwo/core/datastructures/buffer/bufferram.h>           // for BufferRAM
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>  // for BufferRAMPrecision
+#include <inviwo/core/util/exception.h>                            // for Exception
+#include <inviwo/core/util/formatdispatching.h>                    // for PrecisionValueType
+#include <inviwo/core/util/formats.h>                              // for DataFormatBase
+#include <inviwo/core/util/glmcomp.h>                              // for glmcomp
+#include <inviwo/core/util/glmutils.h>                             // for extent, value_type
+#include <inviwo/core/util/raiiutils.h>                            // for OnScopeExit
+#include <inviwo/core/util/sourcecontext.h>                        // for IVW_CONTEXT_CUSTOM
+#include <inviwo/core/util/threadutil.h>                           // for dispatchPool
+#include <inviwo/core/util/zip.h>                                  // for enumerate
+#include <inviwo/dataframe/datastructures/column.h>                // for CategoricalColumn
+#include <inviwo/dataframe/datastructures/dataframe.h>             // for DataFrame
+
+#include <algorithm>      // for min, max, is_sorted, equal
+#include <array>          // for array
+#include <bit>            // for bit_ceil
+#include <cmath>          // for isnan
+#include <cstring>        // for memcpy
+#include <future>         // for future
+#include <limits>         // for numeric_limits
+#include <numeric>        // for partial_sum, iota
+#include <optional>       // for optional
+#include <span>           // for span
+#include <string_view>    // for string_view
+#include <type_traits>    // for is_integral_v, is_floating_point_v
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for exchange, move
+
+#include <fmt/core.h>  // for format
+
+namespace inviwo {
+
+namespace dataframe {
+
+namespace {
+
+constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+// rows are not split into ranges smaller than this for parallel processing
+constexpr size_t minRangeSize = 16384;
+
+size_t numberOfRanges(size_t count, size_t grain) {
+    return std::max<size_t>(1, std::min(4 * util::getPoolSize(), count / grain));
+}
+
+/**
+ * Calls @p func(range, begin, end) for numberOfRanges(@p count, @p grain) consecutive ranges
+ * covering [0, @p count) on the thread pool, or serially if there is no pool. Returns once all
+ * ranges are done. @p func must not throw.
+ */
+template <typename Func>
+void forEachRange(size_t count, size_t grain, Func&& func) {
+    const auto ranges = numberOfRanges(count, grain);
+    if (ranges == 1) {
+        func(size_t{0}, size_t{0}, count);
+        return;
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(ranges);
+    // the tasks reference data of the caller, make sure they are all done before returning
+    const util::OnScopeExit waitForAll{[&]() {
+        for (const auto& future : futures) {
+            util::getThreadPool().wait(future);
+        }
+    }};
+    for (size_t range = 0; range < ranges; ++range) {
+        futures.push_back(util::dispatchPool([&func, range, begin = count * range / ranges,
+                                              end = count * (range + 1) / ranges]() {
+            func(range, begin, end);
+        }));
+    }
+}
+
+/// splitmix64 finalizer
+constexpr std::uint64_t mix(std::uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+}
+
+void columnCheck(const DataFrame& left, const DataFrame& right,
+                 const std::vector<std::pair<std::string, std::string>>& keyColumns,
+                 const std::string& context) {
+    for (const auto& [leftCol, rightCol] : keyColumns) {
+        auto indexCol1 = left.getColumn(leftCol);
+        auto indexCol2 = right.getColumn(rightCol);
+        if (!indexCol1) {
+            throw Exception(IVW_CONTEXT_CUSTOM(context),
+                            "key column '{}' missing in the left data frame", leftCol);
+        }
+        if (!indexCol2) {
+            throw Exception(IVW_CONTEXT_CUSTOM(context),
+                            "key column '{}' missing in the right data frame", rightCol);
+        }
+
+        const bool catcol1 = indexCol1->getColumnType() == ColumnType::Categorical;
+        const bool catcol2 = indexCol2->getColumnType() == ColumnType::Categorical;
+        // check only for categorical types and do not compare column types directly.
+        // This enables combining a regular column with an index column, e.g. for indexing.
+        if (catcol1 != catcol2) {
+            throw Exception(IVW_CONTEXT_CUSTOM(context),
+                            "column type mismatch in key columns '{}' = {}, '{}' = {}", leftCol,
+                            indexCol1->getColumnType(), rightCol, indexCol2->getColumnType());
+        }
+
+        if (indexCol1->getBuffer()->getDataFormat()->getId() !=
+            indexCol2->getBuffer()->getDataFormat()->getId()) {
+            throw Exception(IVW_CONTEXT_CUSTOM(context),
+                            "format mismatch in key columns '{}' = {}, '{}' = {}", leftCol,
+                            indexCol1->getBuffer()->getDataFormat()->getString(), rightCol,
+                            indexCol2->getBuffer()->getDataFormat()->getString());
+        }
+    }
+}
+
+enum Side { Left = 0, Right = 1 };
+
+struct KeyColumn {
+    std::array<const Column*, 2> columns;
+    /// common codes for the categories of categorical columns, npos for unmatched categories
+    std::array<std::vector<std::uint32_t>, 2> codes;
+    size_t offset;  //!< byte offset in the composite key
+};
+
+/**
+ * Map the categories of @p left and @p right to the category indices of @p right. Categories of
+ * @p left which do not exist in @p right are mapped to npos.
+ */
+std::array<std::vector<std::uint32_t>, 2> categoryCodes(const CategoricalColumn& left,
+                                                        const CategoricalColumn& right) {
+    std::array<std::vector<std::uint32_t>, 2> codes;
+    std::unordered_map<std::string_view, std::uint32_t> lookup;
+    for (auto&& [i, category] : util::enumerate<std::uint32_t>(right.getCategories())) {
+        codes[Right].push_back(lookup.try_emplace(category, i).first->second);
+    }
+    for (const auto& category : left.getCategories()) {
+        const auto it = lookup.find(category);
+        codes[Left].push_back(it != lookup.end() ? it->second : npos);
+    }
+    return codes;
+}
+
+/**
+ * The composite keys of all rows of a DataFrame. Each key is stored in a whole number of 64-bit
+ * words, zero padded, such that keys can be compared and hashed word by word.
+ */
+struct Keys {
+    Keys(size_t rows, size_t nWords)
+        : words{nWords}, data(rows * nWords, 0), hashes(rows), valid(rows, 1) {}
+
+    const std::uint64_t* key(size_t row) const { return data.data() + row * words; }
+    size_t size() const { return hashes.size(); }
+
+    size_t words;
+    std::vector<std::uint64_t> data;
+    std::vector<std::uint64_t> hashes;
+    std::vector<std::uint8_t> valid;  //!< 0 for keys that never match, i.e. NaN or unknown category
+};
+
+void encode(Keys& keys, const Column& column, size_t offset,
+            const std::vector<std::uint32_t>& codes) {
+    auto* bytes = reinterpret_cast<std::byte*>(keys.data.data());
+    const size_t stride = keys.words * sizeof(std::uint64_t);
+
+    if (auto catCol = dynamic_cast<const CategoricalColumn*>(&column)) {
+        const auto& indices = catCol->getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+        forEachRange(indices.size(), minRangeSize, [&](size_t, size_t begin, size_t end) {
+            for (size_t row = begin; row < end; ++row) {
+                const auto code = codes[indices[row]];
+                if (code == npos) keys.valid[row] = 0;
+                std::memcpy(bytes + row * stride + offset, &code, sizeof(code));
+            }
+        });
+    } else {
+        column.getBuffer()->getRepresentation<BufferRAM>()->dispatch<void>([&](auto typedBuf) {
+            using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
+            using Comp = util::value_type_t<ValueType>;
+
+            const auto& data = typedBuf->getDataContainer();
+            forEachRange(data.size(), minRangeSize, [&](size_t, size_t begin, size_t end) {
+                for (size_t row = begin; row < end; ++row) {
+                    auto value = data[row];
+                    if constexpr (std::is_floating_point_v<Comp>) {
+                        for (size_t i = 0; i < util::extent_v<ValueType>; ++i) {
+                            auto& comp = util::glmcomp(value, i);
+                            if (std::isnan(comp)) keys.valid[row] = 0;
+                            // -0 and +0 compare equal, give them the same representation
+                            if (comp == Comp{0}) comp = Comp{0};
+                        }
+                    }
+                    std::memcpy(bytes + row * stride + offset, &value, sizeof(value));
+                }
+            });
+        });
+    }
+}
+
+Keys createKeys(const std::vector<KeyColumn>& columns, Side side, size_t words) {
+    Keys keys{columns.front().columns[side]->getSize(), words};
+    for (const auto& column : columns) {
+        encode(keys, *column.columns[side], column.offset, column.codes[side]);
+    }
+    forEachRange(keys.size(), minRangeSize, [&](size_t, size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row) {
+            std::uint64_t hash = 0;
+            for (const auto* word = keys.key(row); word != keys.key(row + 1); ++word) {
+                hash = mix(hash ^ *word);
+            }
+            keys.hashes[row] = hash;
+        }
+    });
+    return keys;
+}
+
+/**
+ * Open addressing hash table with linear probing for the keys of one partition. Each distinct key
+ * forms a group, represented by the first row with that key.
+ */
+struct HashTable {
+    std::uint32_t find(const Keys& keys, std::uint64_t hash, const std::uint64_t* key) const {
+        for (size_t slot = hash & mask;; slot = (slot + 1) & mask) {
+            const auto group = slots[slot];
+            if (group == npos) return npos;
+            const auto row = groups[group];
+            if (keys.hashes[row] == hash && std::equal(key, key + keys.words, keys.key(row))) {
+                return group;
+            }
+        }
+    }
+
+    size_t mask = 0;
+    std::vector<std::uint32_t> slots;   //!< group of each slot, npos for empty slots
+    std::vector<std::uint32_t> groups;  //!< first row of each group
+    // all rows of each group in CSR layout, only used for JoinMatch::All
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint32_t> rows;
+};
+
+/**
+ * The keys are partitioned by the upper bits of their hashes, such that the hash tables of the
+ * partitions can be built independently.
+ */
+struct HashTables {
+    size_t partition(std::uint64_t hash) const { return bits == 0 ? 0 : hash >> (64 - bits); }
+
+    size_t bits = 0;
+    std::vector<HashTable> tables;
+};
+
+HashTables build(const Keys& keys, JoinMatch match) {
+    HashTables result;
+    while ((size_t{1} << result.bits) < 4 * util::getPoolSize() &&
+           (keys.size() >> (result.bits + 1)) >= minRangeSize) {
+        ++result.bits;
+    }
+    const size_t nPartitions = size_t{1} << result.bits;
+
+    // scatter the rows into their partitions, keeping the rows of each partition in ascending order
+    const size_t nRanges = numberOfRanges(keys.size(), minRangeSize);
+    std::vector<size_t> counts(nRanges * nPartitions, 0);
+    forEachRange(keys.size(), minRangeSize, [&](size_t range, size_t begin, size_t end) {
+        auto* count = counts.data() + range * nPartitions;
+        for (size_t row = begin; row < end; ++row) {
+            if (keys.valid[row]) ++count[result.partition(keys.hashes[row])];
+        }
+    });
+    std::vector<size_t> partitionOffsets(nPartitions + 1, 0);
+    size_t sum = 0;
+    for (size_t partition = 0; partition < nPartitions; ++partition) {
+        partitionOffsets[partition] = sum;
+        for (size_t range = 0; range < nRanges; ++range) {
+            sum += std::exchange(counts[range * nPartitions + partition], sum);
+        }
+    }
+    partitionOffsets[nPartitions] = sum;
+
+    std::vector<std::uint32_t> partitioned(sum);
+    forEachRange(keys.size(), minRangeSize, [&](size_t range, size_t begin, size_t end) {
+        auto* pos = counts.data() + range * nPartitions;
+        for (size_t row = begin; row < end; ++row) {
+            if (keys.valid[row]) {
+                partitioned[pos[result.partition(keys.hashes[row])]++] =
+                    static_cast<std::uint32_t>(row);
+            }
+        }
+    });
+
+    result.tables.resize(nPartitions);
+    forEachRange(nPartitions, 1, [&](size_t, size_t begin, size_t end) {
+        for (size_t partition = begin; partition < end; ++partition) {
+            const auto rows = std::span<const std::uint32_t>{partitioned}.subspan(
+                partitionOffsets[partition],
+                partitionOffsets[partition + 1] - partitionOffsets[partition]);
+
+            auto& table = result.tables[partition];
+            table.mask = std::bit_ceil(std::max<size_t>(2 * rows.size(), 16)) - 1;
+            table.slots.assign(table.mask + 1, npos);
+
+            std::vector<std::uint32_t> rowGroups;
+            if (match == JoinMatch::All) rowGroups.reserve(rows.size());
+
+            for (const auto row : rows) {
+                const auto hash = keys.hashes[row];
+                const auto* key = keys.key(row);
+                auto slot = hash & table.mask;
+                std::uint32_t group = npos;
+                while (true) {
+                    group = table.slots[slot];
+                    if (group == npos) {
+                        group = static_cast<std::uint32_t>(table.groups.size());
+                        table.slots[slot] = group;
+                        table.groups.push_back(row);
+                        break;
+                    }
+                    const auto first = table.groups[group];
+                    if (keys.hashes[first] == hash &&
+                        std::equal(key, key + keys.words, keys.key(first))) {
+                        break;
+                    }
+                    slot = (slot + 1) & table.mask;
+                }
+                if (match == JoinMatch::All) rowGroups.push_back(group);
+            }
+
+            if (match == JoinMatch::All) {
+                table.offsets.assign(table.groups.size() + 1, 0);
+                for (const auto group : rowGroups) ++table.offsets[group + 1];
+                std::partial_sum(table.offsets.begin(), table.offsets.end(),
+                                 table.offsets.begin());
+                table.rows.resize(rows.size());
+                std::vector<std::uint32_t> pos(table.offsets.begin(), table.offsets.end() - 1);
+                for (size_t i = 0; i < rows.size(); ++i) {
+                    table.rows[pos[rowGroups[i]]++] = rows[i];
+                }
+            }
+        }
+    });
+
+    return result;
+}
+
+JoinMatches probe(const Keys& keys, const Keys& buildKeys, const HashTables& hashTables,
+                  JoinMatch match) {
+    struct Found {
+        std::uint32_t partition;
+        std::uint32_t group;
+    };
+    std::vector<Found> found(keys.size());
+
+    JoinMatches matches;
+    matches.offsets.assign(keys.size() + 1, 0);
+    forEachRange(keys.size(), minRangeSize, [&](size_t, size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row) {
+            if (!keys.valid[row]) {
+                found[row] = Found{0, npos};
+                continue;
+            }
+            const auto hash = keys.hashes[row];
+            const auto partition = hashTables.partition(hash);
+            const auto& table = hashTables.tables[partition];
+            const auto group = table.find(buildKeys, hash, keys.key(row));
+            found[row] = Found{static_cast<std::uint32_t>(partition), group};
+            if (group != npos) {
+                matches.offsets[row + 1] = match == JoinMatch::First
+                                               ? 1
+                                               : table.offsets[group + 1] - table.offsets[group];
+            }
+        }
+    });
+    std::partial_sum(matches.offsets.begin(), matches.offsets.end(), matches.offsets.begin());
+
+    matches.rows.resize(matches.offsets.back());
+    forEachRange(keys.size(), minRangeSize, [&](size_t, size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row) {
+            const auto [partition, group] = found[row];
+            if (group == npos) continue;
+            const auto& table = hashTables.tables[partition];
+            if (match == JoinMatch::First) {
+                matches.rows[matches.offsets[row]] = table.groups[group];
+            } else {
+                std::copy(table.rows.begin() + table.offsets[group],
+                          table.rows.begin() + table.offsets[group + 1],
+                          matches.rows.begin() + matches.offsets[row]);
+            }
+        }
+    });
+
+    return matches;
+}
+
+/**
+ * Match the rows of two sorted key columns by merging them. Every range of left rows locates its
+ * first key in @p right and then advances through @p right in step with its own keys.
+ */
+template <typename T>
+JoinMatches mergeJoin(const std::vector<T>& left, const std::vector<T>& right, JoinMatch match) {
+    JoinMatches matches;
+    matches.offsets.assign(left.size() + 1, 0);
+    std::vector<std::uint32_t> first(left.size());
+
+    forEachRange(left.size(), minRangeSize, [&](size_t, size_t begin, size_t end) {
+        if (begin == end) return;
+        auto it = std::lower_bound(right.begin(), right.end(), left[begin]);
+        for (size_t row = begin; row < end; ++row) {
+            const auto& key = left[row];
+            while (it != right.end() && *it < key) ++it;
+            first[row] = static_cast<std::uint32_t>(it - right.begin());
+
+            auto last = it;
+            if (match == JoinMatch::First) {
+                if (last != right.end() && *last == key) ++last;
+            } else {
+                while (last != right.end() && *last == key) ++last;
+            }
+            matches.offsets[row + 1] = static_cast<size_t>(last - it);
+        }
+    });
+    std::partial_sum(matches.offsets.begin(), matches.offsets.end(), matches.offsets.begin());
+
+    matches.rows.resize(matches.offsets.back());
+    forEachRange(left.size(), minRangeSize, [&](size_t, size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row) {
+            std::iota(matches.rows.begin() + matches.offsets[row],
+                      matches.rows.begin() + matches.offsets[row + 1], first[row]);
+        }
+    });
+
+    return matches;
+}
+
+/**
+ * Use a merge join if the key columns are integral and sorted.
+ */
+std::optional<JoinMatches> sortedMatchingRows(const Column& left, const Column& right,
+                                              JoinMatch match) {
+    if (left.getColumnType() == ColumnType::Categorical) return std::nullopt;
+
+    return left.getBuffer()->getRepresentation<BufferRAM>()->dispatch<std::optional<JoinMatches>>(
+        [&](auto typedBuf) -> std::optional<JoinMatches> {
+            using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
+            if constexpr (std::is_integral_v<ValueType>) {
+                const auto& leftData = typedBuf->getDataContainer();
+                const auto& rightData = static_cast<const BufferRAMPrecision<ValueType>*>(
+                                            right.getBuffer()->getRepresentation<BufferRAM>())
+                                            ->getDataContainer();
+                if (std::is_sorted(leftData.begin(), leftData.end()) &&
+                    std::is_sorted(rightData.begin(), rightData.end())) {
+                    return mergeJoin(leftData, rightData, match);
+                }
+            }
+            return std::nullopt;
+        });
+}
+
+}  // namespace
+
+JoinMatches matchingRows(const DataFrame& left, const DataFrame& right,
+                         const std::vector<std::pair<std::string, std::string>>& keyColumns,
+                         JoinMatch match) {
+    if (keyColumns.empty()) {
+        throw Exception("no key columns given", IVW_CONTEXT_CUSTOM("dataframe::matchingRows"));
+    }
+    columnCheck(left, right, keyColumns, "dataframe::matchingRows");
+
+    std::vector<KeyColumn> columns;
+    size_t keySize = 0;
+    for (const auto& [leftName, rightName] : keyColumns) {
+        auto& column = columns.emplace_back(KeyColumn{
+            {left.getColumn(leftName).get(), right.getColumn(rightName).get()}, {}, keySize});
+
+        if (auto leftCat = dynamic_cast<const CategoricalColumn*>(column.columns[Left])) {
+            column.codes = categoryCodes(
+                *leftCat, *static_cast<const CategoricalColumn*>(column.columns[Right]));
+            keySize += sizeof(std::uint32_t);
+        } else {
+            keySize += column.columns[Left]->getBuffer()->getDataFormat()->getSizeInBytes();
+        }
+    }
+
+    if (columns.size() == 1) {
+        if (auto matches =
+                sortedMatchingRows(*columns.front().columns[Left],
+                                   *columns.front().columns[Right], match)) {
+            return std::move(*matches);
+        }
+    }
+
+    const auto words = std::max<size_t>(1, (keySize + sizeof(std::uint64_t) - 1) /
+                                               sizeof(std::uint64_t));
+    const auto rightKeys = createKeys(columns, Right, words);
+    const auto hashTables = build(rightKeys, match);
+    const auto leftKeys = createKeys(columns, Left, words);
+    return probe(leftKeys, rightKeys, hashTables, match);
+}
+
+}  // namespace dataframe
+
+}  // namespace inviwo
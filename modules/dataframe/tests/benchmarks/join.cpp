@@ -39,12 +39,14 @@
 #include <algorithm>
 
 #include <inviwo/core/datastructures/bitset.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/zip.h>
 
 #include <inviwo/dataframe/datastructures/dataframe.h>
 #include <inviwo/dataframe/util/dataframeutil.h>
 #include <inviwo/dataframe/util/filters.h>
+#include <inviwo/dataframe/util/join.h>
 
 namespace {
 
@@ -257,6 +259,80 @@ static void SelectRowsDataFrame(benchmark::State& st) {
     }
 }
 
+const std::vector<int>& columnData(const DataFrame& df, std::string_view header) {
+    return static_cast<const BufferRAMPrecision<int>*>(
+               df.getColumn(header)->getBuffer()->getRepresentation<BufferRAM>())
+        ->getDataContainer();
+}
+
+// unique keys in the right DataFrame, roughly one match per row of the left DataFrame
+static void MatchingRowsHashMap(benchmark::State& st) {
+    const auto size = static_cast<int>(st.range(0));
+    auto left = createDataFrame(size, size);
+    auto right = createDataFrame(size, size);
+
+    for (auto _ : st) {
+        auto result = matchingRowsVector<int, false>(columnData(*left, "col1"),
+                                                     columnData(*right, "col1"));
+        benchmark::DoNotOptimize(result);
+    }
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+static void MatchingRowsHashJoin(benchmark::State& st) {
+    const auto size = static_cast<int>(st.range(0));
+    auto left = createDataFrame(size, size);
+    auto right = createDataFrame(size, size);
+    const std::vector<std::pair<std::string, std::string>> keys{{"col1", "col1"}};
+
+    for (auto _ : st) {
+        auto result = dataframe::matchingRows(*left, *right, keys);
+        benchmark::DoNotOptimize(result);
+    }
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+static void MatchingRowsHashJoinMultiKey(benchmark::State& st) {
+    const auto size = static_cast<int>(st.range(0));
+    auto left = createDataFrame(size, 100);
+    auto right = createDataFrame(size, 100);
+    const std::vector<std::pair<std::string, std::string>> keys{
+        {"col1", "col1"}, {"col2", "col2"}, {"col3", "col3"}};
+
+    for (auto _ : st) {
+        auto result = dataframe::matchingRows(*left, *right, keys);
+        benchmark::DoNotOptimize(result);
+    }
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+// index columns are sorted, hence matched by a merge join
+static void MatchingRowsMergeJoin(benchmark::State& st) {
+    const auto size = static_cast<int>(st.range(0));
+    auto left = createDataFrame(size, size);
+    auto right = createDataFrame(size, size);
+    const std::vector<std::pair<std::string, std::string>> keys{{"index", "index"}};
+
+    for (auto _ : st) {
+        auto result = dataframe::matchingRows(*left, *right, keys);
+        benchmark::DoNotOptimize(result);
+    }
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
+static void InnerJoin(benchmark::State& st) {
+    const auto size = static_cast<int>(st.range(0));
+    auto left = createDataFrame(size, size);
+    auto right = createDataFrame(size, size);
+
+    for (auto _ : st) {
+        auto result = dataframe::innerJoin(*left, *right,
+                                           std::pair<std::string, std::string>{"col1", "col1"});
+        benchmark::DoNotOptimize(result);
+    }
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+}
+
 }  // namespace
 
 // BENCHMARK(MatchingRowsPrev)->RangeMultiplier(2)->Range(8, lenRight);
@@ -267,4 +343,10 @@ static void SelectRowsDataFrame(benchmark::State& st) {
 // BENCHMARK(SelectRows)->RangeMultiplier(2)->Range(64, lenRight);
 BENCHMARK(SelectRowsDataFrame)->RangeMultiplier(2)->Range(64, lenRight);
 
+BENCHMARK(MatchingRowsHashMap)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(MatchingRowsHashJoin)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(MatchingRowsHashJoinMultiKey)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(MatchingRowsMergeJoin)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(InnerJoin)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,174 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/unitsystem.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/dataframe/io/binarydataframeformat.h>
+#include <inviwo/dataframe/io/binarydataframereader.h>
+#include <inviwo/dataframe/io/binarydataframewriter.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/datastructures/column.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace inviwo {
+
+namespace {
+
+std::string readFile(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+}
+
+void overwriteFile(util::TempFileHandle& file, const std::string& contents) {
+    std::rewind(file.getHandle());
+    std::fwrite(contents.data(), 1, contents.size(), file.getHandle());
+    std::fflush(file.getHandle());
+}
+
+nlohmann::json readMetadata(const std::string& contents) {
+    binarydataframe::FileHeader header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+    return nlohmann::json::parse(contents.substr(header.metadataOffset, header.metadataSize));
+}
+
+}  // namespace
+
+TEST(BinaryDataFrame, roundTrip) {
+    DataFrame df;
+    df.addColumn(std::make_shared<TemplateColumn<float>>(
+        "float", std::vector<float>{1.5f, -2.0f, 3.25f}, units::unit_from_string("m"),
+        dvec2{-5.0, 5.0}));
+    df.addColumn(std::make_shared<TemplateColumn<dvec3>>(
+        "dvec3", std::vector<dvec3>{dvec3{1.0}, dvec3{2.0}, dvec3{3.0, 4.0, 5.0}}));
+    df.addColumn(std::make_shared<CategoricalColumn>(
+        "categories", std::vector<std::string>{"b", "a", "b"}));
+    df.updateIndexBuffer();
+
+    util::TempFileHandle tmpFile("", ".ivdf");
+
+    BinaryDataFrameWriter writer;
+    writer.setOverwrite(Overwrite::Yes);
+    writer.writeData(&df, tmpFile.getFileName());
+
+    BinaryDataFrameReader reader;
+    auto result = reader.readData(tmpFile.getFileName());
+
+    ASSERT_EQ(df.getNumberOfColumns(), result->getNumberOfColumns());
+    ASSERT_EQ(df.getNumberOfRows(), result->getNumberOfRows());
+    for (size_t i = 0; i < df.getNumberOfColumns(); ++i) {
+        const auto expected = df.getColumn(i);
+        const auto col = result->getColumn(i);
+        EXPECT_EQ(expected->getHeader(), col->getHeader());
+        EXPECT_EQ(expected->getColumnType(), col->getColumnType());
+        EXPECT_EQ(expected->getUnit(), col->getUnit());
+        EXPECT_EQ(expected->getCustomRange(), col->getCustomRange());
+        EXPECT_EQ(expected->getBuffer()->getDataFormat(), col->getBuffer()->getDataFormat());
+        for (size_t row = 0; row < df.getNumberOfRows(); ++row) {
+            EXPECT_EQ(expected->getAsString(row), col->getAsString(row));
+        }
+    }
+
+    auto categorical = std::dynamic_pointer_cast<const CategoricalColumn>(result->getColumn(3));
+    ASSERT_TRUE(categorical);
+    EXPECT_EQ((std::vector<std::string>{"b", "a"}), categorical->getCategories());
+}
+
+TEST(BinaryDataFrame, invalidFile) {
+    util::TempFileHandle tmpFile("", ".ivdf");
+    std::fputs("not a binary dataframe", tmpFile.getHandle());
+    std::fflush(tmpFile.getHandle());
+
+    BinaryDataFrameReader reader;
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+}
+
+TEST(BinaryDataFrame, categoricalIndexOutOfRange) {
+    DataFrame df;
+    df.addColumn(std::make_shared<CategoricalColumn>(
+        "categories", std::vector<std::string>{"a", "b", "a"}));
+    df.updateIndexBuffer();
+
+    util::TempFileHandle tmpFile("", ".ivdf");
+    BinaryDataFrameWriter writer;
+    writer.setOverwrite(Overwrite::Yes);
+    writer.writeData(&df, tmpFile.getFileName());
+
+    auto contents = readFile(tmpFile.getFileName());
+    const auto metadata = readMetadata(contents);
+    for (const auto& item : metadata.at("columns")) {
+        if (item.at("type").get<std::string>() == "categorical") {
+            // There are 2 categories, hence index 2 is out of range
+            const std::uint32_t invalid = 2;
+            const auto offset = item.at("data").at("offset").get<std::uint64_t>();
+            std::memcpy(contents.data() + offset + sizeof(invalid), &invalid, sizeof(invalid));
+        }
+    }
+    overwriteFile(tmpFile, contents);
+
+    BinaryDataFrameReader reader;
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+}
+
+TEST(BinaryDataFrame, unknownFormat) {
+    DataFrame df;
+    df.addColumn(std::make_shared<TemplateColumn<float>>("float", std::vector<float>{1.0f, 2.0f}));
+    df.updateIndexBuffer();
+
+    util::TempFileHandle tmpFile("", ".ivdf");
+    BinaryDataFrameWriter writer;
+    writer.setOverwrite(Overwrite::Yes);
+    writer.writeData(&df, tmpFile.getFileName());
+
+    auto contents = readFile(tmpFile.getFileName());
+    const auto pos = contents.find("FLOAT32");
+    ASSERT_NE(pos, std::string::npos);
+    contents.replace(pos, 7, "FLOAT99");
+    overwriteFile(tmpFile, contents);
+
+    BinaryDataFrameReader reader;
+    EXPECT_THROW(reader.readData(tmpFile.getFileName()), DataReaderException);
+}
+
+}  // namespace inviwo
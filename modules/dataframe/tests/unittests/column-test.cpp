@@ -41,6 +41,9 @@
 
 #include <inviwo/core/util/defaultvalues.h>
 
+#include <memory>
+#include <vector>
+
 #include <fmt/format.h>
 
 namespace inviwo {
@@ -134,6 +137,45 @@ TEST(ColumnTests, DataAccess) {
     EXPECT_EQ(expected, bufferram->getDataContainer()) << "Column contents differ";
 }
 
+TEST(ColumnTests, RowSelection) {
+    TemplateColumn<int> col("IntCol", {0, 10, 20, 30, 40, 50});
+    auto rows = std::make_shared<const std::vector<std::uint32_t>>(
+        std::vector<std::uint32_t>{5, 1, 3});
+
+    std::unique_ptr<TemplateColumn<int>> selection{col.clone(rows)};
+    ASSERT_EQ(3, selection->getSize()) << "Row count differs";
+    EXPECT_EQ(50, selection->get(0));
+    EXPECT_EQ(10.0, selection->getAsDouble(1));
+    EXPECT_EQ("30", selection->getAsString(2));
+
+    std::unique_ptr<TemplateColumn<int>> nested{selection->clone(
+        std::make_shared<const std::vector<std::uint32_t>>(std::vector<std::uint32_t>{2, 0}))};
+    std::unique_ptr<TemplateColumn<int>> copy{selection->clone()};
+
+    selection->set(0, -1);
+    EXPECT_EQ(50, col.get(5)) << "Modifying a row selection changed the source column";
+    EXPECT_EQ(50, copy->get(0)) << "Modifying a row selection changed a copy";
+
+    const std::vector<int> expected = {30, 50};
+    EXPECT_EQ(expected, nested->getTypedBuffer()->getRAMRepresentation()->getDataContainer())
+        << "Column contents differ";
+}
+
+TEST(ColumnTests, CategoricalRowSelection) {
+    CategoricalColumn col("Column", {"a", "c", "b", "a"});
+    auto rows = std::make_shared<const std::vector<std::uint32_t>>(
+        std::vector<std::uint32_t>{2, 3});
+
+    std::unique_ptr<CategoricalColumn> selection{col.clone(rows)};
+    ASSERT_EQ(2, selection->getSize()) << "Row count differs";
+    EXPECT_EQ("b", selection->get(0));
+    EXPECT_EQ(0u, selection->getId(1));
+    EXPECT_EQ(col.getCategories(), selection->getCategories());
+
+    const std::vector<std::string> expected = {"b", "a"};
+    EXPECT_EQ(expected, std::vector<std::string>(selection->begin(), selection->end()));
+}
+
 TEST(ColumnAppend, IntColumn) {
     TemplateColumn<int> col("IntCol", {0, 1, 2, 3});
     TemplateColumn<int> col2("IntCol2", {4, 5});
@@ -35,8 +35,10 @@
 #include <inviwo/core/io/tempfilehandle.h>
 #include <inviwo/dataframe/io/csvreader.h>
 #include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/datastructures/column.h>
 #include <inviwo/core/io/datareaderexception.h>
 
+#include <cstdio>
 #include <sstream>
 
 namespace inviwo {
@@ -744,4 +746,63 @@ TEST(CSVItemFilters, doubleRange) {
     EXPECT_EQ(expected, bufferram->getDataContainer()) << "Row contents incorrect";
 }
 
+TEST(CSVchunks, sameAsSingleChunk) {
+    const std::string csv =
+        "name,value,count\n"
+        "\"first\nrow\",1.5,1\n"
+        "second,2.5,2\r\n"
+        "\"third, \"\"quoted\"\"\",3.5,3\n"
+        "fourth,,4\n"
+        "\"fifth\n\nrow\",5.5,5";
+
+    CSVReader reader;
+    reader.setFilters({.excludeRows = {csvfilters::lineRange(7, 7, false)}});
+    std::istringstream ss(csv);
+    const auto expected = reader.readData(ss);
+    ASSERT_EQ(4, expected->getNumberOfRows()) << "row count does not match";
+
+    for (size_t chunkSize : {1, 3, 8, 17}) {
+        SCOPED_TRACE(chunkSize);
+        reader.setChunkSize(chunkSize);
+        std::istringstream chunked(csv);
+        const auto dataframe = reader.readData(chunked);
+        ASSERT_EQ(expected->getNumberOfColumns(), dataframe->getNumberOfColumns());
+        ASSERT_EQ(expected->getNumberOfRows(), dataframe->getNumberOfRows());
+        for (size_t col = 0; col < expected->getNumberOfColumns(); ++col) {
+            for (size_t row = 0; row < expected->getNumberOfRows(); ++row) {
+                EXPECT_EQ(expected->getColumn(col)->getAsString(row),
+                          dataframe->getColumn(col)->getAsString(row))
+                    << "column " << col << ", row " << row;
+            }
+        }
+    }
+}
+
+TEST(CSVchunks, unmatchedQuote) {
+    std::istringstream ss("a,b\n1,2\n\"3,4\n5,6\n7,8");
+
+    CSVReader reader;
+    reader.setChunkSize(4);
+    EXPECT_THROW(reader.readData(ss), DataReaderException) << "unmatched quote";
+}
+
+TEST(CSVchunks, file) {
+    util::TempFileHandle tmpFile("", ".csv");
+    const std::string_view csv = "\xEF\xBB\xBFa,b\n1,x\n2,y\n3,x\n";
+    std::fwrite(csv.data(), 1, csv.size(), tmpFile);
+    std::fflush(tmpFile);
+
+    CSVReader reader;
+    reader.setChunkSize(5);
+    auto dataframe = reader.readData(tmpFile.getFileName());
+    ASSERT_EQ(3, dataframe->getNumberOfColumns()) << "column count does not match";
+    ASSERT_EQ(3, dataframe->getNumberOfRows()) << "row count does not match";
+    EXPECT_EQ("a", dataframe->getColumn(1)->getHeader());
+    EXPECT_EQ("3", dataframe->getColumn(1)->getAsString(2));
+    auto categorical = std::dynamic_pointer_cast<const CategoricalColumn>(dataframe->getColumn(2));
+    ASSERT_TRUE(categorical);
+    EXPECT_EQ(2, categorical->getCategories().size()) << "categories not merged";
+    EXPECT_EQ("x", categorical->getAsString(2));
+}
+
 }  // namespace inviwo
@@ -41,6 +41,10 @@
 
 #include <fmt/format.h>
 
+#include <cmath>
+#include <cstdint>
+#include <functional>
+
 namespace inviwo {
 
 namespace {
@@ -267,4 +271,54 @@ TEST(DataFrameFilter, MultiColumnIncludeExclude) {
     EXPECT_EQ(expected, result) << "Filter result does not match";
 }
 
+TEST(DataFrameFilter, CustomFilter) {
+    DataFrame dataframe;
+    dataframe.addColumnFromBuffer(
+        "FloatCol", util::makeBuffer(std::vector<float>{1.0f, NAN, 3.0f, -0.5f, 2.0f}));
+    dataframe.updateIndexBuffer();
+
+    // filters without a predicate are evaluated by calling the filter function for each item
+    dataframefilters::Filters filters;
+    filters.include.push_back(dataframefilters::ItemFilter{
+        std::function<bool(double)>([](double value) { return !(value < 1.5); }), 1, false});
+    filters.exclude.push_back(
+        dataframefilters::doubleMatch(1, filters::NumberComp::Equal, 2.1, 0.2));
+
+    const auto result = dataframe::selectRows(dataframe, filters);
+
+    const std::vector<uint32_t> expected = {1, 2};
+    EXPECT_EQ(expected, result) << "Filter result does not match";
+}
+
+TEST(DataFrameFilter, ManyRows) {
+    const int rows = 200000;
+    std::vector<int> ints(rows);
+    std::vector<double> doubles(rows);
+    for (int i = 0; i < rows; ++i) {
+        ints[i] = (i * 7919) % 1000;
+        doubles[i] = static_cast<double>((std::int64_t{i} * 104729) % 500) / 10.0;
+    }
+
+    DataFrame dataframe;
+    dataframe.addColumnFromBuffer("IntCol", util::makeBuffer(std::vector<int>(ints)));
+    dataframe.addColumnFromBuffer("DoubleCol", util::makeBuffer(std::vector<double>(doubles)));
+    dataframe.updateIndexBuffer();
+
+    dataframefilters::Filters filters;
+    filters.include.push_back(dataframefilters::intMatch(1, filters::NumberComp::Less, 100));
+    filters.include.push_back(dataframefilters::doubleRange(2, 10.0, 12.5));
+    filters.exclude.push_back(dataframefilters::intRange(1, 20, 29));
+    filters.exclude.push_back(dataframefilters::doubleMatch(2, filters::NumberComp::Greater, 12.0));
+
+    std::vector<uint32_t> expected;
+    for (int i = 0; i < rows; ++i) {
+        const bool include = ints[i] < 100 || (doubles[i] >= 10.0 && doubles[i] <= 12.5);
+        const bool exclude = (ints[i] >= 20 && ints[i] <= 29) || doubles[i] > 12.0;
+        if (include && !exclude) expected.push_back(static_cast<uint32_t>(i));
+    }
+
+    const auto result = dataframe::selectRows(dataframe, filters);
+    EXPECT_EQ(expected, result) << "Filter result does not match";
+}
+
 }  // namespace inviwo
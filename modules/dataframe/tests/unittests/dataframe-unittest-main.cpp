@@ -31,13 +31,13 @@
 #pragma comment(linker, "/SUBSYSTEM:CONSOLE")
 #endif
 
-#include <inviwo/testutil/configurablegtesteventlistener.h>
-
-#include <inviwo/core/datastructures/representationutil.h>
-#include <inviwo/core/datastructures/representationfactorymanager.h>
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/common/coremodulesharedlibrary.h>
 #include <inviwo/core/util/logcentral.h>
 #include <inviwo/core/util/consolelogger.h>
 
+#include <inviwo/testutil/configurablegtesteventlistener.h>
+
 #include <warn/push>
 #include <warn/ignore/all>
 #include <gtest/gtest.h>
@@ -50,8 +50,14 @@ int main(int argc, char** argv) {
     inviwo::LogCentral::getPtr()->setVerbosity(inviwo::LogVerbosity::Error);
     inviwo::LogCentral::getPtr()->registerLogger(logger);
 
-    inviwo::RepresentationFactoryManager rfm;
-    inviwo::util::registerCoreRepresentations(rfm);
+    // The application provides the core representations and the thread pool used by the
+    // parallel DataFrame utilities
+    inviwo::InviwoApplication app(argc, argv, "Inviwo-Unittests-DataFrame");
+    {
+        std::vector<std::unique_ptr<inviwo::InviwoModuleFactoryObject>> modules;
+        modules.emplace_back(inviwo::createInviwoCore());
+        app.registerModules(std::move(modules));
+    }
 
     int ret = -1;
     {
@@ -35,13 +35,21 @@
 #include <inviwo/dataframe/datastructures/column.h>
 #include <inviwo/dataframe/datastructures/dataframe.h>
 #include <inviwo/dataframe/util/dataframeutil.h>
+#include <inviwo/dataframe/util/join.h>
 
 #include <inviwo/core/datastructures/buffer/buffer.h>
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/common/inviwoapplication.h>
 #include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/raiiutils.h>
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+
 namespace inviwo {
 
 namespace {
@@ -57,6 +65,14 @@ void checkColumnContents(const Column& col, const std::vector<T>& expected) {
         << fmt::format("Column contents for '{}' differ", col.getHeader());
 }
 
+std::vector<std::vector<std::uint32_t>> toVectors(const dataframe::JoinMatches& matches) {
+    std::vector<std::vector<std::uint32_t>> rows;
+    for (size_t i = 0; i < matches.size(); ++i) {
+        rows.emplace_back(matches[i].begin(), matches[i].end());
+    }
+    return rows;
+}
+
 }  // namespace
 
 TEST(AppendRows, ByOrder) {
@@ -390,4 +406,165 @@ TEST(LeftJoin, MultipleKeyColumns) {
                                {4.0f, 3.0f, 0.0f, 0.0f, 5.0f, 0.0f, 6.0f, 7.0f});
 }
 
+TEST(MatchingRows, AllMatches) {
+    DataFrame left;
+    left.addColumnFromBuffer("int", util::makeBuffer(std::vector<int>{3, 1, 7, 1}));
+    left.updateIndexBuffer();
+
+    DataFrame right;
+    right.addColumnFromBuffer("int", util::makeBuffer(std::vector<int>{1, 3, 1, 5, 3, 1}));
+    right.updateIndexBuffer();
+
+    const std::vector<std::pair<std::string, std::string>> keys{{"int", "int"}};
+    const std::vector<std::vector<std::uint32_t>> expected{{1, 4}, {0, 2, 5}, {}, {0, 2, 5}};
+    EXPECT_EQ(expected, toVectors(dataframe::matchingRows(left, right, keys)));
+
+    const std::vector<std::vector<std::uint32_t>> expectedFirst{{1}, {0}, {}, {0}};
+    EXPECT_EQ(expectedFirst,
+              toVectors(dataframe::matchingRows(left, right, keys, dataframe::JoinMatch::First)));
+}
+
+TEST(MatchingRows, Sorted) {
+    DataFrame left;
+    left.addColumnFromBuffer("int", util::makeBuffer(std::vector<int>{0, 1, 1, 4, 6}));
+    left.updateIndexBuffer();
+
+    DataFrame right;
+    right.addColumnFromBuffer("int", util::makeBuffer(std::vector<int>{1, 1, 2, 4, 4, 4, 5}));
+    right.updateIndexBuffer();
+
+    const std::vector<std::pair<std::string, std::string>> keys{{"int", "int"}};
+    const std::vector<std::vector<std::uint32_t>> expected{{}, {0, 1}, {0, 1}, {3, 4, 5}, {}};
+    EXPECT_EQ(expected, toVectors(dataframe::matchingRows(left, right, keys)));
+
+    const std::vector<std::vector<std::uint32_t>> expectedFirst{{}, {0}, {0}, {3}, {}};
+    EXPECT_EQ(expectedFirst,
+              toVectors(dataframe::matchingRows(left, right, keys, dataframe::JoinMatch::First)));
+}
+
+TEST(MatchingRows, MultipleKeyColumns) {
+    DataFrame left;
+    left.addColumnFromBuffer("float",
+                             util::makeBuffer(std::vector<float>{1.0f, -0.0f, NAN, 2.0f, 1.0f}));
+    left.addCategoricalColumn("cat", {"a", "b", "a", "x", "b"});
+    left.updateIndexBuffer();
+
+    DataFrame right;
+    right.addColumnFromBuffer("float",
+                              util::makeBuffer(std::vector<float>{NAN, 0.0f, 1.0f, 2.0f, 1.0f}));
+    right.addCategoricalColumn("cat", {"a", "b", "b", "a", "a"});
+    right.updateIndexBuffer();
+
+    const std::vector<std::pair<std::string, std::string>> keys{{"float", "float"},
+                                                                {"cat", "cat"}};
+    const std::vector<std::vector<std::uint32_t>> expected{{4}, {1}, {}, {}, {2}};
+    EXPECT_EQ(expected, toVectors(dataframe::matchingRows(left, right, keys)));
+
+    EXPECT_THROW(dataframe::matchingRows(left, right, {}), Exception);
+    EXPECT_THROW(dataframe::matchingRows(left, right, {{"float", "cat"}}), Exception);
+}
+
+TEST(MatchingRows, Random) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 500);
+    auto createData = [&](size_t size) {
+        std::vector<int> data(size);
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+        return data;
+    };
+
+    const auto leftKey1 = createData(2000);
+    const auto leftKey2 = createData(2000);
+    const auto rightKey1 = createData(3000);
+    const auto rightKey2 = createData(3000);
+
+    DataFrame left;
+    left.addColumnFromBuffer("key1", util::makeBuffer(std::vector<int>(leftKey1)));
+    left.addColumnFromBuffer("key2", util::makeBuffer(std::vector<int>(leftKey2)));
+    left.updateIndexBuffer();
+
+    DataFrame right;
+    right.addColumnFromBuffer("key1", util::makeBuffer(std::vector<int>(rightKey1)));
+    right.addColumnFromBuffer("key2", util::makeBuffer(std::vector<int>(rightKey2)));
+    right.updateIndexBuffer();
+
+    const auto matches = dataframe::matchingRows(
+        left, right,
+        std::vector<std::pair<std::string, std::string>>{{"key1", "key1"}, {"key2", "key2"}});
+
+    ASSERT_EQ(leftKey1.size(), matches.size());
+    for (size_t i = 0; i < leftKey1.size(); ++i) {
+        std::vector<std::uint32_t> expected;
+        for (size_t j = 0; j < rightKey1.size(); ++j) {
+            if (leftKey1[i] == rightKey1[j] && leftKey2[i] == rightKey2[j]) {
+                expected.push_back(static_cast<std::uint32_t>(j));
+            }
+        }
+        EXPECT_EQ(expected, std::vector<std::uint32_t>(matches[i].begin(), matches[i].end()))
+            << "matches of row " << i << " differ";
+    }
+}
+
+TEST(MatchingRows, LargeWithDuplicates) {
+    // More than two ranges of 16384 rows on both sides, such that the keys are partitioned and
+    // probed in parallel. Every key occurs about 16 times on each side.
+    constexpr size_t rows = 2 * 16384 + 1000;
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(rows / 16));
+    auto createData = [&]() {
+        std::vector<int> data(rows);
+        std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+        return data;
+    };
+    const auto leftKey = createData();
+    const auto rightKey = createData();
+    std::vector<float> rightValue(rows);
+    std::iota(rightValue.begin(), rightValue.end(), 0.0f);
+
+    DataFrame left;
+    left.addColumnFromBuffer("key", util::makeBuffer(std::vector<int>(leftKey)));
+    left.updateIndexBuffer();
+
+    DataFrame right;
+    right.addColumnFromBuffer("key", util::makeBuffer(std::vector<int>(rightKey)));
+    right.addColumnFromBuffer("value", util::makeBuffer(std::vector<float>(rightValue)));
+    right.updateIndexBuffer();
+
+    auto* app = InviwoApplication::getPtr();
+    const auto poolSize = app->getPoolSize();
+    util::OnScopeExit restore{[&]() { app->resizePool(poolSize); }};
+    app->resizePool(4);
+    ASSERT_GT(app->getPoolSize(), 0);
+
+    const std::vector<std::pair<std::string, std::string>> keys{{"key", "key"}};
+    const auto matches = dataframe::matchingRows(left, right, keys);
+    const auto joined = dataframe::innerJoin(left, right, keys);
+
+    // Expected result from a nested loop
+    std::vector<std::uint32_t> expected;
+    std::vector<int> expectedKeys;
+    std::vector<float> expectedValues;
+    size_t mismatches = 0;
+    ASSERT_EQ(rows, matches.size());
+    for (size_t i = 0; i < rows; ++i) {
+        expected.clear();
+        for (size_t j = 0; j < rows; ++j) {
+            if (leftKey[i] == rightKey[j]) {
+                expected.push_back(static_cast<std::uint32_t>(j));
+            }
+        }
+        if (!std::ranges::equal(expected, matches[i])) {
+            ++mismatches;
+        }
+        if (!expected.empty()) {
+            expectedKeys.push_back(leftKey[i]);
+            expectedValues.push_back(rightValue[expected.front()]);
+        }
+    }
+    EXPECT_EQ(0, mismatches) << "matching rows differ from the nested loop";
+
+    checkColumnContents<int>(*joined->getColumn("key"), expectedKeys);
+    checkColumnContents<float>(*joined->getColumn("value"), expectedValues);
+}
+
 }  // namespace inviwo
@@ -40,6 +40,7 @@
 #include <inviwo/dataframe/datastructures/dataframe.h>
 #include <inviwo/dataframe/util/dataframeutil.h>
 
+#include <inviwo/core/network/processornetworkevaluator.h>
 #include <inviwo/core/util/defaultvalues.h>
 #include <inviwo/core/util/safecstr.h>
 #include <inviwo/core/datastructures/buffer/buffer.h>
@@ -307,6 +308,13 @@ void exposeDataFrame(pybind11::module& m) {
              
              Args:
                  keyColumn: list of headers of the columns used as key for the join operation
+             )delim")
+        .def("createFromEvaluationMetrics", dataframe::createFromEvaluationMetrics,
+             py::arg("evaluator"),
+             R"delim(
+             Create a new DataFrame with one row per sample of the evaluation metrics gathered
+             by the ProcessorNetworkEvaluator, with the columns Processor, Evaluation, Process,
+             OnChange, InitializeResources, and Invalid (times in milliseconds).
              )delim");
 
     exposeStandardDataPorts<DataFrame>(m, "DataFrame");
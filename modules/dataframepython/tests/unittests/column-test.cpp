@@ -91,12 +91,16 @@ col = ivwdataframe.{0}Column('{0}Col')
 }  // namespace
 
 TEST(ColumnTests, Create) {
+    const py::gil_scoped_acquire gil;
+
     using Scalars = std::tuple<float, double, int, glm::i64, size_t, std::uint32_t>;
 
     util::for_each_type<Scalars>{}(CreateColumnScript{});
 }
 
 TEST(ColumnTests, CategoricalColumn) {
+    const py::gil_scoped_acquire gil;
+
     const std::string source = R"delim(
 import inviwopy
 import ivwdataframe
@@ -124,6 +128,8 @@ col.add('a')
 }
 
 TEST(ColumnTests, FloatColumn) {
+    const py::gil_scoped_acquire gil;
+
     const std::string source = R"delim(
 import inviwopy
 import ivwdataframe
@@ -153,6 +159,8 @@ col.buffer.data = np.array([0.0, 0.1, 0.5, 1.0, 2.0, 10.0], dtype=np.single)
 }
 
 TEST(ColumnTests, DataAccess) {
+    const py::gil_scoped_acquire gil;
+
     const std::string source = R"delim(
 import inviwopy
 import ivwdataframe
@@ -188,6 +196,8 @@ col.set(2, 5.0)
 }
 
 TEST(ColumnAppend, IntColumn) {
+    const py::gil_scoped_acquire gil;
+
     const std::string source = R"delim(
 import inviwopy
 import ivwdataframe
@@ -225,6 +235,8 @@ col.append(col2)
 }
 
 TEST(ColumnAppend, Categorical) {
+    const py::gil_scoped_acquire gil;
+
     const std::string source = R"delim(
 import inviwopy
 import ivwdataframe
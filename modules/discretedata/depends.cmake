@@ -1,3 +1,4 @@
 #--------------------------------------------------------------------
 # Should always stay empty
 set(dependencies)
+set(threadSafe ON)
@@ -3,3 +3,4 @@
 # List modules on the format "Inviwo<ModuleName>Module"
 set(dependencies
 )
+set(threadSafe ON)
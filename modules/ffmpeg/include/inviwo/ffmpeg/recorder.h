@@ -36,6 +36,7 @@
 #include <inviwo/ffmpeg/wrap/packet.h>
 #include <inviwo/ffmpeg/wrap/format.h>
 
+#include <chrono>
 #include <thread>
 #include <queue>
 #include <vector>
@@ -49,6 +50,22 @@ class IVW_MODULE_FFMPEG_API Recorder {
 public:
     enum class Mode { Time, Evaluation };
 
+    /**
+     * Frame counters of the recording so far
+     */
+    struct Counters {
+        size_t queued = 0;     ///< Frames waiting to be encoded
+        size_t maxQueued = 0;  ///< The largest number of frames that have been waiting
+        size_t encoded = 0;    ///< Frames sent to the encoder
+        size_t dropped = 0;    ///< Frames dropped since the queue was full, only in Time mode
+        std::chrono::duration<double> blocked{0.0};  ///< Time queueFrame waited for room
+    };
+
+    /**
+     * The maximum number of frames waiting to be encoded
+     */
+    static constexpr size_t maxQueueSize = 30;
+
     Recorder(const std::filesystem::path& filename, OutputFormat format, Mode aMode,
              OutputStream::Options opts);
     ~Recorder();
@@ -59,9 +76,13 @@ public:
     /**
      * Copies the image data in layer into a ffmpeg frames and enques that for encoding
      * The layer will not be used after the return of the function.
+     * When the queue is full the frame is dropped in Time mode, in Evaluation mode the call
+     * blocks until the encoder has made room for it.
      */
     void queueFrame(const LayerRAM& layer);
 
+    Counters counters() const;
+
 private:
     void run();
 
@@ -72,8 +93,10 @@ private:
 
     std::queue<Frame> queue_;
     std::vector<Frame> unused_;
-    std::mutex mutex_;
+    mutable std::mutex mutex_;
     std::condition_variable condition_;
+    std::condition_variable space_;
+    Counters counters_;
     std::atomic<bool> stop_;
     std::exception_ptr eptr;
     int frameRate;
@@ -34,6 +34,9 @@
 
 #include <inviwo/core/util/stringconversion.h>
 
+#include <chrono>
+#include <optional>
+
 #include <fmt/format.h>
 #include <fmt/std.h>
 #include <fmt/chrono.h>
@@ -56,15 +59,20 @@ public:
     virtual ~FFmpegRecorder() = default;
 
     virtual void record(const Layer& layer) override;
+    virtual animation::RecorderStatistics statistics() const override;
 
 private:
     std::unique_ptr<ffmpeg::Recorder> recorder;
+    size_t recorded = 0;
+    std::optional<std::chrono::steady_clock::time_point> start;
 };
 
 void FFmpegRecorder::record(const Layer& layer) {
     if (recorder) {
         try {
+            if (!start) start = std::chrono::steady_clock::now();
             recorder->queueFrame(*layer.getRepresentation<LayerRAM>());
+            ++recorded;
         } catch (const Exception& e) {
             util::log(e.getContext(), e.getMessage(), LogLevel::Error);
             recorder.reset();
@@ -78,6 +86,20 @@ void FFmpegRecorder::record(const Layer& layer) {
     }
 }
 
+animation::RecorderStatistics FFmpegRecorder::statistics() const {
+    animation::RecorderStatistics stats{.recorded = recorded};
+    if (recorder) {
+        const auto counters = recorder->counters();
+        stats.written = counters.encoded;
+        stats.queued = counters.queued;
+        stats.maxQueued = counters.maxQueued;
+        stats.queueLimit = ffmpeg::Recorder::maxQueueSize;
+        stats.blocked = counters.blocked;
+    }
+    if (start) stats.elapsed = std::chrono::steady_clock::now() - *start;
+    return stats;
+}
+
 }  // namespace
 
 FFmpegRecorderFactory::FFmpegRecorderFactory()
@@ -82,6 +82,11 @@ OutputStream::OutputStream(Format& format, Options opts)
     if (format.ctx->oformat->flags & AVFMT_GLOBALHEADER) {
         codec.ctx->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
     }
+
+    /* Let the encoder spread the work over its own threads, a thread count
+     * of 0 lets libavcodec pick one based on the number of cores. */
+    codec.ctx->thread_count = 0;
+    codec.ctx->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
 }
 
 void OutputStream::openVideo(AVDictionary* opt_arg) {
@@ -33,6 +33,8 @@
 #include <inviwo/core/util/logcentral.h>
 #include <inviwo/core/util/indexmapper.h>
 
+#include <algorithm>
+
 extern "C" {
 
 #include <libavformat/avformat.h>
@@ -75,6 +77,8 @@ Recorder::Recorder(const std::filesystem::path& filename, OutputFormat format, M
     , unused_{}
     , mutex_{}
     , condition_{}
+    , space_{}
+    , counters_{}
     , stop_{false}
     , eptr{}
     , frameRate{opts.frameRate}
@@ -104,23 +108,37 @@ Recorder::~Recorder() {
 const OutputStream& Recorder::getStream() { return stream; }
 const Format& Recorder::getFormat() { return out; }
 
+auto Recorder::counters() const -> Counters {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto counters = counters_;
+    counters.queued = queue_.size();
+    return counters;
+}
+
 void Recorder::queueFrame(const LayerRAM& layer) {
     std::optional<Frame> frame;
     {
         std::unique_lock<std::mutex> lock(mutex_);
 
+        if (mode == Mode::Evaluation && queue_.size() >= maxQueueSize) {
+            const auto start = std::chrono::steady_clock::now();
+            space_.wait(lock, [&]() { return eptr || queue_.size() < maxQueueSize; });
+            counters_.blocked += std::chrono::steady_clock::now() - start;
+        }
+
         if (eptr) {
             std::rethrow_exception(std::exchange(eptr, nullptr));
         }
 
-        if (!unused_.empty()) {
+        if (queue_.size() >= maxQueueSize) {
+            ++counters_.dropped;
+            util::log(IVW_CONTEXT, "Queue saturated");
+        } else if (!unused_.empty()) {
             frame.emplace(std::move(unused_.back()));
             unused_.pop_back();
-        } else if (queue_.size() < 30) {
+        } else {
             frame.emplace(stream.codec.ctx->pix_fmt, stream.codec.ctx->width,
                           stream.codec.ctx->height);
-        } else {
-            util::log(IVW_CONTEXT, "Queue saturated");
         }
     }
 
@@ -163,6 +181,7 @@ void Recorder::queueFrame(const LayerRAM& layer) {
         {
             std::unique_lock<std::mutex> lock(mutex_);
             queue_.push(std::move(*frame));
+            counters_.maxQueued = std::max(counters_.maxQueued, queue_.size());
         }
     }
     condition_.notify_one();
@@ -210,6 +229,7 @@ void Recorder::run() {
                         if (frame) unused_.emplace_back(std::move(frame));
                         frame = std::move(queue_.front());
                         queue_.pop();
+                        ++counters_.encoded;
                     }
                 }
 
@@ -219,17 +239,20 @@ void Recorder::run() {
             }
 
         } else if (mode == Mode::Evaluation) {
-            while (!stop_) {
+            // Every queued frame is encoded exactly once, also the ones queued before stopping
+            while (true) {
                 {
                     std::unique_lock<std::mutex> lock(mutex_);
                     condition_.wait(lock, [&]() { return stop_ || !queue_.empty(); });
 
-                    if (!queue_.empty()) {
-                        if (frame) unused_.emplace_back(std::move(frame));
-                        frame = std::move(queue_.front());
-                        queue_.pop();
-                    }
+                    if (queue_.empty()) break;
+
+                    if (frame) unused_.emplace_back(std::move(frame));
+                    frame = std::move(queue_.front());
+                    queue_.pop();
+                    ++counters_.encoded;
                 }
+                space_.notify_one();
 
                 frame.frame->pts = frameCount++;
                 writeFrame(out, stream.codec, stream.stream, frame, pkt);
@@ -248,8 +271,11 @@ void Recorder::run() {
                                     << static_cast<double>(frameCount) / ms.count() * 1000);
 
     } catch (...) {
-        std::unique_lock<std::mutex> lock(mutex_);
-        eptr = std::current_exception();
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            eptr = std::current_exception();
+        }
+        space_.notify_all();
     }
 }
 
@@ -5,6 +5,7 @@ set(dependencies
 )
 
 set(EnableByDefault ON)
+set(threadSafe ON)
 
 # Add an alias for this module. Several modules can share an alias. 
 # Useful if several modules implement the same functionality.
@@ -5,3 +5,4 @@ set(dependencies
 	InviwoBaseModule
 )
 set(EnableByDefault ON)
+set(threadSafe ON)
@@ -43,6 +43,8 @@ public:
         std::shared_ptr<const BufferRAM> source) const override;
     virtual void update(std::shared_ptr<const BufferRAM> source,
                         std::shared_ptr<BufferCL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 class IVW_MODULE_OPENCL_API BufferCL2RAMConverter
@@ -52,6 +54,8 @@ public:
         std::shared_ptr<const BufferCL> source) const override;
     virtual void update(std::shared_ptr<const BufferCL> source,
                         std::shared_ptr<BufferRAM> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 }  // namespace inviwo
@@ -44,6 +44,8 @@ public:
         std::shared_ptr<const BufferCLGL> source) const override;
     virtual void update(std::shared_ptr<const BufferCLGL> source,
                         std::shared_ptr<BufferRAM> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 class IVW_MODULE_OPENCL_API BufferCLGL2GLConverter
@@ -53,6 +55,8 @@ public:
         std::shared_ptr<const BufferCLGL> source) const override;
     virtual void update(std::shared_ptr<const BufferCLGL> source,
                         std::shared_ptr<BufferGL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::shared(); }
 };
 
 class IVW_MODULE_OPENCL_API BufferGL2CLGLConverter
@@ -62,6 +66,8 @@ public:
         std::shared_ptr<const BufferGL> source) const override;
     virtual void update(std::shared_ptr<const BufferGL> source,
                         std::shared_ptr<BufferCLGL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::shared(); }
 };
 
 class IVW_MODULE_OPENCL_API BufferCLGL2CLConverter
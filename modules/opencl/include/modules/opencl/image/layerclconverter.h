@@ -45,6 +45,8 @@ public:
         std::shared_ptr<const LayerRAM> source) const override;
     virtual void update(std::shared_ptr<const LayerRAM> source,
                         std::shared_ptr<LayerCL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 class IVW_MODULE_OPENCL_API LayerCL2RAMConverter
@@ -54,6 +56,8 @@ public:
         std::shared_ptr<const LayerCL> source) const override;
     virtual void update(std::shared_ptr<const LayerCL> source,
                         std::shared_ptr<LayerRAM> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 }  // namespace inviwo
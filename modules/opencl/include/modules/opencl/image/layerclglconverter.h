@@ -45,6 +45,8 @@ public:
         std::shared_ptr<const LayerCLGL> source) const override;
     virtual void update(std::shared_ptr<const LayerCLGL> source,
                         std::shared_ptr<LayerRAM> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 class IVW_MODULE_OPENCL_API LayerCLGL2GLConverter
@@ -54,6 +56,8 @@ public:
         std::shared_ptr<const LayerCLGL> source) const override;
     virtual void update(std::shared_ptr<const LayerCLGL> source,
                         std::shared_ptr<LayerGL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::shared(); }
 };
 
 class IVW_MODULE_OPENCL_API LayerCLGL2CLConverter
@@ -72,6 +76,8 @@ public:
         std::shared_ptr<const LayerGL> source) const override;
     virtual void update(std::shared_ptr<const LayerGL> source,
                         std::shared_ptr<LayerCLGL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::shared(); }
 };
 
 }  // namespace inviwo
@@ -45,6 +45,8 @@ public:
         std::shared_ptr<const VolumeRAM> source) const override;
     virtual void update(std::shared_ptr<const VolumeRAM> source,
                         std::shared_ptr<VolumeCL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 class IVW_MODULE_OPENCL_API VolumeCL2RAMConverter
@@ -54,6 +56,8 @@ public:
         std::shared_ptr<const VolumeCL> source) const override;
     virtual void update(std::shared_ptr<const VolumeCL> source,
                         std::shared_ptr<VolumeRAM> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 }  // namespace inviwo
@@ -47,6 +47,8 @@ public:
         std::shared_ptr<const VolumeCLGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeCLGL> source,
                         std::shared_ptr<VolumeRAM> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 class IVW_MODULE_OPENCL_API VolumeGL2CLGLConverter
@@ -56,6 +58,8 @@ public:
         std::shared_ptr<const VolumeGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeGL> source,
                         std::shared_ptr<VolumeCLGL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::shared(); }
 };
 
 class IVW_MODULE_OPENCL_API VolumeCLGL2CLConverter
@@ -74,6 +78,8 @@ public:
         std::shared_ptr<const VolumeCLGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeCLGL> source,
                         std::shared_ptr<VolumeGL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::shared(); }
 };
 
 }  // namespace inviwo
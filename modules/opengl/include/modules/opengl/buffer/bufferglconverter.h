@@ -47,6 +47,8 @@ public:
         std::shared_ptr<const BufferRAM> source) const override;
     virtual void update(std::shared_ptr<const BufferRAM> source,
                         std::shared_ptr<BufferGL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 class IVW_MODULE_OPENGL_API BufferGL2RAMConverter
@@ -56,6 +58,8 @@ public:
         std::shared_ptr<const BufferGL> source) const override;
     virtual void update(std::shared_ptr<const BufferGL> source,
                         std::shared_ptr<BufferRAM> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 }  // namespace inviwo
@@ -74,6 +74,12 @@ public:
     void addShaderResource(std::string key, std::string resource);
     void addShaderResource(std::unique_ptr<ShaderResource> resource);
     void addShaderResource(std::shared_ptr<ShaderResource> resource);
+    /**
+     * Add a resource that is only processed when it is first requested in getShaderResource. Used
+     * for the shaders that are compiled into the modules, which would otherwise all be copied at
+     * startup. The source has to outlive the ShaderManager.
+     */
+    void addLazyShaderResource(std::string key, const std::string& source);
     std::shared_ptr<ShaderResource> getShaderResource(std::string_view key);
 
     const std::vector<Shader*>& getShaders() const;
@@ -92,12 +98,14 @@ public:
 
 private:
     bool addShaderSearchPathImpl(const std::filesystem::path& path);
+    void addPendingLazyShaderResource(std::string_view key);
     std::vector<Shader*> shaders_;
     OpenGLCapabilities* openGLInfoRef_;
     std::vector<std::filesystem::path> shaderSearchPaths_;
 
     std::vector<std::shared_ptr<ShaderResource>> ownedResources_;
     std::map<std::string, std::weak_ptr<ShaderResource>, std::less<>> shaderResources_;
+    std::map<std::string, const std::string*, std::less<>> lazyResources_;
 
     OptionProperty<Shader::UniformWarning>* uniformWarnings_;  // non-owning reference
     OptionProperty<Shader::OnError>* shaderObjectErrors_;      // non-owning reference
@@ -47,6 +47,8 @@ public:
         std::shared_ptr<const VolumeRAM> source) const override;
     virtual void update(std::shared_ptr<const VolumeRAM> source,
                         std::shared_ptr<VolumeGL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 class IVW_MODULE_OPENGL_API VolumeGL2RAMConverter
@@ -56,6 +58,8 @@ public:
         std::shared_ptr<const VolumeGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeGL> source,
                         std::shared_ptr<VolumeRAM> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 }  // namespace inviwo
@@ -108,21 +108,37 @@ void ShaderManager::addShaderResource(std::string key, std::string src) {
     replaceInString(src, "NEWLINE", "\n");
     auto resource = std::make_shared<StringShaderResource>(key, src);
     ownedResources_.push_back(resource);
+    lazyResources_.erase(key);
     shaderResources_[key] = std::weak_ptr<ShaderResource>(resource);
 }
 
 void ShaderManager::addShaderResource(std::unique_ptr<ShaderResource> resource) {
     std::shared_ptr<ShaderResource> res(std::move(resource));
     ownedResources_.push_back(res);
+    lazyResources_.erase(res->key());
     shaderResources_[res->key()] = std::weak_ptr<ShaderResource>(res);
 }
 
 void ShaderManager::addShaderResource(std::shared_ptr<ShaderResource> resource) {
     ownedResources_.push_back(resource);
+    lazyResources_.erase(resource->key());
     shaderResources_[resource->key()] = std::weak_ptr<ShaderResource>(resource);
 }
 
+void ShaderManager::addLazyShaderResource(std::string key, const std::string& source) {
+    shaderResources_.erase(key);
+    lazyResources_[std::move(key)] = &source;
+}
+
+void ShaderManager::addPendingLazyShaderResource(std::string_view key) {
+    if (auto it = lazyResources_.find(key); it != lazyResources_.end()) {
+        auto node = lazyResources_.extract(it);
+        addShaderResource(std::move(node.key()), *node.mapped());
+    }
+}
+
 std::shared_ptr<ShaderResource> ShaderManager::getShaderResource(std::string_view key) {
+    addPendingLazyShaderResource(key);
     auto it1 = shaderResources_.find(key);
     if (it1 != shaderResources_.end()) {
         if (!it1->second.expired()) {
@@ -135,6 +151,7 @@ std::shared_ptr<ShaderResource> ShaderManager::getShaderResource(std::string_vie
     std::string key2{key};
     replaceInString(key2, "/", "_");
     replaceInString(key2, ".", "_");
+    addPendingLazyShaderResource(key2);
     auto it0 = shaderResources_.find(key2);
     if (it0 != shaderResources_.end()) {
         if (!it0->second.expired()) {
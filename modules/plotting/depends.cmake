@@ -6,3 +6,4 @@ set(dependencies
     InviwoFontRenderingModule
 )
 set(EnableByDefault ON)
+set(threadSafe ON)
@@ -2,4 +2,5 @@
 # Dependencies for current module
 set(dependencies
 )
-set(EnableByDefault ON)
\ No newline at end of file
+set(EnableByDefault ON)
+set(threadSafe ON)
\ No newline at end of file
@@ -119,7 +119,8 @@ void exposeFactoryReaderType(pybind11::class_<DataReaderFactory>& r, std::string
              (bool(DataReaderFactory::*)(const FileExtension&) const) &
                  DataReaderFactory::hasReaderForTypeAndExtension<T>)
         .def(fmt::format("read{}", type).c_str(),
-             &DataReaderFactory::readDataForTypeAndExtension<T>);
+             &DataReaderFactory::readDataForTypeAndExtension<T>,
+             py::call_guard<py::gil_scoped_release>());
 }
 
 template <typename T>
@@ -127,10 +128,15 @@ void exposeReaderType(pybind11::module& m, std::string_view name) {
     namespace py = pybind11;
     py::class_<DataReaderType<T>, DataReader, DataReaderTypeTrampoline<T>>(
         m, fmt::format("{}DataReader", name).c_str())
+        // Reading is mostly file IO, let other Python threads run meanwhile. Readers implemented in
+        // Python will reacquire the GIL in the trampoline.
         .def("readData",
-             py::overload_cast<const std::filesystem::path&>(&DataReaderType<T>::readData))
-        .def("readData", py::overload_cast<const std::filesystem::path&, MetaDataOwner*>(
-                             &DataReaderType<T>::readData));
+             py::overload_cast<const std::filesystem::path&>(&DataReaderType<T>::readData),
+             py::call_guard<py::gil_scoped_release>())
+        .def("readData",
+             py::overload_cast<const std::filesystem::path&, MetaDataOwner*>(
+                 &DataReaderType<T>::readData),
+             py::call_guard<py::gil_scoped_release>());
 }
 
 void exposeDataReaders(pybind11::module& m) {
@@ -41,6 +41,7 @@
 #include <inviwo/core/common/modulemanager.h>
 #include <inviwo/core/io/datareaderfactory.h>
 #include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
 #include <inviwo/core/util/commandlineparser.h>
 #include <inviwo/core/util/settings/settings.h>
 #include <inviwo/core/properties/propertyfactory.h>
@@ -170,7 +171,8 @@ void exposeInviwoApplication(pybind11::module& m) {
         .def("getModuleSettings", &InviwoApplication::getModuleSettings,
              py::return_value_policy::reference)
 
-        .def("waitForPool", &InviwoApplication::waitForPool)
+        .def("waitForPool", &InviwoApplication::waitForPool,
+             py::call_guard<py::gil_scoped_release>())
         .def("resizePool", &InviwoApplication::resizePool)
         .def("getPoolSize", &InviwoApplication::getPoolSize)
 
@@ -195,6 +197,10 @@ void exposeInviwoApplication(pybind11::module& m) {
 
         .def_property_readonly("network", &InviwoApplication::getProcessorNetwork,
                                "Get the processor network", py::return_value_policy::reference)
+        .def_property_readonly("networkEvaluator",
+                               &InviwoApplication::getProcessorNetworkEvaluator,
+                               "Get the processor network evaluator",
+                               py::return_value_policy::reference)
 
         .def_property_readonly("dataReaderFactory", &InviwoApplication::getDataReaderFactory,
                                py::return_value_policy::reference)
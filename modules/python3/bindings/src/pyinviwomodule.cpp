@@ -38,6 +38,7 @@
 #include <inviwo/core/util/stringconversion.h>
 
 #include <modules/python3/polymorphictypehooks.h>
+#include <modules/python3/pybindutils.h>
 
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
@@ -45,6 +46,9 @@
 #include <pybind11/stl/filesystem.h>
 #include <pybind11/functional.h>
 
+#include <memory>
+#include <utility>
+
 namespace inviwo {
 
 #include <warn/push>
@@ -54,13 +58,15 @@ public:
     ProcessorFactoryObjectPythonWrapper(pybind11::object pfo)
         : ProcessorFactoryObject{pfo.cast<ProcessorFactoryObject*>()->getProcessorInfo(),
                                  "PythonProcessor"}
-        , pfo_(pfo) {}
+        , pfo_(pyutil::makeGilSafe(std::move(pfo))) {}
 
     virtual std::shared_ptr<Processor> create(InviwoApplication* app) const override {
-        return pfo_.cast<ProcessorFactoryObject*>()->create(app);
+        const pybind11::gil_scoped_acquire gil;
+        return pfo_->cast<ProcessorFactoryObject*>()->create(app);
     }
 
-    pybind11::object pfo_;
+    // The factory object is released from C++, which does not hold the GIL
+    std::shared_ptr<pybind11::object> pfo_;
 };
 
 class InviwoModuleFactoryObjectTrampoline : public InviwoModuleFactoryObject,
@@ -73,6 +79,7 @@ public:
     }
 
     virtual std::unique_ptr<InviwoModule> create(InviwoApplication* app) override {
+        const pybind11::gil_scoped_acquire gil;
         auto mod = createModule(app);
         auto m = std::unique_ptr<InviwoModule>(mod.cast<InviwoModule*>());
         mod.release();
@@ -40,6 +40,7 @@
 #include <inviwo/core/network/networkutils.h>
 #include <inviwo/core/links/propertylink.h>
 #include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/network/processornetworkevaluator.h>
 #include <inviwo/core/ports/port.h>
 #include <inviwo/core/ports/inport.h>
 #include <inviwo/core/ports/outport.h>
@@ -48,6 +49,9 @@
 
 #include <modules/python3/polymorphictypehooks.h>
 
+#include <map>
+#include <optional>
+
 namespace py = pybind11;
 
 namespace inviwo {
@@ -155,7 +159,9 @@ void exposeNetwork(py::module& m) {
         .def_property_readonly("linking", &ProcessorNetwork::isLinking)
         .def_property_readonly("runningBackgroundJobs", &ProcessorNetwork::runningBackgroundJobs)
         .def("lock", &ProcessorNetwork::lock)
-        .def("unlock", &ProcessorNetwork::unlock)
+        // Unlocking will evaluate the network, release the GIL so that processors running on the
+        // thread pool can call into Python
+        .def("unlock", &ProcessorNetwork::unlock, py::call_guard<py::gil_scoped_release>())
         .def("isLocked", &ProcessorNetwork::islocked)
         .def_property_readonly("locked", &ProcessorNetwork::islocked)
         .def_property_readonly("deserializing", &ProcessorNetwork::isDeserializing)
@@ -182,5 +188,58 @@ void exposeNetwork(py::module& m) {
         .def("append", [](ProcessorNetwork* network, const std::filesystem::path& path) {
             return util::appendProcessorNetwork(network, path, network->getApplication());
         });
+
+    py::enum_<EvaluationMode>(m, "EvaluationMode")
+        .value("Serial", EvaluationMode::Serial)
+        .value("Concurrent", EvaluationMode::Concurrent);
+
+    py::class_<EvaluationSample>(m, "EvaluationSample")
+        .def_readonly("process", &EvaluationSample::process)
+        .def_readonly("onChange", &EvaluationSample::onChange)
+        .def_readonly("initializeResources", &EvaluationSample::initializeResources)
+        .def_readonly("invalid", &EvaluationSample::invalid)
+        .def("__repr__", [](const EvaluationSample& s) {
+            return fmt::format(
+                "<EvaluationSample: process={}ms, onChange={}ms, initializeResources={}ms, "
+                "invalid={}ms>",
+                s.process, s.onChange, s.initializeResources, s.invalid);
+        });
+
+    py::class_<ProcessorMetrics>(m, "ProcessorMetrics")
+        .def_readonly("evaluations", &ProcessorMetrics::evaluations)
+        .def_readonly("skippedNotReady", &ProcessorMetrics::skippedNotReady)
+        .def_readonly("total", &ProcessorMetrics::total)
+        .def_readonly("history", &ProcessorMetrics::history)
+        .def("__repr__", [](const ProcessorMetrics& pm) {
+            return fmt::format("<ProcessorMetrics: evaluations={}, skippedNotReady={}>",
+                               pm.evaluations, pm.skippedNotReady);
+        });
+
+    py::class_<ProcessorNetworkEvaluator>(m, "ProcessorNetworkEvaluator")
+        .def_property("evaluationMode", &ProcessorNetworkEvaluator::getEvaluationMode,
+                      &ProcessorNetworkEvaluator::setEvaluationMode)
+        .def_property("metricsEnabled", &ProcessorNetworkEvaluator::getMetricsEnabled,
+                      &ProcessorNetworkEvaluator::setMetricsEnabled)
+        .def_property("metricsHistorySize", &ProcessorNetworkEvaluator::getMetricsHistorySize,
+                      &ProcessorNetworkEvaluator::setMetricsHistorySize)
+        .def_property_readonly(
+            "metrics",
+            [](const ProcessorNetworkEvaluator& evaluator) {
+                std::map<std::string, ProcessorMetrics> res;
+                for (const auto& [processor, metrics] : evaluator.getMetrics()) {
+                    res.emplace(processor->getIdentifier(), metrics);
+                }
+                return res;
+            },
+            "A copy of the evaluation metrics of each processor, keyed by processor identifier")
+        .def(
+            "getMetrics",
+            [](const ProcessorNetworkEvaluator& evaluator,
+               const Processor* processor) -> std::optional<ProcessorMetrics> {
+                if (auto metrics = evaluator.getMetrics(processor)) return *metrics;
+                return std::nullopt;
+            },
+            py::arg("processor"))
+        .def("clearMetrics", &ProcessorNetworkEvaluator::clearMetrics);
 }
 }  // namespace inviwo
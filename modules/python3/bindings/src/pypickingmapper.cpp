@@ -43,6 +43,9 @@
 #include <inviwo/core/properties/cameraproperty.h>
 #include <modules/python3/opaquetypes.h>
 #include <modules/python3/polymorphictypehooks.h>
+#include <modules/python3/pybindutils.h>
+
+#include <utility>
 
 namespace inviwo {
 
@@ -125,9 +128,12 @@ void exposePickingMapper(pybind11::module& m) {
 
     py::class_<PickingMapper>(m, "PickingMapper")
         .def(py::init([](Processor* p, size_t size, pybind11::function callback) {
-            return new PickingMapper(p, size, [callback](PickingEvent* e) {
+            // The callback is called and released from C++ without holding the GIL
+            auto func = pyutil::makeGilSafe(std::move(callback));
+            return new PickingMapper(p, size, [func](PickingEvent* e) {
+                const py::gil_scoped_acquire gil;
                 try {
-                    callback(py::cast(e));
+                    (*func)(py::cast(e));
                 } catch (const py::error_already_set& e) {
                     LogErrorCustom("pybind11", e.what());
                 }
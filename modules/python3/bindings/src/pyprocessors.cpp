@@ -45,6 +45,7 @@
 #include <inviwo/core/processors/processorinfo.h>      // for ProcessorInfo
 #include <inviwo/core/properties/invalidationlevel.h>  // for InvalidationLevel
 #include <inviwo/core/processors/canvasprocessor.h>
+#include <inviwo/core/processors/poolprocessor.h>
 #include <inviwo/core/processors/processorfactory.h>
 #include <inviwo/core/processors/processorfactoryobject.h>
 #include <inviwo/core/processors/processorwidget.h>
@@ -61,6 +62,8 @@
 #include <modules/python3/processortrampoline.h>
 #include <modules/python3/opaquetypes.h>
 #include <modules/python3/polymorphictypehooks.h>
+#include <modules/python3/pybindflags.h>
+#include <modules/python3/pybindutils.h>
 
 #include <fmt/format.h>
 #include <fmt/std.h>
@@ -79,6 +82,7 @@ public:
     }
 
     virtual std::shared_ptr<Processor> create(InviwoApplication* app) const override {
+        const pybind11::gil_scoped_acquire gil;
         auto proc = createProcessor(app);
         auto p = proc.cast<std::shared_ptr<Processor>>();
         return p;
@@ -96,6 +100,7 @@ public:
     }
 
     virtual std::unique_ptr<ProcessorWidget> create(Processor* processor) override {
+        const pybind11::gil_scoped_acquire gil;
         auto proc = createWidget(processor);
         auto p = proc.cast<std::unique_ptr<ProcessorWidget>>();
         return p;
@@ -103,6 +108,28 @@ public:
 };
 #include <warn/pop>
 
+namespace {
+
+// Python objects captured by pool jobs can be copied and released on any thread
+using PyObjectPtr = std::shared_ptr<pybind11::object>;
+
+using PoolJob = std::function<PyObjectPtr(pool::Stop, pool::Progress)>;
+
+PoolJob makePoolJob(pybind11::object job) {
+    return [job = pyutil::makeGilSafe(std::move(job))](pool::Stop stop, pool::Progress progress) {
+        // The GIL is only held by threads that run Python code, never while idle
+        const pybind11::gil_scoped_acquire gil;
+        try {
+            return pyutil::makeGilSafe((*job)(stop, progress));
+        } catch (const pybind11::error_already_set& e) {
+            throw Exception(IVW_CONTEXT_CUSTOM("PoolProcessor"), "Error in background job: {}",
+                            e.what());
+        }
+    };
+}
+
+}  // namespace
+
 void exposeProcessors(pybind11::module& m) {
     namespace py = pybind11;
 
@@ -298,6 +325,73 @@ void exposeProcessors(pybind11::module& m) {
             },
             py::return_value_policy::reference);
 
+    auto poolOption = py::enum_<pool::Option>(m, "PoolOption")
+                          .value("KeepOldResults", pool::Option::KeepOldResults)
+                          .value("QueuedDispatch", pool::Option::QueuedDispatch)
+                          .value("DelayDispatch", pool::Option::DelayDispatch)
+                          .value("DelayInvalidation", pool::Option::DelayInvalidation);
+    exposeFlags<pool::Option>(m, poolOption, "PoolOptions");
+
+    // Stop and Progress refer to the state of a running job, and are only valid inside that job
+    py::class_<pool::Stop>(m, "PoolStop")
+        .def("__bool__", [](const pool::Stop& stop) { return static_cast<bool>(stop); });
+
+    py::class_<pool::Progress>(m, "PoolProgress")
+        .def("__call__", [](const pool::Progress& progress, double value) { progress(value); })
+        .def("__call__",
+             [](const pool::Progress& progress, size_t i, size_t max) { progress(i, max); });
+
+    py::class_<PoolProcessor, Processor, PoolProcessorTrampoline>(
+        m, "PoolProcessor", py::multiple_inheritance{}, py::dynamic_attr{})
+        .def(py::init<pool::Options, const std::string&, const std::string&>(),
+             py::arg("options") = pool::Options{flags::empty}, py::arg("identifier") = "",
+             py::arg("displayName") = "")
+        .def("stopJobs", &PoolProcessor::stopJobs)
+        .def("hasJobs", &PoolProcessor::hasJobs)
+        .def_property_readonly("error", &PoolProcessor::error)
+        .def_property_readonly("options", &PoolProcessor::getOptions)
+        .def("newResults", py::overload_cast<>(&PoolProcessor::newResults))
+        .def("newResults",
+             py::overload_cast<const std::vector<Outport*>&>(&PoolProcessor::newResults))
+        .def(
+            "dispatchOne",
+            [](PoolProcessor& p, py::object job, py::object done) {
+                p.dispatchOne(makePoolJob(std::move(job)),
+                              [done = pyutil::makeGilSafe(std::move(done))](PyObjectPtr result) {
+                                  const py::gil_scoped_acquire gil;
+                                  (*done)(*result);
+                              });
+            },
+            py::arg("job"), py::arg("done"),
+            R"doc(
+Run job(stop, progress) on the thread pool and call done(result) on the main thread when it has
+finished. The job takes the GIL while it runs Python code, numpy and other extensions that release
+the GIL will run concurrently with the main thread and other jobs.
+)doc")
+        .def(
+            "dispatchMany",
+            [](PoolProcessor& p, std::vector<py::object> jobs, py::object done) {
+                std::vector<PoolJob> poolJobs;
+                poolJobs.reserve(jobs.size());
+                for (auto& job : jobs) {
+                    poolJobs.push_back(makePoolJob(std::move(job)));
+                }
+                p.dispatchMany(std::move(poolJobs), [done = pyutil::makeGilSafe(std::move(done))](
+                                                        std::vector<PyObjectPtr> results) {
+                    const py::gil_scoped_acquire gil;
+                    py::list list;
+                    for (auto& result : results) {
+                        list.append(*result);
+                    }
+                    (*done)(list);
+                });
+            },
+            py::arg("jobs"), py::arg("done"),
+            R"doc(
+Run each job(stop, progress) on the thread pool and call done(results) on the main thread with the
+list of results when all of them have finished.
+)doc");
+
     py::class_<CanvasProcessor, Processor>(m, "CanvasProcessor")
         .def_property("size", &CanvasProcessor::getCanvasSize, &CanvasProcessor::setCanvasSize)
         .def("getUseCustomDimensions", &CanvasProcessor::getUseCustomDimensions)
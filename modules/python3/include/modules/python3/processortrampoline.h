@@ -33,6 +33,7 @@
 #include <pybind11/trampoline_self_life_support.h>  // for trampoline_self_life_support
 
 #include <inviwo/core/processors/processor.h>          // for Processor
+#include <inviwo/core/processors/poolprocessor.h>      // for PoolProcessor
 #include <inviwo/core/processors/processorinfo.h>      // for ProcessorInfo
 #include <inviwo/core/properties/invalidationlevel.h>  // for InvalidationLevel
 
@@ -62,6 +63,26 @@ public:
     // Inherit the constructors
     using Processor::Processor;
 
+    // Trampoline (need one for each virtual function)
+    virtual void initializeResources() override;
+    virtual void process() override;
+    virtual void doIfNotReady() override;
+    virtual void setValid() override;
+    virtual void invalidate(InvalidationLevel invalidationLevel,
+                            Property* modifiedProperty = nullptr) override;
+    virtual const ProcessorInfo getProcessorInfo() const override;
+    virtual void invokeEvent(Event* event) override;
+    virtual void propagateEvent(Event* event, Outport* source) override;
+    virtual bool isMainThreadBound() const override;
+};
+
+class IVW_MODULE_PYTHON3_API PoolProcessorTrampoline
+    : public PoolProcessor,
+      public pybind11::trampoline_self_life_support {
+public:
+    // Inherit the constructors
+    using PoolProcessor::PoolProcessor;
+
     // Trampoline (need one for each virtual function)
     virtual void initializeResources() override;
     virtual void process() override;
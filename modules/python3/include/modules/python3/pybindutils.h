@@ -42,6 +42,7 @@
 #include <cstddef>  // for size_t
 #include <memory>   // for allocator, unique_ptr
 #include <string>   // for string, operator+, char_traits
+#include <utility>  // for move
 #include <vector>   // for vector
 
 namespace inviwo {
@@ -59,6 +60,26 @@ IVW_MODULE_PYTHON3_API std::unique_ptr<BufferBase> createBuffer(pybind11::array&
 IVW_MODULE_PYTHON3_API std::unique_ptr<Layer> createLayer(pybind11::array& arr);
 IVW_MODULE_PYTHON3_API std::unique_ptr<Volume> createVolume(pybind11::array& arr);
 
+/**
+ * Copy \p size bytes from \p src to \p dst with the GIL released, letting other Python threads
+ * run during large copies. The calling thread must hold the GIL, and both buffers have to stay
+ * alive and unmodified until the copy returns.
+ */
+IVW_MODULE_PYTHON3_API void copyWithoutGil(void* dst, const void* src, size_t size);
+
+/**
+ * Hold \p obj in a shared_ptr that acquires the GIL before releasing the reference. Use it for
+ * Python objects captured by C++ callbacks, which can be copied and destroyed on threads that do
+ * not hold the GIL. The calling thread must hold the GIL.
+ */
+template <typename T>
+std::shared_ptr<T> makeGilSafe(T obj) {
+    return std::shared_ptr<T>{new T{std::move(obj)}, [](T* ptr) {
+                                  const pybind11::gil_scoped_acquire gil;
+                                  delete ptr;
+                              }};
+}
+
 template <int Dim>
 void checkDataFormat(const DataFormatBase* format, const Vector<Dim, size_t>& dim,
                      const pybind11::array& data) {
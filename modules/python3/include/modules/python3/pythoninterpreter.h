@@ -37,6 +37,14 @@
 namespace inviwo {
 class Python3Module;
 
+/**
+ * \brief Embeds the Python interpreter.
+ * The main thread releases the GIL once the interpreter is initialized. Hence no thread holds the
+ * GIL while idle, and every entry point from C++ into Python, like running scripts, calling
+ * Python overrides of virtual functions, or releasing Python objects, has to acquire it with
+ * pybind11::gil_scoped_acquire. This lets jobs on the thread pool run Python code without waiting
+ * for the main thread.
+ */
 class IVW_MODULE_PYTHON3_API PythonInterpreter : public PythonExecutionOutputObservable {
 public:
     PythonInterpreter();
@@ -50,6 +58,7 @@ public:
 private:
     bool embedded_;
     bool isInit_;
+    void* mainThreadState_;  // PyThreadState of the main thread while the GIL is released
 };
 
 }  // namespace inviwo
@@ -43,7 +43,7 @@ namespace inviwo {
 class IVW_MODULE_PYTHON3_API PythonOutport : public Outport {
 public:
     PythonOutport(std::string_view identifier, Document help = {});
-    virtual ~PythonOutport() = default;
+    virtual ~PythonOutport();
 
     virtual std::string getClassIdentifier() const override;
     virtual glm::uvec3 getColorCode() const override { return uvec3{12, 240, 153}; }
@@ -31,6 +31,7 @@
 #include <modules/python3/python3moduledefine.h>  // for IVW_MODULE_PYTHON3_API
 
 #include <inviwo/core/util/fileobserver.h>  // for FileObserver
+#include <inviwo/core/util/dispatcher.h>    // for DispatcherHandle
 
 #include <string>  // for string
 #include <vector>  // for vector
@@ -39,6 +40,11 @@ namespace inviwo {
 class InviwoApplication;
 class InviwoModule;
 
+/**
+ * Registers a processor for each python script in the directory, and for scripts that are added
+ * or changed later. Compiling the scripts is slow, the initial registration is therefore deferred
+ * until the processors are first needed, see ProcessorFactory::deferRegistration.
+ */
 class IVW_MODULE_PYTHON3_API PythonProcessorFolderObserver : public FileObserver {
 public:
     PythonProcessorFolderObserver(InviwoApplication* app, const std::filesystem::path& directory,
@@ -46,6 +52,7 @@ public:
     virtual ~PythonProcessorFolderObserver() = default;
 
 private:
+    void registerFiles();
     bool registerFile(const std::filesystem::path& filename);
     virtual void fileChanged(const std::filesystem::path& filename) override;
 
@@ -53,6 +60,8 @@ private:
     std::filesystem::path directory_;
     std::vector<std::filesystem::path> registeredFiles_;
     InviwoModule& module_;
+    bool scanned_ = false;
+    DispatcherHandle<void()> deferredRegistration_;
 };
 
 }  // namespace inviwo
@@ -59,6 +59,14 @@ const DataFormatBase* format(pybind11::array data) {
     }
     return pyutil::getDataFormat(ndim == 2 ? 1 : data.shape(2), data);
 }
+
+// Representations are created from C++, which does not hold the GIL
+pybind11::array createArray(const DataFormatBase* format, size2_t dims) {
+    const pybind11::gil_scoped_acquire gil;
+    return pybind11::array(
+        pyutil::toNumPyFormat(format),
+        pybind11::array::ShapeContainer{dims.y, dims.x, format->getComponents()});
+}
 }  // namespace
 
 LayerPy::LayerPy(pybind11::array data, LayerType type, const SwizzleMask& swizzleMask,
@@ -77,9 +85,7 @@ LayerPy::LayerPy(size2_t dimensions, LayerType type, const DataFormatBase* forma
     , swizzleMask_{swizzleMask}
     , interpolation_{interpolation}
     , wrapping_{wrapping}
-    , data_{pybind11::array(pyutil::toNumPyFormat(format),
-                            pybind11::array::ShapeContainer{dimensions.y, dimensions.x,
-                                                            getDataFormat()->getComponents()})}
+    , data_{createArray(format, dimensions)}
     , dims_{dimensions} {}
 
 LayerPy::LayerPy(const LayerReprConfig& config)
@@ -90,14 +96,22 @@ LayerPy::LayerPy(const LayerReprConfig& config)
               config.interpolation.value_or(LayerConfig::defaultInterpolation),
               config.wrapping.value_or(LayerConfig::defaultWrapping)} {}
 
-LayerPy::~LayerPy() {}
+LayerPy::~LayerPy() {
+    // Representations can be released from any thread, only drop the array while holding the GIL
+    const pybind11::gil_scoped_acquire gil;
+    data_.release().dec_ref();
+}
 
-LayerPy* LayerPy::clone() const { return new LayerPy(*this); }
+LayerPy* LayerPy::clone() const {
+    const pybind11::gil_scoped_acquire gil;
+    return new LayerPy(*this);
+}
 
 std::type_index LayerPy::getTypeIndex() const { return std::type_index(typeid(LayerPy)); }
 
 void LayerPy::setDimensions(size2_t dimensions) {
     if (dimensions != dims_) {
+        const pybind11::gil_scoped_acquire gil;
         data_ = pybind11::array(data_.dtype(),
                                 pybind11::array::ShapeContainer{dimensions.y, dimensions.x,
                                                                 getDataFormat()->getComponents()});
@@ -105,7 +119,10 @@ void LayerPy::setDimensions(size2_t dimensions) {
     }
 }
 
-const DataFormatBase* LayerPy::getDataFormat() const { return format(data_); }
+const DataFormatBase* LayerPy::getDataFormat() const {
+    const pybind11::gil_scoped_acquire gil;
+    return format(data_);
+}
 
 const size2_t& LayerPy::getDimensions() const { return dims_; }
 
@@ -125,7 +142,9 @@ bool LayerPy::copyRepresentationsTo(LayerRepresentation*) const { return false;
 
 std::shared_ptr<LayerPy> LayerRAM2PyConverter::createFrom(
     std::shared_ptr<const LayerRAM> source) const {
-
+    // Conversions can be requested from threads that do not hold the GIL, e.g. during network
+    // evaluation, so make sure we have it before touching any numpy array.
+    const pybind11::gil_scoped_acquire gil;
     pybind11::array data = source->dispatch<pybind11::array>([](auto lr) {
         using ValueType = util::PrecisionValueType<decltype(lr)>;
         using CompType = typename util::value_type<ValueType>::type;
@@ -138,7 +157,7 @@ std::shared_ptr<LayerPy> LayerRAM2PyConverter::createFrom(
         pybind11::array_t<CompType> data{shape};
 
         if (pybind11::array::c_style == (data.flags() & pybind11::array::c_style)) {
-            std::memcpy(data.mutable_data(0), lr->getData(), data.nbytes());
+            pyutil::copyWithoutGil(data.mutable_data(0), lr->getData(), data.nbytes());
         } else {
             throw Exception(
                 "Unable to convert from LayerRM to LayerPy: numpy array is not C-contiguous.",
@@ -156,14 +175,15 @@ std::shared_ptr<LayerPy> LayerRAM2PyConverter::createFrom(
 
 void LayerRAM2PyConverter::update(std::shared_ptr<const LayerRAM> source,
                                   std::shared_ptr<LayerPy> destination) const {
+    const pybind11::gil_scoped_acquire gil;
     destination->setDimensions(source->getDimensions());
     destination->setSwizzleMask(source->getSwizzleMask());
     destination->setInterpolation(source->getInterpolation());
     destination->setWrapping(source->getWrapping());
 
     if (pybind11::array::c_style == (destination->data().flags() & pybind11::array::c_style)) {
-        std::memcpy(destination->data().mutable_data(0), source->getData(),
-                    destination->data().nbytes());
+        pyutil::copyWithoutGil(destination->data().mutable_data(0), source->getData(),
+                               destination->data().nbytes());
     } else {
         throw Exception(
             "Unable to convert from LayerRAM to LayerPy: numpy array is not C-contiguous.",
@@ -173,7 +193,7 @@ void LayerRAM2PyConverter::update(std::shared_ptr<const LayerRAM> source,
 
 std::shared_ptr<LayerRAM> LayerPy2RAMConverter::createFrom(
     std::shared_ptr<const LayerPy> source) const {
-
+    const pybind11::gil_scoped_acquire gil;
     auto destination =
         createLayerRAM(source->getDimensions(), source->getLayerType(), source->getDataFormat(),
                        source->getSwizzleMask(), source->getInterpolation(), source->getWrapping());
@@ -183,7 +203,7 @@ std::shared_ptr<LayerRAM> LayerPy2RAMConverter::createFrom(
     auto size = source->data().nbytes();
 
     if (pybind11::array::c_style == (source->data().flags() & pybind11::array::c_style)) {
-        std::memcpy(dst, src, size);
+        pyutil::copyWithoutGil(dst, src, size);
     } else {
         throw Exception(
             "Unable to convert from LayerPy to LayerRAM: numpy array is not C-contiguous.",
@@ -195,6 +215,7 @@ std::shared_ptr<LayerRAM> LayerPy2RAMConverter::createFrom(
 
 void LayerPy2RAMConverter::update(std::shared_ptr<const LayerPy> source,
                                   std::shared_ptr<LayerRAM> destination) const {
+    const pybind11::gil_scoped_acquire gil;
     destination->setDimensions(source->getDimensions());
     destination->setSwizzleMask(source->getSwizzleMask());
     destination->setInterpolation(source->getInterpolation());
@@ -205,7 +226,7 @@ void LayerPy2RAMConverter::update(std::shared_ptr<const LayerPy> source,
     auto size = source->data().nbytes();
 
     if (pybind11::array::c_style == (source->data().flags() & pybind11::array::c_style)) {
-        std::memcpy(dst, src, size);
+        pyutil::copyWithoutGil(dst, src, size);
     } else {
         throw Exception(
             "Unable to convert from LayerPy to LayerRAM: numpy array is not C-contiguous.",
@@ -32,6 +32,7 @@
 #include <pybind11/pybind11.h>  // for get_override, PYBIND11_OVERLOAD
 
 #include <inviwo/core/processors/processor.h>          // for Processor
+#include <inviwo/core/processors/poolprocessor.h>      // for PoolProcessor
 #include <inviwo/core/processors/processorinfo.h>      // for ProcessorInfo
 #include <inviwo/core/properties/invalidationlevel.h>  // for InvalidationLevel
 
@@ -61,5 +62,30 @@ void ProcessorTrampoline::invokeEvent(Event* event) {
 void ProcessorTrampoline::propagateEvent(Event* event, Outport* source) {
     PYBIND11_OVERLOAD(void, Processor, propagateEvent, event, source);
 }
+bool ProcessorTrampoline::isMainThreadBound() const {
+    PYBIND11_OVERLOAD(bool, Processor, isMainThreadBound, );
+}
+
+void PoolProcessorTrampoline::initializeResources() {
+    PYBIND11_OVERLOAD(void, PoolProcessor, initializeResources, );
+}
+void PoolProcessorTrampoline::process() { PYBIND11_OVERLOAD(void, PoolProcessor, process, ); }
+void PoolProcessorTrampoline::doIfNotReady() {
+    PYBIND11_OVERLOAD(void, PoolProcessor, doIfNotReady, );
+}
+void PoolProcessorTrampoline::setValid() { PYBIND11_OVERLOAD(void, PoolProcessor, setValid, ); }
+void PoolProcessorTrampoline::invalidate(InvalidationLevel invalidationLevel,
+                                         Property* modifiedProperty) {
+    PYBIND11_OVERLOAD(void, PoolProcessor, invalidate, invalidationLevel, modifiedProperty);
+}
+const ProcessorInfo PoolProcessorTrampoline::getProcessorInfo() const {
+    PYBIND11_OVERLOAD_PURE(const ProcessorInfo, PoolProcessor, getProcessorInfo, );
+}
+void PoolProcessorTrampoline::invokeEvent(Event* event) {
+    PYBIND11_OVERLOAD(void, PoolProcessor, invokeEvent, event);
+}
+void PoolProcessorTrampoline::propagateEvent(Event* event, Outport* source) {
+    PYBIND11_OVERLOAD(void, PoolProcessor, propagateEvent, event, source);
+}
 
 }  // namespace inviwo
@@ -41,7 +41,7 @@
 #include <inviwo/core/util/glmvec.h>             // for size2_t, size3_t
 #include <inviwo/core/util/exception.h>          // for Exception
 
-#include <cstring>        // for memcpy
+#include <cstring>        // for memcpy, size_t
 #include <unordered_map>  // for unordered_map
 #include <unordered_set>  // for unordered_set
 
@@ -51,6 +51,11 @@ class VolumeRAMPrecision;
 
 namespace pyutil {
 
+void copyWithoutGil(void* dst, const void* src, size_t size) {
+    const pybind11::gil_scoped_release release;
+    std::memcpy(dst, src, size);
+}
+
 pybind11::dtype toNumPyFormat(const DataFormatBase* df) {
     std::string format;
     switch (df->getNumericType()) {
@@ -108,7 +113,8 @@ std::unique_ptr<BufferBase> createBuffer(pybind11::array& arr) {
         return dispatching::singleDispatch<std::unique_ptr<BufferBase>, dispatching::filter::All>(
             df->getId(), [&]<typename Type>() {
                 auto buf = std::make_unique<Buffer<Type>>(arr.shape(0));
-                memcpy(buf->getEditableRAMRepresentation()->getData(), arr.data(0), arr.nbytes());
+                copyWithoutGil(buf->getEditableRAMRepresentation()->getData(), arr.data(0),
+                               arr.nbytes());
                 return buf;
             });
     } else {
@@ -132,7 +138,7 @@ std::unique_ptr<Layer> createLayer(pybind11::array& arr) {
             df->getId(), [&]<typename Type>() {
                 const size2_t dims(arr.shape(1), arr.shape(0));
                 auto layerRAM = std::make_shared<LayerRAMPrecision<Type>>(dims);
-                memcpy(layerRAM->getData(), arr.data(0), arr.nbytes());
+                copyWithoutGil(layerRAM->getData(), arr.data(0), arr.nbytes());
                 return std::make_unique<Layer>(layerRAM);
             });
     } else {
@@ -156,7 +162,7 @@ std::unique_ptr<Volume> createVolume(pybind11::array& arr) {
             df->getId(), [&]<typename Type>() {
                 const size3_t dims(arr.shape(2), arr.shape(1), arr.shape(0));
                 auto volumeRAM = std::make_shared<VolumeRAMPrecision<Type>>(dims);
-                memcpy(volumeRAM->getData(), arr.data(0), arr.nbytes());
+                copyWithoutGil(volumeRAM->getData(), arr.data(0), arr.nbytes());
                 return std::make_unique<Volume>(volumeRAM);
             });
     } else {
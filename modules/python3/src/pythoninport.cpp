@@ -79,6 +79,7 @@ Document PythonInport::getInfo() const {
     tb(H("Optional"), isOptional());
 
     if (hasData()) {
+        const pybind11::gil_scoped_acquire gil;
         b.append("p", pybind11::str(getData()).cast<std::string>());
     } else {
         b.append("p", "Port has no data");
@@ -57,7 +57,8 @@
 
 namespace inviwo {
 
-PythonInterpreter::PythonInterpreter() : embedded_{false}, isInit_(false) {
+PythonInterpreter::PythonInterpreter()
+    : embedded_{false}, isInit_(false), mainThreadState_{nullptr} {
     namespace py = pybind11;
 
     if (isInit_) {
@@ -157,12 +158,18 @@ sys.stderr = OutputRedirector(1)
             throw ModuleInitException(
                 IVW_CONTEXT, "Error while initializing the Python Interpreter\n{}", e.what());
         }
+
+        // Don't hold the GIL while idle, it is acquired where C++ calls into Python
+        mainThreadState_ = PyEval_SaveThread();
     }
 }
 
 PythonInterpreter::~PythonInterpreter() {
     namespace py = pybind11;
     if (embedded_) {
+        if (mainThreadState_) {
+            PyEval_RestoreThread(static_cast<PyThreadState*>(mainThreadState_));
+        }
         py::finalize_interpreter();
     }
 }
@@ -175,6 +182,7 @@ void PythonInterpreter::importModule(std::string_view moduleName) {
     namespace py = pybind11;
     SafeCStr str(moduleName);
 
+    const py::gil_scoped_acquire gil;
     auto dict = py::globals();
     dict[str] = py::module::import(str);
 }
@@ -182,6 +190,7 @@ void PythonInterpreter::importModule(std::string_view moduleName) {
 bool PythonInterpreter::runString(std::string_view code) {
     SafeCStr str(code);
 
+    const pybind11::gil_scoped_acquire gil;
     auto ret = PyRun_SimpleString(str);
     return ret == 0;
 }
@@ -39,6 +39,12 @@ PythonOutport::PythonOutport(std::string_view identifier, Document help)
         [this]() { return invalidationLevel_ == InvalidationLevel::Valid && !data_.is_none(); });
 }
 
+PythonOutport::~PythonOutport() {
+    // Ports are destroyed from C++, which does not hold the GIL
+    const pybind11::gil_scoped_acquire gil;
+    data_ = pybind11::object{};
+}
+
 Document PythonOutport::getInfo() const {
     Document doc;
     using P = Document::PathComponent;
@@ -54,6 +60,7 @@ Document PythonOutport::getInfo() const {
     tb(H("Connections"), connectedInports_.size());
 
     if (hasData()) {
+        const pybind11::gil_scoped_acquire gil;
         b.append("p", pybind11::str(getData()).cast<std::string>());
     } else {
         b.append("p", "Port has no data");
@@ -63,7 +70,11 @@ Document PythonOutport::getInfo() const {
 
 pybind11::object PythonOutport::getData() const { return data_; }
 
-void PythonOutport::clear() { data_ = pybind11::object{}; }
+void PythonOutport::clear() {
+    // Ports are cleared from C++, which does not hold the GIL
+    const pybind11::gil_scoped_acquire gil;
+    data_ = pybind11::object{};
+}
 
 void PythonOutport::setData(pybind11::object data) { data_ = data; }
 
@@ -73,6 +73,7 @@ std::shared_ptr<Processor> PythonProcessorFactoryObject::create(InviwoApplicatio
     namespace py = pybind11;
     const auto& pi = getProcessorInfo();
 
+    const py::gil_scoped_acquire gil;
     try {
         auto main = py::module::import("__main__");
         py::object proc =
@@ -161,6 +162,7 @@ PythonProcessorFactoryObjectData PythonProcessorFactoryObject::load(
         }
     }();
 
+    const py::gil_scoped_acquire gil;
     try {
         compileAndRun(script, file.generic_string());
     } catch (const py::error_already_set& e) {
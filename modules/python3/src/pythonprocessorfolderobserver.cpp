@@ -30,6 +30,8 @@
 #include <modules/python3/pythonprocessorfolderobserver.h>
 
 #include <inviwo/core/common/inviwomodule.h>                // for InviwoModule
+#include <inviwo/core/common/inviwoapplication.h>           // for InviwoApplication
+#include <inviwo/core/processors/processorfactory.h>        // for ProcessorFactory
 #include <inviwo/core/processors/processorfactoryobject.h>  // for ProcessorFactoryObject
 #include <inviwo/core/util/exception.h>                     // for Exception
 #include <inviwo/core/util/fileobserver.h>                  // for FileObserver
@@ -49,10 +51,22 @@ class InviwoApplication;
 PythonProcessorFolderObserver::PythonProcessorFolderObserver(InviwoApplication* app,
                                                              const std::filesystem::path& directory,
                                                              InviwoModule& module)
-    : FileObserver(app), app_(app), directory_{directory}, module_{module} {
+    : FileObserver(app)
+    , app_(app)
+    , directory_{directory}
+    , module_{module}
+    , deferredRegistration_{
+          app->getProcessorFactory()->deferRegistration([this]() { registerFiles(); })} {
 
-    if (std::filesystem::is_directory(directory)) {
-        for (auto&& item : std::filesystem::recursive_directory_iterator{directory}) {
+    startFileObservation(directory);
+}
+
+void PythonProcessorFolderObserver::registerFiles() {
+    if (scanned_) return;
+    scanned_ = true;
+
+    if (std::filesystem::is_directory(directory_)) {
+        for (auto&& item : std::filesystem::recursive_directory_iterator{directory_}) {
             if (item.is_regular_file() && item.path().extension() == ".py") {
                 if (!registerFile(item)) {
                     startFileObservation(item);
@@ -60,8 +74,6 @@ PythonProcessorFolderObserver::PythonProcessorFolderObserver(InviwoApplication*
             }
         }
     }
-
-    startFileObservation(directory);
 }
 
 bool PythonProcessorFolderObserver::registerFile(const std::filesystem::path& filename) {
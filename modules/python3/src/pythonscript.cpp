@@ -63,7 +63,11 @@ PythonScript PythonScript::fromFile(const std::filesystem::path& path) {
     return PythonScript{source, path.generic_string()};
 }
 
-PythonScript::~PythonScript() { Py_XDECREF(static_cast<PyObject*>(byteCode_)); }
+PythonScript::~PythonScript() {
+    if (!byteCode_) return;
+    const pybind11::gil_scoped_acquire gil;
+    Py_XDECREF(static_cast<PyObject*>(byteCode_));
+}
 
 void PythonScript::setName(std::string_view name) { name_ = name; }
 
@@ -72,13 +76,17 @@ const std::string& PythonScript::getName() const { return name_; }
 void PythonScript::setSource(std::string_view source) {
     source_ = source;
     isCompileNeeded_ = true;
-    Py_XDECREF(static_cast<PyObject*>(byteCode_));
-    byteCode_ = nullptr;
+    if (byteCode_) {
+        const pybind11::gil_scoped_acquire gil;
+        Py_XDECREF(static_cast<PyObject*>(byteCode_));
+        byteCode_ = nullptr;
+    }
 }
 
 const std::string& PythonScript::getSource() const { return source_; }
 
 bool PythonScript::compile() {
+    const pybind11::gil_scoped_acquire gil;
     Py_XDECREF(static_cast<PyObject*>(byteCode_));
     byteCode_ = Py_CompileString(source_.c_str(), name_.c_str(), Py_file_input);
     isCompileNeeded_ = !checkCompileError();
@@ -93,6 +101,7 @@ bool PythonScript::compile() {
 
 bool PythonScript::run(std::function<void(pybind11::dict)> callback) {
     namespace py = pybind11;
+    const py::gil_scoped_acquire gil;
 
     // Copy the dict to get a clean slate every time we run the script
     py::dict global = py::cast<py::dict>(PyDict_Copy(py::globals().ptr()));
@@ -102,6 +111,7 @@ bool PythonScript::run(std::function<void(pybind11::dict)> callback) {
 bool PythonScript::run(std::unordered_map<std::string, pybind11::object> locals,
                        std::function<void(pybind11::dict)> callback) {
     namespace py = pybind11;
+    const py::gil_scoped_acquire gil;
 
     // Copy the dict to get a clean slate every time we run the script
     py::dict global = py::cast<py::dict>(PyDict_Copy(py::globals().ptr()));
@@ -113,6 +123,7 @@ bool PythonScript::run(std::unordered_map<std::string, pybind11::object> locals,
 
 bool PythonScript::run(pybind11::dict locals, std::function<void(pybind11::dict)> callback) {
     namespace py = pybind11;
+    const py::gil_scoped_acquire gil;
 
     if (isCompileNeeded_ && !compile()) {
         return false;
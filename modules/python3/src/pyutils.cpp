@@ -54,6 +54,7 @@ void addModulePath(const std::filesystem::path& path) {
     }
 
     std::string pathConv{path.generic_string()};
+    const py::gil_scoped_acquire gil;
     py::module::import("sys").attr("path").cast<py::list>().append(pathConv);
 }
 
@@ -66,6 +67,7 @@ void removeModulePath(const std::filesystem::path& path) {
     }
 
     std::string pathConv{path.generic_string()};
+    const py::gil_scoped_acquire gil;
     py::module::import("sys").attr("path").attr("remove")(pathConv);
 }
 
@@ -72,6 +72,14 @@ const DataFormatBase* format(pybind11::array data) {
 
     return pyutil::getDataFormat(ndim == 3 ? 1 : data.shape(3), data);
 }
+
+// Representations are created from C++, which does not hold the GIL
+pybind11::array createArray(const DataFormatBase* format, size3_t dims) {
+    const pybind11::gil_scoped_acquire gil;
+    return pybind11::array(
+        pyutil::toNumPyFormat(format),
+        pybind11::array::ShapeContainer{dims.z, dims.y, dims.x, format->getComponents()});
+}
 }  // namespace
 
 VolumePy::VolumePy(pybind11::array data, const SwizzleMask& swizzleMask,
@@ -83,6 +91,7 @@ VolumePy::VolumePy(pybind11::array data, const SwizzleMask& swizzleMask,
     , data_{data}
     , dims_{data_.shape(2), data_.shape(1), data_.shape(0)} {
 
+    const pybind11::gil_scoped_acquire gil;
     resource::add(resource::toPY(data_), Resource{.dims = glm::size4_t{dims_, 0},
                                                   .format = format(data_)->getId(),
                                                   .desc = "VolumePY"});
@@ -94,11 +103,10 @@ VolumePy::VolumePy(size3_t dimensions, const DataFormatBase* format, const Swizz
     , swizzleMask_{swizzleMask}
     , interpolation_{interpolation}
     , wrapping_{wrapping}
-    , data_{pybind11::array(pyutil::toNumPyFormat(format),
-                            pybind11::array::ShapeContainer{dimensions.z, dimensions.y,
-                                                            dimensions.x, format->getComponents()})}
+    , data_{createArray(format, dimensions)}
     , dims_{dimensions} {
 
+    const pybind11::gil_scoped_acquire gil;
     resource::add(
         resource::toPY(data_),
         Resource{.dims = glm::size4_t{dims_, 0}, .format = format->getId(), .desc = "VolumePY"});
@@ -111,16 +119,28 @@ VolumePy::VolumePy(const VolumeReprConfig& config)
                config.interpolation.value_or(VolumeConfig::defaultInterpolation),
                config.wrapping.value_or(VolumeConfig::defaultWrapping)} {}
 
-VolumePy::~VolumePy() { resource::remove(resource::toPY(data_)); }
+VolumePy::~VolumePy() {
+    // Representations can be released from any thread, only drop the array while holding the GIL
+    const pybind11::gil_scoped_acquire gil;
+    resource::remove(resource::toPY(data_));
+    data_.release().dec_ref();
+}
 
-VolumePy* VolumePy::clone() const { return new VolumePy(*this); }
+VolumePy* VolumePy::clone() const {
+    const pybind11::gil_scoped_acquire gil;
+    return new VolumePy(*this);
+}
 
 std::type_index VolumePy::getTypeIndex() const { return std::type_index(typeid(VolumePy)); }
 
-const DataFormatBase* VolumePy::getDataFormat() const { return format(data_); }
+const DataFormatBase* VolumePy::getDataFormat() const {
+    const pybind11::gil_scoped_acquire gil;
+    return format(data_);
+}
 
 void VolumePy::setDimensions(size3_t dimensions) {
     if (dimensions != dims_) {
+        const pybind11::gil_scoped_acquire gil;
         const auto old = resource::remove(resource::toPY(data_));
         data_ = pybind11::array(
             data_.dtype(), pybind11::array::ShapeContainer{dimensions.z, dimensions.y, dimensions.x,
@@ -146,12 +166,15 @@ void VolumePy::setWrapping(const Wrapping3D& wrapping) { wrapping_ = wrapping; }
 Wrapping3D VolumePy::getWrapping() const { return wrapping_; }
 
 void VolumePy::updateResource(const ResourceMeta& meta) const {
+    const pybind11::gil_scoped_acquire gil;
     resource::meta(resource::toPY(data_), meta);
 }
 
 std::shared_ptr<VolumePy> VolumeRAM2PyConverter::createFrom(
     std::shared_ptr<const VolumeRAM> volumeSrc) const {
-
+    // Conversions can be requested from threads that do not hold the GIL, e.g. during network
+    // evaluation, so make sure we have it before touching any numpy array.
+    const pybind11::gil_scoped_acquire gil;
     pybind11::array data = volumeSrc->dispatch<pybind11::array>([](auto vr) {
         using ValueType = util::PrecisionValueType<decltype(vr)>;
         using CompType = typename util::value_type<ValueType>::type;
@@ -164,7 +187,7 @@ std::shared_ptr<VolumePy> VolumeRAM2PyConverter::createFrom(
         pybind11::array_t<CompType> data{shape};
 
         if (pybind11::array::c_style == (data.flags() & pybind11::array::c_style)) {
-            std::memcpy(data.mutable_data(0), vr->getData(), data.nbytes());
+            pyutil::copyWithoutGil(data.mutable_data(0), vr->getData(), data.nbytes());
         } else {
             throw Exception(
                 "Unable to convert from VolumeRAM to VolumePy: numpy array is not C-contiguous.",
@@ -181,14 +204,15 @@ std::shared_ptr<VolumePy> VolumeRAM2PyConverter::createFrom(
 
 void VolumeRAM2PyConverter::update(std::shared_ptr<const VolumeRAM> volumeSrc,
                                    std::shared_ptr<VolumePy> volumeDst) const {
+    const pybind11::gil_scoped_acquire gil;
     volumeDst->setDimensions(volumeSrc->getDimensions());
     volumeDst->setSwizzleMask(volumeSrc->getSwizzleMask());
     volumeDst->setInterpolation(volumeSrc->getInterpolation());
     volumeDst->setWrapping(volumeSrc->getWrapping());
 
     if (pybind11::array::c_style == (volumeDst->data().flags() & pybind11::array::c_style)) {
-        std::memcpy(volumeDst->data().mutable_data(0), volumeSrc->getData(),
-                    volumeDst->data().nbytes());
+        pyutil::copyWithoutGil(volumeDst->data().mutable_data(0), volumeSrc->getData(),
+                               volumeDst->data().nbytes());
     } else {
         throw Exception(
             "Unable to convert from VolumeRAM to VolumePy: numpy array is not C-contiguous.",
@@ -198,7 +222,7 @@ void VolumeRAM2PyConverter::update(std::shared_ptr<const VolumeRAM> volumeSrc,
 
 std::shared_ptr<VolumeRAM> VolumePy2RAMConverter::createFrom(
     std::shared_ptr<const VolumePy> volumeSrc) const {
-
+    const pybind11::gil_scoped_acquire gil;
     auto volumeDst = createVolumeRAM(volumeSrc->getDimensions(), volumeSrc->getDataFormat(),
                                      nullptr, volumeSrc->getSwizzleMask(),
                                      volumeSrc->getInterpolation(), volumeSrc->getWrapping());
@@ -208,7 +232,7 @@ std::shared_ptr<VolumeRAM> VolumePy2RAMConverter::createFrom(
     auto size = volumeSrc->data().nbytes();
 
     if (pybind11::array::c_style == (volumeSrc->data().flags() & pybind11::array::c_style)) {
-        std::memcpy(dst, src, size);
+        pyutil::copyWithoutGil(dst, src, size);
     } else {
         throw Exception(
             "Unable to convert from VolumePy to VolumeRAM: numpy array is not C-contiguous.",
@@ -220,6 +244,7 @@ std::shared_ptr<VolumeRAM> VolumePy2RAMConverter::createFrom(
 
 void VolumePy2RAMConverter::update(std::shared_ptr<const VolumePy> volumeSrc,
                                    std::shared_ptr<VolumeRAM> volumeDst) const {
+    const pybind11::gil_scoped_acquire gil;
     volumeDst->setDimensions(volumeSrc->getDimensions());
     volumeDst->setSwizzleMask(volumeSrc->getSwizzleMask());
     volumeDst->setInterpolation(volumeSrc->getInterpolation());
@@ -230,7 +255,7 @@ void VolumePy2RAMConverter::update(std::shared_ptr<const VolumePy> volumeSrc,
     auto size = volumeSrc->data().nbytes();
 
     if (pybind11::array::c_style == (volumeSrc->data().flags() & pybind11::array::c_style)) {
-        std::memcpy(dst, src, size);
+        pyutil::copyWithoutGil(dst, src, size);
     } else {
         throw Exception(
             "Unable to convert from VolumePy to VolumeRAM: numpy array is not C-contiguous.",
@@ -68,6 +68,8 @@ std::filesystem::path getPath() {
 }  // namespace
 
 TEST(Python3Scripts, SimpleBufferTest) {
+    // The values are converted and released outside of run
+    const pybind11::gil_scoped_acquire gil;
     auto script = PythonScript::fromFile(getPath() / "simple_buffer_test.py");
 
     const static size_t bufferSize = 10;
@@ -54,6 +54,8 @@
 
 #include <array>
 #include <algorithm>
+#include <numeric>
+#include <thread>
 
 namespace inviwo {
 
@@ -102,6 +104,9 @@ arr.shape = (3, 4, 2)
 }
 
 TEST(Python3Representations, LayerRAM2Py) {
+    // The test inspects the numpy arrays outside of the scripts
+    const pybind11::gil_scoped_acquire gil;
+
     // a 4 x 3 x 1 volume with two identical channels
     // voxel values increase in x direction
     std::array<int, 24> data = {0, 0, 1, 1, 2, 2, 3, 3, 4,  4,  5,  5,
@@ -189,6 +194,9 @@ arr.shape = (1, 3, 4, 2)
 }
 
 TEST(Python3Representations, VolumeRAM2Py) {
+    // The test inspects the numpy arrays outside of the scripts
+    const pybind11::gil_scoped_acquire gil;
+
     // a 4 x 3 x 1 volume with two identical channels
     // voxel values increase in x direction
     std::array<int, 24> data = {0, 0, 1, 1, 2, 2, 3, 3, 4,  4,  5,  5,
@@ -232,4 +240,25 @@ result = np.array_equal(expected, arr.flatten())
     EXPECT_TRUE(status);
 }
 
+TEST(Python3Representations, VolumeConversionWithoutGil) {
+    // Conversions can run on any thread, neither this thread nor the worker holds the GIL
+    const size3_t dims{4, 3, 2};
+    auto volumeRAM = std::make_shared<VolumeRAMPrecision<float>>(dims);
+    std::iota(volumeRAM->getDataTyped(), volumeRAM->getDataTyped() + glm::compMul(dims), 0.0f);
+
+    std::shared_ptr<VolumePy> volumepy;
+    std::shared_ptr<VolumeRAM> volumeram;
+    std::thread{[&]() {
+        volumepy = VolumeRAM2PyConverter{}.createFrom(volumeRAM);
+        volumeram = VolumePy2RAMConverter{}.createFrom(volumepy);
+        volumepy.reset();
+    }}.join();
+
+    ASSERT_TRUE(volumeram);
+    EXPECT_EQ(dims, volumeram->getDimensions());
+    const auto* src = volumeRAM->getDataTyped();
+    const auto* dst = static_cast<const float*>(volumeram->getData());
+    EXPECT_TRUE(std::equal(src, src + glm::compMul(dims), dst));
+}
+
 }  // namespace inviwo
@@ -33,6 +33,9 @@
 #include <warn/pop>
 
 #include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/network/processornetwork.h>
+#include <inviwo/core/processors/poolprocessor.h>
+#include <inviwo/core/util/raiiutils.h>
 #include <modules/python3/python3module.h>
 #include <modules/python3/pythonscript.h>
 #include <modules/python3/pybindutils.h>
@@ -43,6 +46,10 @@
 
 #include <glm/gtc/epsilon.hpp>
 
+#include <chrono>
+#include <optional>
+#include <thread>
+
 namespace inviwo {
 
 namespace {
@@ -83,6 +90,8 @@ TEST(Python3Scripts, GrabReturnValues) {
 }
 
 TEST(Python3Scripts, PassValues) {
+    // The values are converted and released outside of run
+    const pybind11::gil_scoped_acquire gil;
     auto script = PythonScript::fromFile(getPath() / "passvalues.py");
 
     bool status = false;
@@ -204,4 +213,38 @@ TEST(Python3Scripts, OptionPropertyTest) {
     EXPECT_TRUE(status);
 }
 
+TEST(Python3Scripts, PoolProcessorJob) {
+    auto* app = util::getInviwoApplication();
+    const auto poolSize = app->getPoolSize();
+    app->resizePool(2);
+    const util::OnScopeExit restorePool{[&]() { app->resizePool(poolSize); }};
+
+    // Keep the network locked so that nothing is evaluated while the job runs, the job must not
+    // depend on an evaluation releasing the GIL
+    auto* network = app->getProcessorNetwork();
+    network->lock();
+    const util::OnScopeExit unlock{[&]() { network->unlock(); }};
+
+    std::optional<int> result;
+    {
+        const pybind11::gil_scoped_acquire gil;
+        auto script = PythonScript::fromFile(getPath() / "pool_processor.py");
+        EXPECT_TRUE(script.run({{"done", pybind11::cpp_function([&](int v) { result = v; })}}));
+    }
+
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (!result && std::chrono::steady_clock::now() < timeout) {
+        app->processFront();
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    EXPECT_EQ(499500, result) << "The pool job did not finish";
+
+    const pybind11::gil_scoped_acquire gil;
+    auto* processor =
+        dynamic_cast<PoolProcessor*>(network->getProcessorByIdentifier("poolProcessor"));
+    ASSERT_NE(nullptr, processor);
+    EXPECT_FALSE(processor->hasJobs());
+    network->removeProcessor(processor);
+}
+
 }  // namespace inviwo
@@ -45,6 +45,8 @@ public:
         std::shared_ptr<const LayerPy> source) const override;
     virtual void update(std::shared_ptr<const LayerPy> source,
                         std::shared_ptr<LayerGL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 class IVW_MODULE_PYTHON3GL_API LayerGL2PyConverter
@@ -54,6 +56,8 @@ public:
         std::shared_ptr<const LayerGL> source) const override;
     virtual void update(std::shared_ptr<const LayerGL> source,
                         std::shared_ptr<LayerPy> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 }  // namespace inviwo
@@ -45,6 +45,8 @@ public:
         std::shared_ptr<const VolumeGL> source) const override;
     virtual void update(std::shared_ptr<const VolumeGL> source,
                         std::shared_ptr<VolumePy> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 class IVW_MODULE_PYTHON3GL_API VolumePy2GLConverter
@@ -54,6 +56,8 @@ public:
         std::shared_ptr<const VolumePy> source) const override;
     virtual void update(std::shared_ptr<const VolumePy> source,
                         std::shared_ptr<VolumeGL> destination) const override;
+
+    virtual ConversionCost getCost() const override { return ConversionCost::transfer(); }
 };
 
 }  // namespace inviwo
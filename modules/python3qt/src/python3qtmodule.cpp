@@ -104,6 +104,7 @@ Python3QtModule::Python3QtModule(InviwoApplication* app)
     namespace py = pybind11;
 
     try {
+        const py::gil_scoped_acquire gil;
         auto inviwopy = py::module::import("inviwopy");
         auto m = inviwopy.def_submodule("qt", "Qt dependent stuff");
 
@@ -132,6 +133,7 @@ Python3QtModule::Python3QtModule(InviwoApplication* app)
                      auto timer = new QTimer(qApp);
                      QObject::connect(timer, &QTimer::timeout, []() {
                          try {
+                             const py::gil_scoped_acquire gil;
                              py::exec("lambda x: 1");
                          } catch (...) {
                              LogInfoCustom("InviwoPyApp", "Aborted Qt event loop");
@@ -141,7 +143,9 @@ Python3QtModule::Python3QtModule(InviwoApplication* app)
                      timer->start(100);
 
                      qApp->exec();
-                 })
+                 },
+                 // Don't hold the GIL in the event loop, Python is only run from callbacks
+                 py::call_guard<py::gil_scoped_release>())
             .def(
                 "exit", [](int i) { qApp->exit(i); }, py::arg("exitCode") = 0)
             .def(
@@ -154,7 +158,9 @@ Python3QtModule::Python3QtModule(InviwoApplication* app)
                         app->processFront();
                     } while (app->getProcessorNetwork()->runningBackgroundJobs() > maxJobs);
                 },
-                py::arg("inviwoApplication"), py::arg("maxJobs") = 0)
+                py::arg("inviwoApplication"), py::arg("maxJobs") = 0,
+                // Background jobs might need the GIL to finish
+                py::call_guard<py::gil_scoped_release>())
 
             .def("address",
                  [](ProcessorWidget* w) {
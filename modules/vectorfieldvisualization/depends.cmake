@@ -7,3 +7,4 @@ set(dependencies
     InviwoBrushingAndLinkingModule  
 )
 set(EnableByDefault ON)
+set(threadSafe ON)
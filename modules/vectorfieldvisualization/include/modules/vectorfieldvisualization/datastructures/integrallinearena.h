@@ -0,0 +1,166 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <modules/vectorfieldvisualization/vectorfieldvisualizationmoduledefine.h>  // for IVW_M...
+
+#include <inviwo/core/datastructures/buffer/buffer.h>                      // for Buffer
+#include <inviwo/core/util/exception.h>                                    // for Exception
+#include <inviwo/core/util/glmvec.h>                                       // for dvec3
+#include <modules/vectorfieldvisualization/datastructures/integralline.h>  // for IntegralLine
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <map>      // for map
+#include <memory>   // for shared_ptr
+#include <string>   // for string
+#include <utility>  // for pair
+#include <vector>   // for vector
+
+namespace inviwo {
+
+/**
+ * \brief Structure of arrays storage for many integral lines.
+ * The points of all lines are stored in one flat array of positions and one flat buffer per meta
+ * data channel, and each line is a range of offsets into these arrays. Appending a point to the
+ * last line is a push_back into the flat arrays, no memory is allocated per line. This makes it
+ * suitable for tracing many lines, see IntegralLineTracer::traceInto. The lines are turned into
+ * IntegralLine objects by IntegralLineSet::append.
+ *
+ * The points of the line currently being appended are the ones after getLineBegin(). The line is
+ * completed by finishLine(), after which all meta data channels need to have as many points as
+ * the positions.
+ */
+class IVW_MODULE_VECTORFIELDVISUALIZATION_API IntegralLineArena {
+public:
+    using TerminationReason = IntegralLine::TerminationReason;
+    struct LineInfo {
+        uint32_t index = 0;
+        TerminationReason backward = TerminationReason::Unknown;
+        TerminationReason forward = TerminationReason::Unknown;
+    };
+
+    IntegralLineArena() = default;
+    IntegralLineArena(const IntegralLineArena&) = delete;
+    IntegralLineArena(IntegralLineArena&&) = default;
+    IntegralLineArena& operator=(const IntegralLineArena&) = delete;
+    IntegralLineArena& operator=(IntegralLineArena&&) = default;
+    ~IntegralLineArena() = default;
+
+    /**
+     * @return the number of finished lines
+     */
+    size_t size() const;
+
+    std::vector<dvec3>& getPositions();
+    const std::vector<dvec3>& getPositions() const;
+
+    /**
+     * Get the flat per point data of channel @p name, the channel is created if it does not exist.
+     * @throws Exception if the channel exists with another format
+     */
+    template <typename T>
+    std::vector<T>& getMetaData(const std::string& name);
+    /**
+     * @throws Exception if the channel does not exist or has another format
+     */
+    template <typename T>
+    const std::vector<T>& getMetaData(const std::string& name) const;
+    const std::map<std::string, std::shared_ptr<BufferBase>>& getMetaDataBuffers() const;
+
+    /**
+     * @return the range [begin, end) of the points of line @p line
+     */
+    std::pair<size_t, size_t> getRange(size_t line) const;
+    const LineInfo& getInfo(size_t line) const;
+
+    /**
+     * @return the index of the first point of the line being appended
+     */
+    size_t getLineBegin() const;
+    /**
+     * Complete the line being appended, consisting of the points after getLineBegin()
+     * @throws Exception if a meta data channel does not have as many points as the positions
+     */
+    void finishLine(const LineInfo& info);
+    /**
+     * Remove the last finished line and any points of the line being appended
+     */
+    void popLine();
+
+    /**
+     * Move the lines of @p other to the end of this arena. Both arenas need the same meta data
+     * channels, or this arena has to be empty.
+     * @throws Exception if the meta data channels do not match
+     */
+    void append(IntegralLineArena&& other);
+
+    /**
+     * Create an IntegralLine with the points and meta data of line @p line
+     */
+    IntegralLine getLine(size_t line) const;
+
+private:
+    std::vector<dvec3> positions_;
+    std::map<std::string, std::shared_ptr<BufferBase>> metaData_;
+    std::vector<size_t> offsets_{0};
+    std::vector<LineInfo> info_;
+};
+
+template <typename T>
+std::vector<T>& IntegralLineArena::getMetaData(const std::string& name) {
+    auto& buffer = metaData_[name];
+    if (!buffer) {
+        buffer = std::make_shared<Buffer<T>>();
+    } else if (buffer->getDataFormat() != DataFormat<T>::get()) {
+        throw Exception(IVW_CONTEXT,
+                        "Incorrect data format for meta data {}, asking for {} but is {}", name,
+                        DataFormat<T>::str(), buffer->getDataFormat()->getString());
+    }
+    return static_cast<Buffer<T>*>(buffer.get())
+        ->getEditableRAMRepresentation()
+        ->getDataContainer();
+}
+
+template <typename T>
+const std::vector<T>& IntegralLineArena::getMetaData(const std::string& name) const {
+    auto it = metaData_.find(name);
+    if (it == metaData_.end()) {
+        throw Exception(IVW_CONTEXT, "No meta data with name: {}", name);
+    } else if (it->second->getDataFormat() != DataFormat<T>::get()) {
+        throw Exception(IVW_CONTEXT,
+                        "Incorrect data format for meta data {}, asking for {} but is {}", name,
+                        DataFormat<T>::str(), it->second->getDataFormat()->getString());
+    }
+    return static_cast<const Buffer<T>*>(it->second.get())
+        ->getRAMRepresentation()
+        ->getDataContainer();
+}
+
+}  // namespace inviwo
@@ -40,12 +40,15 @@
 #include <modules/vectorfieldvisualization/datastructures/integralline.h>  // for Integ...
 
 #include <cstddef>  // for size_t
+#include <span>     // for span
 #include <sstream>  // for opera...
 #include <string>   // for char_...
 #include <vector>   // for vector
 
 namespace inviwo {
 
+class IntegralLineArena;
+
 class IVW_MODULE_VECTORFIELDVISUALIZATION_API IntegralLineSet {
 public:
     enum class SetIndex { Yes, No };
@@ -83,6 +86,17 @@ public:
     void push_back(IntegralLine&& line, SetIndex updateIndex);
     void push_back(IntegralLine&& line, size_t idx);
 
+    /**
+     * Append all lines of @p arena, keeping the indices and termination reasons of the lines
+     */
+    void append(const IntegralLineArena& arena);
+    /**
+     * Append all lines of @p arenas in order, keeping the indices and termination reasons of the
+     * lines. The arenas are converted concurrently on the thread pool, each into its own range of
+     * lines.
+     */
+    void append(std::span<const IntegralLineArena> arenas);
+
     std::vector<IntegralLine>& getVector() { return lines_; }
     const std::vector<IntegralLine>& getVector() const { return lines_; }
 
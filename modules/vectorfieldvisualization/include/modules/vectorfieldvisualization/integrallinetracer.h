@@ -36,9 +36,13 @@
 #include <inviwo/core/util/spatial4dsampler.h>  // IWUY pragma: keep
 #include <inviwo/core/util/typetraits.h>
 #include <modules/vectorfieldvisualization/datastructures/integralline.h>        // for Integral...
+#include <modules/vectorfieldvisualization/datastructures/integrallinearena.h>   // for Integral...
 #include <modules/vectorfieldvisualization/properties/integrallineproperties.h>  // for Integral...
 
+#include <algorithm>      // for clamp, max
+#include <cmath>          // for abs, pow
 #include <cstddef>        // for size_t
+#include <cstdint>        // for uint32_t
 #include <limits>         // for numeric_...
 #include <memory>         // for shared_ptr
 #include <string>         // for string
@@ -56,7 +60,8 @@ public:
     struct Result {
         IntegralLine line;
         size_t seedIndex{0};
-        operator IntegralLine() const { return line; }
+        operator IntegralLine() const& { return line; }
+        operator IntegralLine() && { return std::move(line); }
     };
 
     const static bool IsTimeDependent = TimeDependent;
@@ -79,6 +84,14 @@ public:
 
     Result traceFrom(const SpatialVector& pIn) const;
 
+    /**
+     * Trace a line from @p pIn and append it to @p arena as a finished line with index @p index.
+     * Unlike traceFrom, no memory is allocated per line, the points are appended to the flat
+     * arrays of the arena.
+     * @return the index of the seed point within the appended line
+     */
+    size_t traceInto(IntegralLineArena& arena, const SpatialVector& pIn, uint32_t index) const;
+
     void addMetaDataSampler(const std::string& name, std::shared_ptr<const Sampler> sampler);
 
     const DataHomogeneousSpatialMatrix& getSeedTransformationMatrix() const;
@@ -90,27 +103,74 @@ private:
         bool outOfBounds;
     };
 
+    /**
+     * The containers of the line being traced, looked up once per line instead of once per point.
+     * The meta data containers are in the iteration order of metaSamplers_. The line consists of
+     * the elements from @p begin to the end of the containers.
+     */
+    struct LineData {
+        std::vector<dvec3>& positions;
+        std::vector<dvec3>& velocities;
+        std::vector<double>* timestamps;
+        std::vector<std::vector<typename Sampler::type>*> metaData;
+        size_t begin;
+
+        size_t size() const { return positions.size() - begin; }
+        void reverse() {
+            std::reverse(positions.begin() + begin, positions.end());
+            std::reverse(velocities.begin() + begin, velocities.end());
+            if (timestamps) std::reverse(timestamps->begin() + begin, timestamps->end());
+            for (auto* m : metaData) std::reverse(m->begin() + begin, m->end());
+        }
+    };
+
+    struct Traced {
+        IntegralLine::TerminationReason backward = IntegralLine::TerminationReason::Unknown;
+        IntegralLine::TerminationReason forward = IntegralLine::TerminationReason::Unknown;
+        size_t seedIndex = 0;
+    };
+
+    /**
+     * Trace a line from the transformed seed point @p p into @p line
+     */
+    Traced trace(LineData& line, const SpatialVector& p) const;
+
     inline SpatialVector seedTransform(const SpatialVector& seed) const;
 
     StepResult step(const SpatialVector& oldPos, double stepSize) const;
+    /**
+     * Take one step with the embedded Dormand-Prince 5(4) method. The step is retried with a
+     * smaller step size until the estimated error is within the tolerance or the minimum step
+     * size is reached. @p stepSize is updated to the size suggested for the next step.
+     */
+    StepResult adaptiveStep(const SpatialVector& oldPos, double& stepSize) const;
+    /**
+     * Move @p pos by @p offset given in model space, and by @p dt in time for time dependent
+     * samplers.
+     */
+    SpatialVector displace(const SpatialVector& pos, const DataVector& offset, double dt) const;
 
-    bool addPoint(IntegralLine& line, const SpatialVector& pos) const;
-    bool addPoint(IntegralLine& line, const SpatialVector& pos,
-                  const DataVector& worldVelocity) const;
+    bool addPoint(LineData& line, const SpatialVector& pos) const;
+    bool addPoint(LineData& line, const SpatialVector& pos, const DataVector& worldVelocity) const;
 
-    IntegralLine::TerminationReason integrate(size_t steps, SpatialVector pos, IntegralLine& line,
-                                              bool fwd) const;
+    IntegralLine::TerminationReason integrate(size_t steps, double maxLength, SpatialVector pos,
+                                              LineData& line, bool fwd) const;
 
     IntegralLineProperties::IntegrationScheme integrationScheme_;
 
     int steps_;
     double stepSize_;
+    double errorTolerance_;
+    double minStepSize_;
+    double maxStepSize_;
+    double maxLength_;
     IntegralLineProperties::Direction dir_;
     bool normalizeSamples_;
 
     std::shared_ptr<const Sampler> sampler_;
     std::unordered_map<std::string, std::shared_ptr<const Sampler>> metaSamplers_;
 
+    DataMatrix basis_;
     DataMatrix invBasis_;
     DataHomogeneousSpatialMatrix seedTransformation_;
 };
@@ -121,60 +181,104 @@ IntegralLineTracer<SpatialSampler, TimeDependent>::IntegralLineTracer(
     : integrationScheme_(properties.getIntegrationScheme())
     , steps_(properties.getNumberOfSteps())
     , stepSize_(properties.getStepSize())
+    , errorTolerance_(properties.getErrorTolerance())
+    , minStepSize_(properties.getMinStepSize())
+    , maxStepSize_(std::max(properties.getMaxStepSize(), properties.getMinStepSize()))
+    , maxLength_(properties.getMaxLength())
     , dir_(properties.getStepDirection())
     , normalizeSamples_(properties.getNormalizeSamples())
     , sampler_(sampler)
-    , invBasis_(glm::inverse(DataMatrix(sampler->getModelMatrix())))
+    , basis_(sampler->getModelMatrix())
+    , invBasis_(glm::inverse(basis_))
     , seedTransformation_(
           properties.getSeedPointTransformationMatrix(sampler->getCoordinateTransformer())) {}
 
 template <typename SpatialSampler, bool TimeDependent>
-typename IntegralLineTracer<SpatialSampler, TimeDependent>::Result
-IntegralLineTracer<SpatialSampler, TimeDependent>::traceFrom(const SpatialVector& pIn) const {
-    const SpatialVector p = seedTransform(pIn);
-    Result res;
-    IntegralLine& line = res.line;
-
+auto IntegralLineTracer<SpatialSampler, TimeDependent>::trace(LineData& line,
+                                                              const SpatialVector& p) const
+    -> Traced {
+    Traced res;
     const auto [stepsBWD, stepsFWD] = [dir = dir_, steps = steps_,
-                                       &line]() -> std::pair<size_t, size_t> {
+                                       &res]() -> std::pair<size_t, size_t> {
         switch (dir) {
             case inviwo::IntegralLineProperties::Direction::Forward:
-                line.setBackwardTerminationReason(IntegralLine::TerminationReason::StartPoint);
-                return {1, steps + 1};
+                res.backward = IntegralLine::TerminationReason::StartPoint;
+                return {0, steps};
             case inviwo::IntegralLineProperties::Direction::Backward:
-                line.setForwardTerminationReason(IntegralLine::TerminationReason::StartPoint);
-                return {steps + 1, 1};
+                res.forward = IntegralLine::TerminationReason::StartPoint;
+                return {steps, 0};
             default:
             case inviwo::IntegralLineProperties::Direction::Bidirectional: {
-                return {steps / 2 + 1, steps - (steps / 2) + 1};
+                return {steps / 2, steps - (steps / 2)};
             }
         }
     }();
 
-    line.getPositions().reserve(steps_ + 2);
-    line.getMetaData<dvec3>("velocity", true).reserve(steps_ + 2);
+    if (!addPoint(line, p)) {
+        return res;  // Zero velocity at seed point
+    }
 
-    if constexpr (TimeDependent) {
-        line.getMetaData<double>("timestamp", true).reserve(steps_ + 2);
+    // like the steps, the length is split between the directions of bidirectional lines
+    const double maxLength =
+        dir_ == IntegralLineProperties::Direction::Bidirectional ? maxLength_ / 2.0 : maxLength_;
+
+    res.backward = integrate(stepsBWD, maxLength, p, line, false);
+
+    if (line.size() > 1) {
+        line.reverse();
+        res.seedIndex = line.size() - 1;
     }
 
-    for (auto& m : metaSamplers_) {
-        line.getMetaData<typename Sampler::type>(m.first, true).reserve(steps_ + 2);
+    res.forward = integrate(stepsFWD, maxLength, p, line, true);
+    return res;
+}
+
+template <typename SpatialSampler, bool TimeDependent>
+typename IntegralLineTracer<SpatialSampler, TimeDependent>::Result
+IntegralLineTracer<SpatialSampler, TimeDependent>::traceFrom(const SpatialVector& pIn) const {
+    Result res;
+    IntegralLine& line = res.line;
+
+    LineData data{line.getPositions(), line.getMetaData<dvec3>("velocity", true), nullptr, {}, 0};
+    data.positions.reserve(steps_ + 2);
+    data.velocities.reserve(steps_ + 2);
+
+    if constexpr (TimeDependent) {
+        data.timestamps = &line.getMetaData<double>("timestamp", true);
+        data.timestamps->reserve(steps_ + 2);
     }
 
-    if (!addPoint(line, p)) {
-        return res;  // Zero velocity at seed point
+    data.metaData.reserve(metaSamplers_.size());
+    for (auto& m : metaSamplers_) {
+        auto& metaData = line.getMetaData<typename Sampler::type>(m.first, true);
+        metaData.reserve(steps_ + 2);
+        data.metaData.push_back(&metaData);
     }
 
-    line.setBackwardTerminationReason(integrate(stepsBWD, p, line, false));
+    const auto traced = trace(data, seedTransform(pIn));
+    line.setBackwardTerminationReason(traced.backward);
+    line.setForwardTerminationReason(traced.forward);
+    res.seedIndex = traced.seedIndex;
+    return res;
+}
 
-    if (line.getPositions().size() > 1) {
-        line.reverse();
-        res.seedIndex = line.getPositions().size() - 1;
+template <typename SpatialSampler, bool TimeDependent>
+size_t IntegralLineTracer<SpatialSampler, TimeDependent>::traceInto(IntegralLineArena& arena,
+                                                                    const SpatialVector& pIn,
+                                                                    uint32_t index) const {
+    LineData data{arena.getPositions(), arena.getMetaData<dvec3>("velocity"), nullptr, {},
+                  arena.getLineBegin()};
+    if constexpr (TimeDependent) {
+        data.timestamps = &arena.getMetaData<double>("timestamp");
+    }
+    data.metaData.reserve(metaSamplers_.size());
+    for (auto& m : metaSamplers_) {
+        data.metaData.push_back(&arena.getMetaData<typename Sampler::type>(m.first));
     }
 
-    line.setForwardTerminationReason(integrate(stepsFWD, p, line, true));
-    return res;
+    const auto traced = trace(data, seedTransform(pIn));
+    arena.finishLine({index, traced.backward, traced.forward});
+    return traced.seedIndex;
 }
 
 template <typename SpatialSampler, bool TimeDependent>
@@ -214,17 +318,7 @@ auto IntegralLineTracer<SpatialSampler, TimeDependent>::step(const SpatialVector
         if (normalizeSamples_) {
             v = normalize(v);
         }
-        DataVector offset = (invBasis_ * (v * stepsize));
-        if constexpr (TimeDependent) {
-            return pos + SpatialVector(offset, stepsize);
-        } else if constexpr (SampleDim == 3) {
-            return pos + offset;
-        } else if constexpr (SampleDim == 2) {
-            return SpatialVector{DataVector{pos} + offset, 0.0};
-        } else {
-            static_assert(util::alwaysFalse<SpatialSampler>(),
-                          "Unsupported number of DataDimensions");
-        }
+        return displace(pos, v * stepsize, stepsize);
     };
 
     auto k1 = sampler_->sample(oldPos);
@@ -266,50 +360,154 @@ auto IntegralLineTracer<SpatialSampler, TimeDependent>::step(const SpatialVector
 }
 
 template <typename SpatialSampler, bool TimeDependent>
-bool IntegralLineTracer<SpatialSampler, TimeDependent>::addPoint(IntegralLine& line,
+auto IntegralLineTracer<SpatialSampler, TimeDependent>::adaptiveStep(const SpatialVector& oldPos,
+                                                                     double& stepSize) const
+    -> StepResult {
+    // Dormand-Prince 5(4) coefficients
+    constexpr double c2 = 1.0 / 5.0, c3 = 3.0 / 10.0, c4 = 4.0 / 5.0, c5 = 8.0 / 9.0;
+    constexpr double a21 = 1.0 / 5.0;
+    constexpr double a31 = 3.0 / 40.0, a32 = 9.0 / 40.0;
+    constexpr double a41 = 44.0 / 45.0, a42 = -56.0 / 15.0, a43 = 32.0 / 9.0;
+    constexpr double a51 = 19372.0 / 6561.0, a52 = -25360.0 / 2187.0, a53 = 64448.0 / 6561.0,
+                     a54 = -212.0 / 729.0;
+    constexpr double a61 = 9017.0 / 3168.0, a62 = -355.0 / 33.0, a63 = 46732.0 / 5247.0,
+                     a64 = 49.0 / 176.0, a65 = -5103.0 / 18656.0;
+    // fifth order weights, also the last row of the Butcher tableau
+    constexpr double b1 = 35.0 / 384.0, b3 = 500.0 / 1113.0, b4 = 125.0 / 192.0,
+                     b5 = -2187.0 / 6784.0, b6 = 11.0 / 84.0;
+    // difference between the fifth and fourth order weights
+    constexpr double e1 = 71.0 / 57600.0, e3 = -71.0 / 16695.0, e4 = 71.0 / 1920.0,
+                     e5 = -17253.0 / 339200.0, e6 = 22.0 / 525.0, e7 = -1.0 / 40.0;
+
+    const double direction = stepSize < 0.0 ? -1.0 : 1.0;
+    const auto nextStepSize = [&](double h, double factor) {
+        return direction * std::clamp(std::abs(h) * factor, minStepSize_, maxStepSize_);
+    };
+
+    const auto velocity = [&](const SpatialVector& pos) -> DataVector {
+        const DataVector v = sampler_->sample(pos);
+        if (!normalizeSamples_) return v;
+        const auto l = glm::length(v);
+        return l == 0.0 ? v : v / l;
+    };
+
+    const DataVector data = sampler_->sample(oldPos);
+    const DataVector k1 = velocity(oldPos);
+
+    double h = nextStepSize(stepSize, 1.0);
+    while (true) {
+        const auto stage = [&](const DataVector& offset, double c, DataVector& k) -> bool {
+            const auto pos = displace(oldPos, offset * h, c * h);
+            if (!sampler_->withinBounds(pos)) return false;
+            k = velocity(pos);
+            return true;
+        };
+
+        DataVector k2, k3, k4, k5, k6, k7;
+        const bool withinBounds =
+            stage(a21 * k1, c2, k2) && stage(a31 * k1 + a32 * k2, c3, k3) &&
+            stage(a41 * k1 + a42 * k2 + a43 * k3, c4, k4) &&
+            stage(a51 * k1 + a52 * k2 + a53 * k3 + a54 * k4, c5, k5) &&
+            stage(a61 * k1 + a62 * k2 + a63 * k3 + a64 * k4 + a65 * k5, 1.0, k6) &&
+            stage(b1 * k1 + b3 * k3 + b4 * k4 + b5 * k5 + b6 * k6, 1.0, k7);
+
+        if (!withinBounds) {
+            // try to get closer to the boundary before giving up
+            if (std::abs(h) <= minStepSize_) return {oldPos, data, true};
+            h = nextStepSize(h, 0.5);
+            continue;
+        }
+
+        const DataVector error = h * (e1 * k1 + e3 * k3 + e4 * k4 + e5 * k5 + e6 * k6 + e7 * k7);
+        const double errorNorm = glm::length(error);
+
+        // standard step size controller with a safety factor and limited growth and shrinkage
+        const double factor =
+            errorNorm == 0.0 ? 5.0
+                             : std::clamp(0.9 * std::pow(errorTolerance_ / errorNorm, 0.2), 0.2,
+                                          5.0);
+
+        if (errorNorm <= errorTolerance_ || std::abs(h) <= minStepSize_) {
+            stepSize = nextStepSize(h, factor);
+            return {displace(oldPos, h * (b1 * k1 + b3 * k3 + b4 * k4 + b5 * k5 + b6 * k6), h),
+                    data, false};
+        }
+        h = nextStepSize(h, factor);
+    }
+}
+
+template <typename SpatialSampler, bool TimeDependent>
+auto IntegralLineTracer<SpatialSampler, TimeDependent>::displace(const SpatialVector& pos,
+                                                                 const DataVector& offset,
+                                                                 double dt) const
+    -> SpatialVector {
+    const DataVector dataOffset = invBasis_ * offset;
+    if constexpr (TimeDependent) {
+        return pos + SpatialVector(dataOffset, dt);
+    } else if constexpr (SampleDim == 3) {
+        return pos + dataOffset;
+    } else if constexpr (SampleDim == 2) {
+        return SpatialVector{DataVector{pos} + dataOffset, 0.0};
+    } else {
+        static_assert(util::alwaysFalse<SpatialSampler>(), "Unsupported number of DataDimensions");
+    }
+}
+
+template <typename SpatialSampler, bool TimeDependent>
+bool IntegralLineTracer<SpatialSampler, TimeDependent>::addPoint(LineData& line,
                                                                  const SpatialVector& pos) const {
     return addPoint(line, pos, sampler_->sample(pos));
 }
 
 template <typename SpatialSampler, bool TimeDependent>
 bool IntegralLineTracer<SpatialSampler, TimeDependent>::addPoint(
-    IntegralLine& line, const SpatialVector& pos, const DataVector& worldVelocity) const {
+    LineData& line, const SpatialVector& pos, const DataVector& worldVelocity) const {
 
     if (glm::length(worldVelocity) < std::numeric_limits<double>::epsilon()) {
         return false;
     }
 
-    line.getPositions().emplace_back(util::glm_convert<dvec3>(pos));
-    line.getMetaData<dvec3>("velocity").emplace_back(util::glm_convert<dvec3>(worldVelocity));
+    line.positions.emplace_back(util::glm_convert<dvec3>(pos));
+    line.velocities.emplace_back(util::glm_convert<dvec3>(worldVelocity));
 
     if constexpr (TimeDependent) {
-        line.getMetaData<double>("timestamp").emplace_back(pos[Sampler::SpatialDimensions - 1]);
+        line.timestamps->emplace_back(pos[Sampler::SpatialDimensions - 1]);
     }
 
+    auto metaData = line.metaData.begin();
     for (auto& m : metaSamplers_) {
-        line.getMetaData<typename Sampler::type>(m.first).emplace_back(
-            util::glm_convert<dvec3>(m.second->sample(pos)));
+        (*metaData++)->emplace_back(util::glm_convert<dvec3>(m.second->sample(pos)));
     }
     return true;
 }
 
 template <typename SpatialSampler, bool TimeDependent>
 IntegralLine::TerminationReason IntegralLineTracer<SpatialSampler, TimeDependent>::integrate(
-    size_t steps, SpatialVector pos, IntegralLine& line, bool fwd) const {
+    size_t steps, double maxLength, SpatialVector pos, LineData& line, bool fwd) const {
     if (steps == 0) return IntegralLine::TerminationReason::StartPoint;
+
+    const bool adaptive =
+        integrationScheme_ == IntegralLineProperties::IntegrationScheme::RK45;
+    double stepSize = stepSize_ * (fwd ? 1.0 : -1.0);
+    double length = 0.0;
+
     for (size_t i = 0; i < steps; i++) {
         if (!sampler_->withinBounds(pos)) {
             return IntegralLine::TerminationReason::OutOfBounds;
         }
-        StepResult result = step(pos, stepSize_ * (fwd ? 1.0 : -1.0));
+        StepResult result = adaptive ? adaptiveStep(pos, stepSize) : step(pos, stepSize);
         if (result.outOfBounds) {
             return IntegralLine::TerminationReason::OutOfBounds;
         }
+        length += glm::length(basis_ * DataVector{result.position - pos});
         pos = result.position;
 
         if (!addPoint(line, result.position, result.data)) {
             return IntegralLine::TerminationReason::ZeroVelocity;
         }
+        if (maxLength > 0.0 && length >= maxLength) {
+            return IntegralLine::TerminationReason::Length;
+        }
     }
     return IntegralLine::TerminationReason::Steps;
 }
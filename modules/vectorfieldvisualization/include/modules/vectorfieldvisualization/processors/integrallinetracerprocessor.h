@@ -39,10 +39,16 @@
 #include <inviwo/core/ports/imageport.h>
 #include <inviwo/core/util/utilities.h>
 #include <inviwo/core/util/foreach.h>
+#include <modules/vectorfieldvisualization/datastructures/integrallinearena.h>
 #include <modules/vectorfieldvisualization/algorithms/integrallineoperations.h>
 #include <modules/vectorfieldvisualization/integrallinetracer.h>
 #include <modules/vectorfieldvisualization/ports/seedpointsport.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
 namespace inviwo {
 
 template <typename Tracer>
@@ -113,19 +119,36 @@ void IntegralLineTracerProcessor<Tracer>::process() {
         tracer.addMetaDataSampler(key, meta.second);
     }
 
-    std::mutex mutex;
+    // Each job traces a contiguous range of seeds into an arena of its own. Appending the arenas
+    // of the jobs in order afterwards keeps the lines sorted by seed without any locking.
+    const size_t jobs = std::max<size_t>(1, 4 * util::getPoolSize());
+    std::vector<size_t> jobIndices(jobs);
+    std::iota(jobIndices.begin(), jobIndices.end(), size_t{0});
+
+    std::vector<IntegralLineArena> arenas;
     size_t startID = 0;
     for (const auto& seeds : seeds_) {
-        util::forEachParallel(*seeds, [&](const auto& p, size_t i) {
-            IntegralLine line = tracer.traceFrom(p);
-            auto size = line.getPositions().size();
-            if (size > 1) {
-                std::lock_guard<std::mutex> lock(mutex);
-                lines->push_back(std::move(line), startID + i);
-            }
-        });
-        startID += seeds->size();
+        const auto seedCount = seeds->size();
+        const auto firstArena = arenas.size();
+        arenas.resize(firstArena + jobs);
+        util::forEachParallel(
+            jobIndices,
+            [&](size_t job) {
+                auto& dst = arenas[firstArena + job];
+                const auto end = (seedCount * (job + 1)) / jobs;
+                for (auto i = (seedCount * job) / jobs; i < end; ++i) {
+                    tracer.traceInto(dst, (*seeds)[i], static_cast<uint32_t>(startID + i));
+                    const auto [first, last] = dst.getRange(dst.size() - 1);
+                    if (last - first <= 1) {
+                        dst.popLine();
+                    }
+                }
+            },
+            jobs);
+
+        startID += seedCount;
     }
+    lines->append(arenas);
 
     if (calculateCurvature_) {
         util::curvature(*lines);
@@ -48,7 +48,7 @@ namespace inviwo {
 
 class IVW_MODULE_VECTORFIELDVISUALIZATION_API IntegralLineProperties : public CompositeProperty {
 public:
-    enum class IntegrationScheme { Euler, RK4 };
+    enum class IntegrationScheme { Euler, RK4, RK45 };
 
     enum class Direction { Forward = 1, Backward = 2, Bidirectional = 3 };
 
@@ -62,8 +62,29 @@ public:
     }
 
     int getNumberOfSteps() const;
+    /**
+     * The step size of the Euler and RK4 schemes, and the initial step size of the adaptive RK45
+     * scheme, in model space.
+     */
     float getStepSize() const;
 
+    ///@{
+    /**
+     * Settings of the adaptive Dormand-Prince RK45 scheme. Steps are repeated with a smaller step
+     * size while the estimated error of a step exceeds the tolerance, unless the step size has
+     * reached the minimum step size.
+     */
+    float getErrorTolerance() const;
+    float getMinStepSize() const;
+    float getMaxStepSize() const;
+    ///@}
+
+    /**
+     * Maximum length of a line in model space, a length of zero means no limit. The length is
+     * split evenly between the two directions of bidirectional lines.
+     */
+    float getMaxLength() const;
+
     IntegralLineProperties::Direction getStepDirection() const;
     IntegralLineProperties::IntegrationScheme getIntegrationScheme() const;
     CoordinateSpace getSeedPointsSpace() const;
@@ -75,6 +96,10 @@ private:
 public:
     IntProperty numberOfSteps_;
     FloatProperty stepSize_;
+    FloatProperty errorTolerance_;
+    FloatProperty minStepSize_;
+    FloatProperty maxStepSize_;
+    FloatProperty maxLength_;
     BoolProperty normalizeSamples_;
 
     OptionProperty<IntegralLineProperties::Direction> stepDirection_;
@@ -148,11 +148,11 @@ void IntegralLine::setForwardTerminationReason(TerminationReason terminationReas
 }
 
 IntegralLine::TerminationReason IntegralLine::getBackwardTerminationReason() const {
-    return forwardTerminationReason_;
+    return backwardTerminationReason_;
 }
 
 IntegralLine::TerminationReason IntegralLine::getForwardTerminationReason() const {
-    return backwardTerminationReason_;
+    return forwardTerminationReason_;
 }
 
 double IntegralLine::calcLength(std::vector<dvec3>::const_iterator start,
@@ -183,6 +183,9 @@ std::ostream& operator<<(std::ostream& os, IntegralLine::TerminationReason reaso
         case IntegralLine::TerminationReason::Steps:
             os << "Steps";
             break;
+        case IntegralLine::TerminationReason::Length:
+            os << "Length";
+            break;
         default:
         case IntegralLine::TerminationReason::Unknown:
             os << "Unknown";
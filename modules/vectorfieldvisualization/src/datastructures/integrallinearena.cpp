@@ -0,0 +1,134 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#include <modules/vectorfieldvisualization/datastructures/integrallinearena.h>
+
+#include <inviwo/core/datastructures/buffer/bufferram.h>  // for BufferRAM
+#include <inviwo/core/util/exception.h>                   // for Exception
+#include <inviwo/core/util/sourcecontext.h>               // for IVW_CONTEXT
+
+#include <algorithm>    // for equal
+#include <type_traits>  // for remove_pointer_t
+
+namespace inviwo {
+
+size_t IntegralLineArena::size() const { return info_.size(); }
+
+std::vector<dvec3>& IntegralLineArena::getPositions() { return positions_; }
+const std::vector<dvec3>& IntegralLineArena::getPositions() const { return positions_; }
+
+const std::map<std::string, std::shared_ptr<BufferBase>>& IntegralLineArena::getMetaDataBuffers()
+    const {
+    return metaData_;
+}
+
+std::pair<size_t, size_t> IntegralLineArena::getRange(size_t line) const {
+    return {offsets_[line], offsets_[line + 1]};
+}
+
+auto IntegralLineArena::getInfo(size_t line) const -> const LineInfo& { return info_[line]; }
+
+size_t IntegralLineArena::getLineBegin() const { return offsets_.back(); }
+
+void IntegralLineArena::finishLine(const LineInfo& info) {
+    for (const auto& [name, buffer] : metaData_) {
+        if (buffer->getSize() != positions_.size()) {
+            throw Exception(IVW_CONTEXT, "Meta data {} has {} points but the line has {}", name,
+                            buffer->getSize(), positions_.size());
+        }
+    }
+    offsets_.push_back(positions_.size());
+    info_.push_back(info);
+}
+
+void IntegralLineArena::popLine() {
+    if (!info_.empty()) {
+        offsets_.pop_back();
+        info_.pop_back();
+    }
+    const auto end = offsets_.back();
+    positions_.resize(end);
+    for (auto& item : metaData_) {
+        item.second->getEditableRepresentation<BufferRAM>()->setSize(end);
+    }
+}
+
+void IntegralLineArena::append(IntegralLineArena&& other) {
+    if (info_.empty() && positions_.empty()) {
+        *this = std::move(other);
+        return;
+    }
+    if (other.info_.empty()) return;
+
+    if (!std::equal(metaData_.begin(), metaData_.end(), other.metaData_.begin(),
+                    other.metaData_.end(), [](const auto& a, const auto& b) {
+                        return a.first == b.first &&
+                               a.second->getDataFormat() == b.second->getDataFormat();
+                    })) {
+        throw Exception(IVW_CONTEXT, "Can not append integral lines with other meta data");
+    }
+
+    const auto end = other.offsets_.back();
+    const auto offset = positions_.size();
+    positions_.insert(positions_.end(), other.positions_.begin(), other.positions_.begin() + end);
+    for (auto& [name, buffer] : metaData_) {
+        const auto* src = other.metaData_[name]->getRepresentation<BufferRAM>();
+        buffer->getEditableRepresentation<BufferRAM>()->dispatch<void>([&](auto dst) {
+            using T = typename std::remove_pointer_t<decltype(dst)>::type;
+            const auto& data = static_cast<const BufferRAMPrecision<T>*>(src)->getDataContainer();
+            auto& container = dst->getDataContainer();
+            container.insert(container.end(), data.begin(), data.begin() + end);
+        });
+    }
+    for (size_t i = 1; i < other.offsets_.size(); ++i) {
+        offsets_.push_back(offset + other.offsets_[i]);
+    }
+    info_.insert(info_.end(), other.info_.begin(), other.info_.end());
+    other = IntegralLineArena{};
+}
+
+IntegralLine IntegralLineArena::getLine(size_t line) const {
+    const auto [begin, end] = getRange(line);
+    const auto& info = info_[line];
+
+    IntegralLine res;
+    res.getPositions().assign(positions_.begin() + begin, positions_.begin() + end);
+    for (const auto& [name, buffer] : metaData_) {
+        buffer->getRepresentation<BufferRAM>()->dispatch<void>([&](auto src) {
+            using T = typename std::remove_pointer_t<decltype(src)>::type;
+            const auto& data = src->getDataContainer();
+            res.getMetaData<T>(name, true).assign(data.begin() + begin, data.begin() + end);
+        });
+    }
+    res.setIndex(info.index);
+    res.setBackwardTerminationReason(info.backward);
+    res.setForwardTerminationReason(info.forward);
+    return res;
+}
+
+}  // namespace inviwo
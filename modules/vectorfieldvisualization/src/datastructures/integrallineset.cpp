@@ -31,8 +31,12 @@
 
 #include <inviwo/core/util/glmmat.h>                                       // for mat4
 #include <modules/vectorfieldvisualization/datastructures/integralline.h>  // for IntegralLine
+#include <modules/vectorfieldvisualization/datastructures/integrallinearena.h>  // for Integra...
+
+#include <inviwo/core/util/foreach.h>                                      // for forEachPar...
 
 #include <cstdint>  // for uint32_t
+#include <numeric>  // for iota
 #include <utility>  // for move
 
 namespace inviwo {
@@ -81,12 +85,39 @@ void IntegralLineSet::push_back(IntegralLine&& line, SetIndex updateIndex) {
     if (updateIndex == SetIndex::Yes) {
         line.setIndex(static_cast<uint32_t>(lines_.size()));
     }
-    lines_.push_back(line);
+    lines_.push_back(std::move(line));
 }
 
 void IntegralLineSet::push_back(IntegralLine&& line, size_t idx) {
     line.setIndex(static_cast<uint32_t>(idx));
-    lines_.push_back(line);
+    lines_.push_back(std::move(line));
+}
+
+void IntegralLineSet::append(const IntegralLineArena& arena) {
+    append(std::span<const IntegralLineArena>{&arena, 1});
+}
+
+void IntegralLineSet::append(std::span<const IntegralLineArena> arenas) {
+    std::vector<size_t> offsets;
+    offsets.reserve(arenas.size());
+    auto size = lines_.size();
+    for (const auto& arena : arenas) {
+        offsets.push_back(size);
+        size += arena.size();
+    }
+    lines_.resize(size);
+
+    std::vector<size_t> indices(arenas.size());
+    std::iota(indices.begin(), indices.end(), size_t{0});
+    util::forEachParallel(
+        indices,
+        [&](size_t i) {
+            const auto& arena = arenas[i];
+            for (size_t line = 0; line < arena.size(); ++line) {
+                lines_[offsets[i] + line] = arena.getLine(line);
+            }
+        },
+        arenas.size());
 }
 
 }  // namespace inviwo
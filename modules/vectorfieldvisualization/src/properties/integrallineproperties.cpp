@@ -43,6 +43,10 @@ IntegralLineProperties::IntegralLineProperties(std::string_view identifier,
     : CompositeProperty(identifier, displayName)
     , numberOfSteps_("steps", "Number of Steps", util::ordinalCount(100, 1000))
     , stepSize_("stepSize", "Step size", util::ordinalScale(0.001f, 1.0f))
+    , errorTolerance_("errorTolerance", "Error Tolerance", util::ordinalScale(0.0001f, 0.01f))
+    , minStepSize_("minStepSize", "Min Step Size", util::ordinalScale(0.0001f, 1.0f))
+    , maxStepSize_("maxStepSize", "Max Step Size", util::ordinalScale(0.05f, 1.0f))
+    , maxLength_("maxLength", "Max Length", util::ordinalLength(0.0f, 10.0f))
     , normalizeSamples_("normalizeSamples", "Normalize Samples", true)
     , stepDirection_("stepDirection", "Step Direction")
     , integrationScheme_("integrationScheme", "Integration Scheme")
@@ -54,6 +58,10 @@ IntegralLineProperties::IntegralLineProperties(const IntegralLineProperties& rhs
     : CompositeProperty(rhs)
     , numberOfSteps_(rhs.numberOfSteps_)
     , stepSize_(rhs.stepSize_)
+    , errorTolerance_(rhs.errorTolerance_)
+    , minStepSize_(rhs.minStepSize_)
+    , maxStepSize_(rhs.maxStepSize_)
+    , maxLength_(rhs.maxLength_)
     , normalizeSamples_(rhs.normalizeSamples_)
     , stepDirection_(rhs.stepDirection_)
     , integrationScheme_(rhs.integrationScheme_)
@@ -71,6 +79,14 @@ int IntegralLineProperties::getNumberOfSteps() const { return numberOfSteps_.get
 
 float IntegralLineProperties::getStepSize() const { return stepSize_.get(); }
 
+float IntegralLineProperties::getErrorTolerance() const { return errorTolerance_.get(); }
+
+float IntegralLineProperties::getMinStepSize() const { return minStepSize_.get(); }
+
+float IntegralLineProperties::getMaxStepSize() const { return maxStepSize_.get(); }
+
+float IntegralLineProperties::getMaxLength() const { return maxLength_.get(); }
+
 IntegralLineProperties::Direction IntegralLineProperties::getStepDirection() const {
     return stepDirection_.get();
 }
@@ -95,8 +111,17 @@ void IntegralLineProperties::setUpProperties() {
                                  IntegralLineProperties::IntegrationScheme::Euler);
     integrationScheme_.addOption("rk4", "Runge-Kutta (RK4)",
                                  IntegralLineProperties::IntegrationScheme::RK4);
+    integrationScheme_.addOption("rk45", "Adaptive Dormand-Prince (RK45)",
+                                 IntegralLineProperties::IntegrationScheme::RK45);
     integrationScheme_.setSelectedValue(IntegralLineProperties::IntegrationScheme::RK4);
 
+    const auto isAdaptive = [](const auto& p) {
+        return p.get() == IntegralLineProperties::IntegrationScheme::RK45;
+    };
+    errorTolerance_.visibilityDependsOn(integrationScheme_, isAdaptive);
+    minStepSize_.visibilityDependsOn(integrationScheme_, isAdaptive);
+    maxStepSize_.visibilityDependsOn(integrationScheme_, isAdaptive);
+
     seedPointsSpace_.addOption("data", "Data", CoordinateSpace::Data);
     seedPointsSpace_.addOption("model", "Model", CoordinateSpace::Model);
     seedPointsSpace_.addOption("world", "World", CoordinateSpace::World);
@@ -105,6 +130,10 @@ void IntegralLineProperties::setUpProperties() {
     addProperty(stepSize_);
     addProperty(stepDirection_);
     addProperty(integrationScheme_);
+    addProperty(errorTolerance_);
+    addProperty(minStepSize_);
+    addProperty(maxStepSize_);
+    addProperty(maxLength_);
     addProperty(seedPointsSpace_);
     addProperty(normalizeSamples_);
 
@@ -0,0 +1,260 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/util/spatialsampler.h>
+#include <modules/vectorfieldvisualization/datastructures/integrallinearena.h>
+#include <modules/vectorfieldvisualization/datastructures/integrallineset.h>
+#include <modules/vectorfieldvisualization/integrallinetracer.h>
+#include <modules/vectorfieldvisualization/properties/integrallineproperties.h>
+
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+/**
+ * Analytic field rotating around the z axis and diverging along it, defined in the box
+ * [-1, 1]^3. The field is zero at the origin.
+ */
+class RotationSampler : public SpatialSampler<dvec3> {
+public:
+    RotationSampler(const SpatialEntity& entity, double divergence = 0.5)
+        : SpatialSampler<dvec3>(entity), divergence_{divergence} {}
+
+protected:
+    virtual dvec3 sampleDataSpace(const dvec3& pos) const override {
+        return dvec3{-pos.y, pos.x, divergence_ * pos.z};
+    }
+    virtual bool withinBoundsDataSpace(const dvec3& pos) const override {
+        return glm::all(glm::lessThanEqual(glm::abs(pos), dvec3{1.0}));
+    }
+
+private:
+    double divergence_;
+};
+
+/**
+ * Meta data sampler returning the position
+ */
+class PositionSampler : public SpatialSampler<dvec3> {
+public:
+    using SpatialSampler<dvec3>::SpatialSampler;
+
+protected:
+    virtual dvec3 sampleDataSpace(const dvec3& pos) const override { return pos; }
+    virtual bool withinBoundsDataSpace(const dvec3&) const override { return true; }
+};
+
+std::vector<dvec3> gridSeeds() {
+    std::vector<dvec3> seeds;
+    // includes the origin, where the velocity is zero, and seeds outside of the field
+    for (int z = -2; z <= 2; ++z) {
+        for (int y = -6; y <= 6; ++y) {
+            for (int x = -6; x <= 6; ++x) {
+                seeds.emplace_back(x / 5.0, y / 5.0, z / 2.5);
+            }
+        }
+    }
+    return seeds;
+}
+
+}  // namespace
+
+TEST(IntegralLineTracer, ArenaMatchesSerial) {
+    Mesh entity;
+    auto sampler = std::make_shared<RotationSampler>(entity);
+    IntegralLineProperties properties("properties", "Properties");
+    properties.numberOfSteps_.set(200);
+    properties.stepSize_.set(0.01f);
+    properties.stepDirection_.setSelectedValue(IntegralLineProperties::Direction::Bidirectional);
+
+    StreamLine3DTracer tracer(sampler, properties);
+    tracer.addMetaDataSampler("position", std::make_shared<PositionSampler>(entity));
+
+    const auto seeds = gridSeeds();
+
+    std::vector<IntegralLine> serial;
+    for (size_t i = 0; i < seeds.size(); ++i) {
+        auto res = tracer.traceFrom(seeds[i]);
+        if (res.line.getPositions().size() > 1) {
+            res.line.setIndex(static_cast<uint32_t>(i));
+            serial.push_back(std::move(res.line));
+        }
+    }
+    ASSERT_LT(serial.size(), seeds.size());
+
+    // trace contiguous ranges of seeds concurrently, like the IntegralLineTracerProcessor
+    const size_t jobs = 5;
+    std::vector<IntegralLineArena> arenas(jobs);
+    {
+        std::vector<std::thread> threads;
+        for (size_t job = 0; job < jobs; ++job) {
+            threads.emplace_back([&, job]() {
+                auto& dst = arenas[job];
+                const auto end = (seeds.size() * (job + 1)) / jobs;
+                for (auto i = (seeds.size() * job) / jobs; i < end; ++i) {
+                    tracer.traceInto(dst, seeds[i], static_cast<uint32_t>(i));
+                    const auto [first, last] = dst.getRange(dst.size() - 1);
+                    if (last - first <= 1) {
+                        dst.popLine();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    IntegralLineSet lines(mat4(1.0f));
+    lines.append(arenas);
+
+    ASSERT_EQ(serial.size(), lines.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+        const auto& expected = serial[i];
+        const auto& line = lines[i];
+        EXPECT_EQ(expected.getIndex(), line.getIndex()) << "line " << i;
+        EXPECT_EQ(expected.getBackwardTerminationReason(), line.getBackwardTerminationReason())
+            << "line " << i;
+        EXPECT_EQ(expected.getForwardTerminationReason(), line.getForwardTerminationReason())
+            << "line " << i;
+        EXPECT_EQ(expected.getPositions(), line.getPositions()) << "line " << i;
+        EXPECT_EQ(expected.getMetaDataKeys(), line.getMetaDataKeys()) << "line " << i;
+        for (const auto& key : {"velocity", "position"}) {
+            EXPECT_EQ(expected.getMetaData<dvec3>(key), line.getMetaData<dvec3>(key))
+                << "line " << i << " " << key;
+        }
+    }
+}
+
+TEST(IntegralLineTracer, RK45ClosedCircle) {
+    Mesh entity;
+    // without divergence the stream lines are circles around the z axis
+    auto sampler = std::make_shared<RotationSampler>(entity, 0.0);
+    IntegralLineProperties properties("properties", "Properties");
+    properties.integrationScheme_.setSelectedValue(
+        IntegralLineProperties::IntegrationScheme::RK45);
+    properties.stepDirection_.setSelectedValue(IntegralLineProperties::Direction::Forward);
+    properties.numberOfSteps_.set(500);
+    properties.stepSize_.set(0.01f);
+    properties.errorTolerance_.set(0.0001f);
+    properties.minStepSize_.set(0.0001f);
+    properties.maxStepSize_.set(0.05f);
+    properties.maxLength_.set(0.0f);
+
+    StreamLine3DTracer tracer(sampler, properties);
+
+    const double radius = 0.5;
+    const auto res = tracer.traceFrom(dvec3{radius, 0.0, 0.0});
+    const auto& positions = res.line.getPositions();
+    EXPECT_EQ(size_t{0}, res.seedIndex);
+    EXPECT_EQ(IntegralLine::TerminationReason::Steps, res.line.getForwardTerminationReason());
+    ASSERT_EQ(size_t{501}, positions.size());
+
+    // the points stay on the circle, and the line turns counterclockwise around the z axis
+    double angle = 0.0;
+    for (size_t i = 1; i < positions.size(); ++i) {
+        const auto& p = positions[i];
+        EXPECT_NEAR(radius, glm::length(dvec2{p}), 1e-3) << "point " << i;
+        EXPECT_DOUBLE_EQ(0.0, p.z) << "point " << i;
+
+        const auto prev = dvec2{positions[i - 1]};
+        const auto turn = std::atan2(prev.x * p.y - prev.y * p.x, glm::dot(prev, dvec2{p}));
+        EXPECT_GT(turn, 0.0) << "point " << i;
+        angle += turn;
+    }
+    // the line closes the circle, and the arc length matches the angle up to the difference
+    // between the chords and the arcs of the steps
+    EXPECT_GT(angle, 2.0 * std::numbers::pi);
+    EXPECT_NEAR(angle * radius, res.line.getLength(), 1e-3 * res.line.getLength());
+
+    // the adaptive scheme grows the step beyond the initial step size on the smooth field
+    EXPECT_GT(res.line.getLength(), 500 * 0.01);
+}
+
+TEST(IntegralLineTracer, MaxLength) {
+    Mesh entity;
+    auto sampler = std::make_shared<RotationSampler>(entity, 0.0);
+
+    for (auto scheme : {IntegralLineProperties::IntegrationScheme::Euler,
+                        IntegralLineProperties::IntegrationScheme::RK4,
+                        IntegralLineProperties::IntegrationScheme::RK45}) {
+        IntegralLineProperties properties("properties", "Properties");
+        properties.integrationScheme_.setSelectedValue(scheme);
+        properties.numberOfSteps_.set(1000);
+        properties.stepSize_.set(0.01f);
+        properties.minStepSize_.set(0.001f);
+        properties.maxStepSize_.set(0.01f);
+        properties.maxLength_.set(1.0f);
+        const double step = 0.01 + 1e-6;
+
+        properties.stepDirection_.setSelectedValue(IntegralLineProperties::Direction::Forward);
+        {
+            StreamLine3DTracer tracer(sampler, properties);
+            const auto res = tracer.traceFrom(dvec3{0.5, 0.0, 0.0});
+            EXPECT_EQ(IntegralLine::TerminationReason::Length,
+                      res.line.getForwardTerminationReason());
+            EXPECT_GE(res.line.getLength(), 1.0);
+            EXPECT_LT(res.line.getLength(), 1.0 + step);
+        }
+
+        // the length is split evenly between the directions of bidirectional lines
+        properties.stepDirection_.setSelectedValue(
+            IntegralLineProperties::Direction::Bidirectional);
+        {
+            StreamLine3DTracer tracer(sampler, properties);
+            const auto res = tracer.traceFrom(dvec3{0.5, 0.0, 0.0});
+            const auto& line = res.line;
+            EXPECT_EQ(IntegralLine::TerminationReason::Length,
+                      line.getBackwardTerminationReason());
+            EXPECT_EQ(IntegralLine::TerminationReason::Length,
+                      line.getForwardTerminationReason());
+
+            const auto backward = line.distBetweenPoints(0, res.seedIndex);
+            const auto forward =
+                line.distBetweenPoints(res.seedIndex, line.getPositions().size() - 1);
+            EXPECT_GE(backward, 0.5);
+            EXPECT_LT(backward, 0.5 + step);
+            EXPECT_GE(forward, 0.5);
+            EXPECT_LT(forward, 0.5 + step);
+        }
+    }
+}
+
+}  // namespace inviwo
@@ -5,3 +5,4 @@ set(dependencies
     InviwoDataFrameModule
 )
 set(EnableByDefault ON)
+set(threadSafe ON)
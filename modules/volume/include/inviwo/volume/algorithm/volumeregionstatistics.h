@@ -0,0 +1,67 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+#pragma once
+
+#include <inviwo/volume/volumemoduledefine.h>  // for IVW_MODULE_VOLUME_API
+
+#include <inviwo/core/datastructures/coordinatetransformer.h>  // for CoordinateSpace
+
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr
+
+namespace inviwo {
+
+class Volume;
+class DataFrame;
+
+namespace util {
+
+/**
+ * Calculate statistics for each region of @p atlas, see the VolumeRegionStatistics processor for
+ * the list of columns. The volume is split into z slabs which are processed in parallel on the
+ * thread pool, and the partial statistics are merged in slab order.
+ * @param volume  the values, of any format
+ * @param atlas   unsigned integer scalar volume, with the same dimensions as @p volume, assigning a
+ *                region index to each voxel. The indices are assumed to be in the range
+ *                [atlas.dataMap.dataRange.x, atlas.dataMap.dataRange.y] without gaps.
+ * @param space   the coordinate space of the positions in the result
+ * @param boundingBoxes  add 'Bounds Min' and 'Bounds Max' columns for each region
+ * @param jobs    the maximum number of slabs, 0 uses the size of the thread pool
+ * @throw Exception if the dimensions or the atlas format do not match, or if an index is out of
+ *                  range or a region is empty
+ */
+IVW_MODULE_VOLUME_API std::shared_ptr<DataFrame> volumeRegionStatistics(const Volume& volume,
+                                                                        const Volume& atlas,
+                                                                        CoordinateSpace space,
+                                                                        bool boundingBoxes,
+                                                                        size_t jobs = 0);
+
+}  // namespace util
+
+}  // namespace inviwo
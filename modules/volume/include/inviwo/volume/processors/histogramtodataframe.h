@@ -125,7 +125,11 @@ void HistogramToDataFrame<T>::process() {
     histogramResult_ =
         inport_.getData()->calculateHistograms([this](const std::vector<Histogram1D>& histograms) {
             dataframe_ = detail::createDataFrame(histograms, histogramMode_);
-            getProgressBar().finishProgress();
+            if (!histograms.empty() && histograms.front().coverage < 1.0) {
+                updateProgress(static_cast<float>(histograms.front().coverage));
+            } else {
+                getProgressBar().finishProgress();
+            }
             outport_.setData(dataframe_);
             outport_.invalidate(InvalidationLevel::Valid);
         });
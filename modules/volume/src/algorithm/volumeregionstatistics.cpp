@@ -0,0 +1,586 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/volume/algorithm/volumeregionstatistics.h>
+#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/volumeramutils.h>
+#include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/glm.h>
+#include <inviwo/core/util/zip.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/datastructures/unitsystem.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+
+#include <numeric>
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <span>
+#include <numbers>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+namespace inviwo {
+
+namespace {
+
+auto addColumns(DataFrame& df, std::string_view name, size_t size, Unit unit,
+                std::optional<dvec2> range) {
+    auto* data = &df.addColumn<double>(name, size, unit, range)
+                      ->getTypedBuffer()
+                      ->getEditableRAMRepresentation()
+                      ->getDataContainer();
+    return data;
+}
+
+auto addColumns(DataFrame& df, size_t extent, std::string_view name, size_t size,
+                std::span<const Unit> units, std::span<const std::optional<dvec2>> ranges,
+                std::span<const std::string_view> labels) {
+    IVW_ASSERT(units.size() >= extent, "Size missmatch");
+    IVW_ASSERT(ranges.size() >= extent, "Size missmatch");
+    IVW_ASSERT(labels.size() >= extent, "Size missmatch");
+
+    return util::table(
+        [&](auto index) {
+            const auto fullName = fmt::format("{} {}", name, labels[index]);
+            auto* data = &df.addColumn<double>(fullName, size, units[index], ranges[index])
+                              ->getTypedBuffer()
+                              ->getEditableRAMRepresentation()
+                              ->getDataContainer();
+            return data;
+        },
+        0, static_cast<int>(extent));
+}
+
+auto addColumns(DataFrame& df, size_t extent, size_t comps, std::string_view name, size_t size,
+                std::span<const Unit> units, std::span<const std::optional<dvec2>> ranges,
+                std::span<const std::string_view> majorLabels,
+                std::span<const std::string_view> minorLabels) {
+
+    IVW_ASSERT(units.size() >= comps, "Size missmatch");
+    IVW_ASSERT(ranges.size() >= comps, "Size missmatch");
+    IVW_ASSERT(majorLabels.size() >= extent, "Size missmatch");
+    IVW_ASSERT(minorLabels.size() >= comps, "Size missmatch");
+
+    return util::table(
+        [&](auto index) {
+            return util::table(
+                [&](auto comp) {
+                    const auto fullName =
+                        fmt::format("{} {} {}", name, majorLabels[index], minorLabels[comp]);
+                    auto* data = &df.addColumn<double>(fullName, size, units[comp], ranges[comp])
+                                      ->getTypedBuffer()
+                                      ->getEditableRAMRepresentation()
+                                      ->getDataContainer();
+                    return data;
+                },
+                0, static_cast<int>(comps));
+        },
+        0, static_cast<int>(extent));
+}
+
+/**
+ * Accumulators to calculate "center of mass" for periodic and non periodic systems
+ * See https://en.wikipedia.org/wiki/Center_of_mass (Systems with periodic boundary conditions)
+ */
+template <Wrapping wrapX, Wrapping wrapY, Wrapping wrapZ>
+class Accumulator {
+public:
+    Accumulator(dvec3 dim) : dim{dim} {}
+
+    void add(const dvec3& pos, double weight) {
+        addComp<0, wrapX>(pos[0], weight);
+        addComp<1, wrapY>(pos[1], weight);
+        addComp<2, wrapZ>(pos[2], weight);
+    }
+    dvec3 get(double totalWeight) const {
+        return dvec3(getComp<0, wrapX>(totalWeight), getComp<1, wrapY>(totalWeight),
+                     getComp<2, wrapZ>(totalWeight));
+    }
+    void merge(const Accumulator& other) {
+        mergeComp<0, wrapX>(other);
+        mergeComp<1, wrapY>(other);
+        mergeComp<2, wrapZ>(other);
+    }
+
+private:
+    template <size_t N, Wrapping wrap>
+    void addComp(double pos, double weight) {
+        auto& acc = std::get<N>(vec);
+        if constexpr (wrap == Wrapping::Repeat) {
+            const auto theta = pos / dim[N] * 2.0 * std::numbers::pi;
+            acc.first += weight * std::cos(theta);
+            acc.second += weight * std::sin(theta);
+        } else {
+            acc += weight * pos;
+        }
+    }
+
+    template <size_t N, Wrapping wrap>
+    void mergeComp(const Accumulator& other) {
+        auto& acc = std::get<N>(vec);
+        const auto& otherAcc = std::get<N>(other.vec);
+        if constexpr (wrap == Wrapping::Repeat) {
+            acc.first += otherAcc.first;
+            acc.second += otherAcc.second;
+        } else {
+            acc += otherAcc;
+        }
+    }
+
+    template <size_t N, Wrapping wrap>
+    double getComp(double totalWeight) const {
+        auto& acc = std::get<N>(vec);
+        if constexpr (wrap == Wrapping::Repeat) {
+            const auto theta = std::atan2(-acc.second, -acc.first) + std::numbers::pi;
+            return dim[N] * theta / (2.0 * std::numbers::pi);
+        } else {
+            return acc / totalWeight;
+        }
+    }
+    template <Wrapping wrapping>
+    using Acc = std::conditional_t<wrapping == Wrapping::Repeat, std::pair<double, double>, double>;
+    std::tuple<Acc<wrapX>, Acc<wrapY>, Acc<wrapZ>> vec{};
+
+    dvec3 dim{1.0};
+};
+
+/**
+ * Statistics of the voxels of one region, independent of the channels.
+ */
+template <Wrapping wrapX, Wrapping wrapY, Wrapping wrapZ>
+class RegionStats {
+public:
+    RegionStats(dvec3 dim) : center{dim} {}
+    void add(const dvec3& r, const size3_t& index) {
+        ++volume;
+        center.add(r, 1.0);
+        boundsMin = glm::min(boundsMin, index);
+        boundsMax = glm::max(boundsMax, index);
+    }
+    void merge(const RegionStats& other) {
+        volume += other.volume;
+        center.merge(other.center);
+        boundsMin = glm::min(boundsMin, other.boundsMin);
+        boundsMax = glm::max(boundsMax, other.boundsMax);
+    }
+
+    double getVolume() const { return volume; }
+    dvec3 getCenter() const { return center.get(volume); }
+    size3_t getBoundsMin() const { return boundsMin; }
+    size3_t getBoundsMax() const { return boundsMax; }
+
+private:
+    double volume{};
+    Accumulator<wrapX, wrapY, wrapZ> center;
+    size3_t boundsMin{std::numeric_limits<size_t>::max()};
+    size3_t boundsMax{std::numeric_limits<size_t>::lowest()};
+};
+
+/**
+ * Statistics of the values of one channel in one region. The mean and variance are updated using
+ * Welford's algorithm, and partial statistics are combined using the pairwise update by Chan et al.
+ * See https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+ */
+template <Wrapping wrapX, Wrapping wrapY, Wrapping wrapZ>
+class ChannelStats {
+public:
+    ChannelStats(dvec3 dim) : centerOfMass{dim} {}
+    void add(const dvec3& r, double val) {
+        ++count;
+        const auto delta = val - mean;
+        mean += delta / count;
+        m2 += delta * (val - mean);
+
+        centerOfMass.add(r, val);
+        mass += val;
+        min = std::min(min, val);
+        max = std::max(max, val);
+    }
+    void merge(const ChannelStats& other) {
+        if (other.count == 0.0) return;
+        const auto total = count + other.count;
+        const auto delta = other.mean - mean;
+        mean += delta * other.count / total;
+        m2 += other.m2 + delta * delta * count * other.count / total;
+        count = total;
+
+        centerOfMass.merge(other.centerOfMass);
+        mass += other.mass;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+    }
+
+    double getMass() const { return mass; }
+    double getMean() const { return mean; }
+    double getStandardDeviation() const { return count > 0.0 ? std::sqrt(m2 / count) : 0.0; }
+    double getMin() const { return min; }
+    double getMax() const { return max; }
+    dvec3 getCenterOfMass() const { return centerOfMass.get(mass); }
+
+private:
+    double count{};
+    double mean{};
+    double m2{};
+    double mass{};
+    double min{std::numeric_limits<double>::max()};
+    double max{std::numeric_limits<double>::lowest()};
+    Accumulator<wrapX, wrapY, wrapZ> centerOfMass;
+};
+
+template <typename Index, typename Functor, Index... Is>
+constexpr auto build_array_impl(Functor&& func, std::integer_sequence<Index, Is...>) noexcept {
+    return std::array{func(std::integral_constant<Index, Is>{})...};
+}
+
+template <std::size_t N, typename Index = std::size_t, typename Functor>
+constexpr auto build_array(Functor&& func) noexcept {
+    return build_array_impl<Index>(std::forward<Functor>(func),
+                                   std::make_integer_sequence<Index, N>());
+}
+
+template <typename Ret = void, typename Functor, typename... Args>
+constexpr auto wrappingDispatch(Functor&& func, const Wrapping3D& wrapping, Args&&... args) {
+    using DispatchFunctor = Ret (*)(Functor&& func, Args&&...);
+
+    constexpr auto table = build_array<3>([](auto x) constexpr {
+        using XT = decltype(x);
+        return build_array<3>([](auto y) constexpr {
+            using YT = decltype(y);
+            return build_array<3>([](auto z) constexpr -> DispatchFunctor {
+                using ZT = decltype(z);
+                return [](Functor&& func, Args&&... args) {
+                    constexpr auto X = static_cast<Wrapping>(XT::value);
+                    constexpr auto Y = static_cast<Wrapping>(YT::value);
+                    constexpr auto Z = static_cast<Wrapping>(ZT::value);
+                    return std::forward<Functor>(func).template operator()<X, Y, Z>(
+                        std::forward<Args>(args)...);
+                };
+            });
+        });
+    });
+
+    return table[static_cast<std::size_t>(wrapping[0])][static_cast<std::size_t>(wrapping[1])]
+                [static_cast<std::size_t>(wrapping[2])](std::forward<Functor>(func),
+                                                        std::forward<Args>(args)...);
+}
+
+double voxelVolume(const dmat4& transform) {
+    const auto a = dvec3{transform * dvec4{dvec3(1.0, 0.0, 0.0), 0.0}};
+    const auto b = dvec3{transform * dvec4{dvec3(0.0, 1.0, 0.0), 0.0}};
+    const auto c = dvec3{transform * dvec4{dvec3(0.0, 0.0, 1.0), 0.0}};
+    return glm::abs(glm::dot(a, glm::cross(b, c)));
+}
+
+struct StatsFunctor {
+    const size_t nRegions;
+    const size_t minRegionId;
+    const size_t channels;
+    std::shared_ptr<DataFrame> df;
+
+    const VolumeRAM* volumeRep;
+    const VolumeRAM* atlasRep;
+    const DataMapper map;
+
+    const size3_t dims;
+    const dvec3 dim;
+    const mat4 data2dest;
+    const mat4 index2dest;
+    const mat4 index2data;
+    const double volumeScale;
+    const size_t maxJobs;
+
+    std::vector<double>* regionVolumes;
+    std::vector<std::vector<double>*> regionSums;
+    std::vector<std::vector<double>*> regionMean;
+    std::vector<std::vector<double>*> regionStdDev;
+    std::vector<std::vector<double>*> regionMin;
+    std::vector<std::vector<double>*> regionMax;
+    std::vector<std::vector<double>*> regionCenter;
+    std::vector<std::vector<std::vector<double>*>> regionCoM;
+    std::vector<std::vector<double>*> regionBoundsMin;
+    std::vector<std::vector<double>*> regionBoundsMax;
+
+    StatsFunctor(const Volume& volume, const Volume& atlas, CoordinateSpace destSpace,
+                 bool boundingBoxes, size_t jobs)
+        : nRegions{static_cast<size_t>(atlas.dataMap.dataRange.y - atlas.dataMap.dataRange.x + 1)}
+        , minRegionId{static_cast<size_t>(atlas.dataMap.dataRange.x)}
+        , channels{volume.getDataFormat()->getComponents()}
+        , df{std::make_shared<DataFrame>(static_cast<uint32_t>(nRegions))}
+        , volumeRep{volume.getRepresentation<VolumeRAM>()}
+        , atlasRep{atlas.getRepresentation<VolumeRAM>()}
+        , map{volume.dataMap}
+        , dims{volume.getDimensions()}
+        , dim{static_cast<dvec3>(dims)}
+        , data2dest{volume.getCoordinateTransformer().getMatrix(CoordinateSpace::Data, destSpace)}
+        , index2dest{volume.getCoordinateTransformer().getMatrix(CoordinateSpace::Index, destSpace)}
+        , index2data{volume.getCoordinateTransformer().getMatrix(CoordinateSpace::Index,
+                                                                 CoordinateSpace::Data)}
+        , volumeScale{voxelVolume(index2dest)}
+        , maxJobs{jobs == 0 ? util::getPoolSize() : jobs} {
+
+        const auto& axes = volume.axes;
+        const std::array<std::string_view, 3> axesNames = {axes[0].name, axes[1].name,
+                                                           axes[2].name};
+        const std::array<Unit, 3> axesUnits = {axes[0].unit, axes[1].unit, axes[2].unit};
+        static constexpr std::array<const std::string_view, 4> indexLabels = {"0", "1", "2", "3"};
+        const auto channelLabels = std::span<const std::string_view>(indexLabels.data(), channels);
+
+        const auto valueUnits = util::make_array<4>([&](auto) { return map.valueAxis.unit; });
+
+        const auto defaultRanges =
+            util::make_array<4>([&](auto) -> std::optional<dvec2> { return {}; });
+
+        const auto volumeUnit = axes[0].unit * axes[1].unit * axes[2].unit;
+        const auto sumUnits =
+            util::make_array<4>([&](auto) { return volumeUnit * map.valueAxis.unit; });
+
+        const auto posMin = dvec3{data2dest * dvec4{0.0, 0.0, 0.0, 1.0}};
+        const auto posMax = dvec3{data2dest * dvec4{1.0, 1.0, 1.0, 1.0}};
+        std::array<std::optional<dvec2>, 3> sizeRange = {{dvec2{posMin[0], posMax[0]},
+                                                          dvec2{posMin[1], posMax[1]},
+                                                          dvec2{posMin[2], posMax[2]}}};
+
+        regionVolumes = addColumns(*df, "Volume", nRegions, volumeUnit, {});
+        regionSums =
+            addColumns(*df, channels, "Sum", nRegions, sumUnits, defaultRanges, channelLabels);
+        regionMean =
+            addColumns(*df, channels, "Mean", nRegions, valueUnits, defaultRanges, channelLabels);
+        regionStdDev = addColumns(*df, channels, "Std Dev", nRegions, valueUnits, defaultRanges,
+                                  channelLabels);
+        regionMin =
+            addColumns(*df, channels, "Min", nRegions, valueUnits, defaultRanges, channelLabels);
+        regionMax =
+            addColumns(*df, channels, "Max", nRegions, valueUnits, defaultRanges, channelLabels);
+        regionCenter = addColumns(*df, 3, "Center", nRegions, axesUnits, sizeRange, axesNames);
+        regionCoM = addColumns(*df, channels, 3, "CoM", nRegions, axesUnits, sizeRange,
+                               channelLabels, std::span(axesNames));
+        if (boundingBoxes) {
+            regionBoundsMin =
+                addColumns(*df, 3, "Bounds Min", nRegions, axesUnits, sizeRange, axesNames);
+            regionBoundsMax =
+                addColumns(*df, 3, "Bounds Max", nRegions, axesUnits, sizeRange, axesNames);
+        }
+    }
+
+    /**
+     * Statistics of a range of z slices of the volume. The atlas and volume data of each slice are
+     * converted once, so that the inner loop does not need to dispatch on the data formats.
+     */
+    template <Wrapping wrapX, Wrapping wrapY, Wrapping wrapZ>
+    struct Partial {
+        std::vector<RegionStats<wrapX, wrapY, wrapZ>> regions;
+        std::vector<ChannelStats<wrapX, wrapY, wrapZ>> values;
+    };
+
+    template <Wrapping wrapX, Wrapping wrapY, Wrapping wrapZ>
+    void accumulate(size_t zBegin, size_t zEnd, Partial<wrapX, wrapY, wrapZ>& partial) const {
+        const auto sliceSize = dims.x * dims.y;
+        std::vector<size_t> sliceRegions(sliceSize);
+        std::vector<double> sliceValues(sliceSize * channels);
+
+        const util::IndexMapper3D indexMapper(dims);
+        for (size_t z = zBegin; z < zEnd; ++z) {
+            const auto offset = indexMapper(size3_t{0, 0, z});
+            atlasRep->dispatch<void, dispatching::filter::UnsignedIntegerScalars>([&](auto rep) {
+                const auto* data = rep->getDataTyped() + offset;
+                for (size_t i = 0; i < sliceSize; ++i) {
+                    sliceRegions[i] = static_cast<size_t>(data[i]) - minRegionId;
+                }
+            });
+            volumeRep->dispatch<void, dispatching::filter::All>([&](auto rep) {
+                const auto* data = rep->getDataTyped() + offset;
+                for (size_t i = 0; i < sliceSize; ++i) {
+                    for (size_t c = 0; c < channels; ++c) {
+                        sliceValues[i * channels + c] =
+                            static_cast<double>(util::glmcomp(data[i], c));
+                    }
+                }
+            });
+
+            for (size_t y = 0; y < dims.y; ++y) {
+                for (size_t x = 0; x < dims.x; ++x) {
+                    const auto i = x + y * dims.x;
+                    const auto region = sliceRegions[i];
+                    if (region >= nRegions) {
+                        throw Exception(
+                            IVW_CONTEXT,
+                            "Unexpected region index found '{}' expected value in range [0,{})",
+                            region, nRegions);
+                    }
+                    const auto pos = size3_t{x, y, z};
+                    const auto dpos = dvec3{index2data * dvec4{pos, 1.0}};
+                    partial.regions[region].add(dpos, pos);
+                    for (size_t c = 0; c < channels; ++c) {
+                        partial.values[region * channels + c].add(dpos,
+                                                                  sliceValues[i * channels + c]);
+                    }
+                }
+            }
+        }
+    }
+
+    template <Wrapping wrapX, Wrapping wrapY, Wrapping wrapZ>
+    std::shared_ptr<DataFrame> operator()() const {
+        using TPartial = Partial<wrapX, wrapY, wrapZ>;
+        const auto makePartial = [&]() {
+            return TPartial{
+                std::vector<RegionStats<wrapX, wrapY, wrapZ>>(nRegions, {dvec3{1.0}}),
+                std::vector<ChannelStats<wrapX, wrapY, wrapZ>>(nRegions * channels, {dvec3{1.0}})};
+        };
+
+        // Every job accumulates a range of slices into statistics of its own, the partial
+        // statistics are merged in job order at the end. Limit the number of jobs to keep the
+        // memory used for the partial statistics bounded when there are many regions.
+        constexpr size_t maxPartialBytes = size_t{256} << 20;
+        const auto partialBytes = nRegions * (sizeof(RegionStats<wrapX, wrapY, wrapZ>) +
+                                              channels * sizeof(ChannelStats<wrapX, wrapY, wrapZ>));
+        const auto jobs = std::max<size_t>(
+            1, std::min({maxJobs, dims.z, maxPartialBytes / partialBytes}));
+
+        std::vector<TPartial> partials;
+        partials.reserve(jobs);
+        for (size_t job = 0; job < jobs; ++job) partials.push_back(makePartial());
+
+        std::vector<size_t> jobIndices(jobs);
+        std::iota(jobIndices.begin(), jobIndices.end(), size_t{0});
+        std::vector<std::exception_ptr> errors(jobs);
+        util::forEachParallel(
+            jobIndices,
+            [&](size_t job) {
+                try {
+                    accumulate((dims.z * job) / jobs, (dims.z * (job + 1)) / jobs, partials[job]);
+                } catch (...) {
+                    errors[job] = std::current_exception();
+                }
+            },
+            jobs);
+        for (const auto& error : errors) {
+            if (error) std::rethrow_exception(error);
+        }
+
+        auto& stats = partials.front();
+        for (size_t job = 1; job < jobs; ++job) {
+            for (size_t i = 0; i < stats.regions.size(); ++i) {
+                stats.regions[i].merge(partials[job].regions[i]);
+            }
+            for (size_t i = 0; i < stats.values.size(); ++i) {
+                stats.values[i].merge(partials[job].values[i]);
+            }
+        }
+
+        for (auto&& [region, regionStat] : util::enumerate(stats.regions)) {
+            if (regionStat.getVolume() == 0.0) {
+                throw Exception("Empty volume!");
+            }
+            (*regionVolumes)[region] = volumeScale * regionStat.getVolume();
+
+            const auto center = dvec3{data2dest * dvec4{regionStat.getCenter(), 1.0}};
+            for (int k = 0; k < 3; ++k) {
+                (*regionCenter[k])[region] = center[k];
+            }
+
+            if (!regionBoundsMin.empty()) {
+                // Transform all the corners in case the axes are not aligned with the result space
+                auto boundsMin = dvec3{std::numeric_limits<double>::max()};
+                auto boundsMax = dvec3{std::numeric_limits<double>::lowest()};
+                const auto lower = dvec3{regionStat.getBoundsMin()};
+                const auto upper = dvec3{regionStat.getBoundsMax()};
+                for (int corner = 0; corner < 8; ++corner) {
+                    const auto index = dvec3{corner & 1 ? upper.x : lower.x,
+                                             corner & 2 ? upper.y : lower.y,
+                                             corner & 4 ? upper.z : lower.z};
+                    const auto pos = dvec3{dmat4{index2dest} * dvec4{index, 1.0}};
+                    boundsMin = glm::min(boundsMin, pos);
+                    boundsMax = glm::max(boundsMax, pos);
+                }
+                for (int k = 0; k < 3; ++k) {
+                    (*regionBoundsMin[k])[region] = boundsMin[k];
+                    (*regionBoundsMax[k])[region] = boundsMax[k];
+                }
+            }
+
+            for (size_t c = 0; c < channels; ++c) {
+                const auto& stat = stats.values[region * channels + c];
+                (*regionSums[c])[region] = map.mapFromDataToValue(volumeScale * stat.getMass());
+                (*regionMean[c])[region] = map.mapFromDataToValue(stat.getMean());
+                (*regionStdDev[c])[region] =
+                    std::abs(map.mapFromDataToValue(stat.getStandardDeviation()) -
+                             map.mapFromDataToValue(0.0));
+                (*regionMin[c])[region] = map.mapFromDataToValue(stat.getMin());
+                (*regionMax[c])[region] = map.mapFromDataToValue(stat.getMax());
+
+                const auto com = dvec3{data2dest * dvec4{stat.getCenterOfMass(), 1.0}};
+                for (int k = 0; k < 3; ++k) {
+                    (*regionCoM[c][k])[region] = com[k];
+                }
+            }
+        }
+
+        df->getIndexColumn()->setHeader("Region Index");
+        auto& index = df->getIndexColumn()
+                          ->getTypedBuffer()
+                          ->getEditableRAMRepresentation()
+                          ->getDataContainer();
+        std::transform(index.begin(), index.end(), index.begin(),
+                       [&](auto index) { return index + static_cast<std::uint32_t>(minRegionId); });
+
+        return df;
+    }
+};
+
+}  // namespace
+
+std::shared_ptr<DataFrame> util::volumeRegionStatistics(const Volume& volume, const Volume& atlas,
+                                                        CoordinateSpace space, bool boundingBoxes,
+                                                        size_t jobs) {
+    if (volume.getDimensions() != atlas.getDimensions()) {
+        throw Exception(IVW_CONTEXT_CUSTOM("util::volumeRegionStatistics"),
+                        "Unexpected dimension missmatch. Volume: {}, Atlas: {}",
+                        volume.getDimensions(), atlas.getDimensions());
+    }
+    if (atlas.getDataFormat()->getComponents() != 1 ||
+        atlas.getDataFormat()->getNumericType() != NumericType::UnsignedInteger) {
+        throw Exception(
+            IVW_CONTEXT_CUSTOM("util::volumeRegionStatistics"),
+            "Unexpected atlas format found, expected an unsigned integer type. Got: {}",
+            atlas.getDataFormat()->getString());
+    }
+
+    StatsFunctor sf{volume, atlas, space, boundingBoxes, jobs};
+    return wrappingDispatch<std::shared_ptr<DataFrame>>(sf, volume.getWrapping());
+}
+
+}  // namespace inviwo
@@ -0,0 +1,182 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/glm.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/raiiutils.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/volume/algorithm/volumeregionstatistics.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size_t minRegion = 3;
+constexpr size_t nRegions = 20;
+constexpr size_t channels = 2;
+
+// Regions are columns of voxels along z, hence every region is split across all the slabs
+size_t regionIndex(const size3_t& pos) { return minRegion + pos.x / 6 + 4 * ((pos.y + pos.z) % 5); }
+
+struct SerialStats {
+    size_t count = 0;
+    std::array<double, channels> sum{};
+    std::array<double, channels> sumSqDiff{};
+    std::array<double, channels> min{std::numeric_limits<double>::max(),
+                                     std::numeric_limits<double>::max()};
+    std::array<double, channels> max{std::numeric_limits<double>::lowest(),
+                                     std::numeric_limits<double>::lowest()};
+    size3_t boundsMin{std::numeric_limits<size_t>::max()};
+    size3_t boundsMax{0};
+
+    double mean(size_t c) const { return sum[c] / static_cast<double>(count); }
+    double stdDev(size_t c) const { return std::sqrt(sumSqDiff[c] / static_cast<double>(count)); }
+};
+
+double column(const DataFrame& df, std::string_view name, size_t row) {
+    auto col = df.getColumn(name);
+    if (!col) throw Exception(fmt::format("Missing column '{}'", name));
+    return col->getAsDouble(row);
+}
+
+}  // namespace
+
+TEST(VolumeRegionStatistics, ParallelMatchesSerial) {
+    auto* app = InviwoApplication::getPtr();
+    const auto poolSize = app->getPoolSize();
+    app->resizePool(4);
+    const util::OnScopeExit restorePool{[&]() { app->resizePool(poolSize); }};
+
+    const size3_t dims{24, 20, 16};
+    const util::IndexMapper3D im(dims);
+
+    auto volumeRAM = std::make_shared<VolumeRAMPrecision<vec2>>(dims);
+    auto atlasRAM = std::make_shared<VolumeRAMPrecision<std::uint16_t>>(dims);
+    auto* values = volumeRAM->getDataTyped();
+    auto* regions = atlasRAM->getDataTyped();
+
+    // A large offset per region, a naive sum of squares would lose precision
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+    for (size_t z = 0; z < dims.z; ++z) {
+        for (size_t y = 0; y < dims.y; ++y) {
+            for (size_t x = 0; x < dims.x; ++x) {
+                const auto pos = size3_t{x, y, z};
+                const auto region = regionIndex(pos);
+                regions[im(pos)] = static_cast<std::uint16_t>(region);
+                values[im(pos)] = vec2{1000.0f * static_cast<float>(region) + dist(gen),
+                                       -0.5f * static_cast<float>(z) + dist(gen)};
+            }
+        }
+    }
+
+    auto volume = std::make_shared<Volume>(volumeRAM);
+    volume->dataMap.dataRange = dvec2{-1.0e5, 1.0e5};
+    volume->dataMap.valueRange = dvec2{-1.0e5, 1.0e5};
+    auto atlas = std::make_shared<Volume>(atlasRAM);
+    atlas->dataMap.dataRange = dvec2{minRegion, minRegion + nRegions - 1};
+    atlas->dataMap.valueRange = atlas->dataMap.dataRange;
+
+    std::vector<SerialStats> expected(nRegions);
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        auto& stats = expected[regions[i] - minRegion];
+        const auto pos = im(i);
+        ++stats.count;
+        stats.boundsMin = glm::min(stats.boundsMin, pos);
+        stats.boundsMax = glm::max(stats.boundsMax, pos);
+        for (size_t c = 0; c < channels; ++c) {
+            const auto val = static_cast<double>(util::glmcomp(values[i], c));
+            stats.sum[c] += val;
+            stats.min[c] = std::min(stats.min[c], val);
+            stats.max[c] = std::max(stats.max[c], val);
+        }
+    }
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        auto& stats = expected[regions[i] - minRegion];
+        for (size_t c = 0; c < channels; ++c) {
+            const auto diff = static_cast<double>(util::glmcomp(values[i], c)) - stats.mean(c);
+            stats.sumSqDiff[c] += diff * diff;
+        }
+    }
+
+    const auto df = util::volumeRegionStatistics(*volume, *atlas, CoordinateSpace::Index, true, 4);
+    ASSERT_TRUE(df);
+    ASSERT_EQ(nRegions, df->getNumberOfRows());
+
+    static constexpr std::array<std::string_view, 3> axes = {"x", "y", "z"};
+    for (size_t region = 0; region < nRegions; ++region) {
+        const auto& stats = expected[region];
+        SCOPED_TRACE(fmt::format("Region {}", region + minRegion));
+
+        EXPECT_EQ(static_cast<double>(region + minRegion),
+                  df->getIndexColumn()->getAsDouble(region));
+        // The voxel volume is one in index space
+        EXPECT_DOUBLE_EQ(static_cast<double>(stats.count), column(*df, "Volume", region));
+
+        for (size_t c = 0; c < channels; ++c) {
+            const auto mean = column(*df, fmt::format("Mean {}", c), region);
+            EXPECT_NEAR(stats.mean(c), mean, 1e-9 * std::max(1.0, std::abs(stats.mean(c))));
+            const auto stdDev = column(*df, fmt::format("Std Dev {}", c), region);
+            EXPECT_NEAR(stats.stdDev(c), stdDev, 1e-9 * std::max(1.0, stats.stdDev(c)));
+            EXPECT_DOUBLE_EQ(volume->dataMap.mapFromDataToValue(stats.min[c]),
+                             column(*df, fmt::format("Min {}", c), region));
+            EXPECT_DOUBLE_EQ(volume->dataMap.mapFromDataToValue(stats.max[c]),
+                             column(*df, fmt::format("Max {}", c), region));
+        }
+
+        for (size_t k = 0; k < 3; ++k) {
+            EXPECT_DOUBLE_EQ(static_cast<double>(stats.boundsMin[k]),
+                             column(*df, fmt::format("Bounds Min {}", axes[k]), region));
+            EXPECT_DOUBLE_EQ(static_cast<double>(stats.boundsMax[k]),
+                             column(*df, fmt::format("Bounds Max {}", axes[k]), region));
+        }
+    }
+}
+
+}  // namespace inviwo
@@ -31,6 +31,8 @@
 #pragma comment(linker, "/SUBSYSTEM:CONSOLE")
 #endif
 
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/common/coremodulesharedlibrary.h>
 #include <inviwo/core/util/logcentral.h>
 #include <inviwo/core/util/consolelogger.h>
 #include <inviwo/testutil/configurablegtesteventlistener.h>
@@ -47,6 +49,15 @@ int main(int argc, char** argv) {
     LogCentral::getPtr()->setVerbosity(LogVerbosity::Error);
     LogCentral::getPtr()->registerLogger(logger);
 
+    // The application provides the core representations and the thread pool used by the
+    // parallel region statistics
+    InviwoApplication app(argc, argv, "Inviwo-Unittests-Volume");
+    {
+        std::vector<std::unique_ptr<InviwoModuleFactoryObject>> modules;
+        modules.emplace_back(createInviwoCore());
+        app.registerModules(std::move(modules));
+    }
+
     int ret = -1;
     {
         ::testing::InitGoogleTest(&argc, argv);
@@ -67,6 +67,9 @@
 #include <inviwo/core/util/consolelogger.h>
 #include <inviwo/core/util/filelogger.h>
 #include <inviwo/core/util/timer.h>
+#include <inviwo/core/util/tracerecorder.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/logcentral.h>
 #include <inviwo/core/util/settings/systemsettings.h>
 #include <inviwo/core/util/commandlineparser.h>
 
@@ -78,6 +81,23 @@ namespace inviwo {
 
 InviwoApplication* InviwoApplication::instance_ = nullptr;
 
+namespace {
+
+// Relative paths given on the command line are relative to the output path if given, otherwise to
+// the working directory
+std::filesystem::path resolveOutputFile(const CommandLineParser& parser,
+                                        std::filesystem::path filename) {
+    if (filename.is_absolute()) return filename;
+    auto outputDir = parser.getOutputPath();
+    if (!outputDir.empty()) {
+        return outputDir / filename;
+    } else {
+        return filesystem::getWorkingDirectory() / filename;
+    }
+}
+
+}  // namespace
+
 InviwoApplication::InviwoApplication(int argc, char** argv, std::string_view displayName)
     : displayName_(displayName)
     , commandLineParser_(std::make_unique<CommandLineParser>(argc, argv))
@@ -92,15 +112,8 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string_view dis
     }()}
     , filelogger_{[&]() {
         if (commandLineParser_->getLogToFile()) {
-            auto filename = commandLineParser_->getLogToFileFileName();
-            if (!filename.is_absolute()) {
-                auto outputDir = commandLineParser_->getOutputPath();
-                if (!outputDir.empty()) {
-                    filename = outputDir / filename;
-                } else {
-                    filename = filesystem::getWorkingDirectory() / filename;
-                }
-            }
+            auto filename = resolveOutputFile(*commandLineParser_,
+                                              commandLineParser_->getLogToFileFileName());
             auto flog = std::make_shared<FileLogger>(filename);
             LogCentral::getPtr()->registerLogger(flog);
             return flog;
@@ -145,6 +158,10 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string_view dis
     , portInspectorManager_{std::make_unique<PortInspectorManager>(this)}
     , layerRamResizer_{nullptr} {
 
+    if (!commandLineParser_->getTraceFileName().empty()) {
+        TraceRecorder::instance().setEnabled(true);
+    }
+
     // Keep the pool at size 0 if are quiting directly to make sure that we don't have
     // unfinished results in the worker threads
     if (!commandLineParser_->getQuitApplicationAfterStartup()) {
@@ -152,6 +169,14 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string_view dis
         systemSettings_->poolSize_.onChange([this]() { resizePool(systemSettings_->poolSize_); });
     }
 
+    const auto updateEvaluationMode = [this]() {
+        processorNetworkEvaluator_->setEvaluationMode(systemSettings_->concurrentEvaluation_
+                                                          ? EvaluationMode::Concurrent
+                                                          : EvaluationMode::Serial);
+    };
+    updateEvaluationMode();
+    systemSettings_->concurrentEvaluation_.onChange(updateEvaluationMode);
+
     // initialize singletons
     init(this);
     RenderContext::init();
@@ -197,7 +222,19 @@ InviwoApplication::InviwoApplication() : InviwoApplication(0, nullptr, "Inviwo")
 InviwoApplication::InviwoApplication(std::string_view displayName)
     : InviwoApplication(0, nullptr, displayName) {}
 
-InviwoApplication::~InviwoApplication() { resizePool(0); }
+InviwoApplication::~InviwoApplication() {
+    resizePool(0);
+
+    if (const auto traceFile = commandLineParser_->getTraceFileName(); !traceFile.empty()) {
+        auto& recorder = TraceRecorder::instance();
+        recorder.setEnabled(false);
+        try {
+            recorder.exportChromeTrace(resolveOutputFile(*commandLineParser_, traceFile));
+        } catch (const Exception& e) {
+            util::log(e.getContext(), e.getMessage(), LogLevel::Error);
+        }
+    }
+}
 
 void InviwoApplication::registerModules(
     std::vector<std::unique_ptr<InviwoModuleFactoryObject>> moduleFactories) {
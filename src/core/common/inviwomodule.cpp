@@ -60,15 +60,34 @@
 #include <inviwo/core/io/serialization/versionconverter.h>
 
 #include <algorithm>
+#include <utility>
 
 namespace inviwo {
 
+namespace {
+
+thread_local bool deferModuleRegistrations = false;
+
+}  // namespace
+
+DeferModuleRegistrations::DeferModuleRegistrations() { deferModuleRegistrations = true; }
+
+DeferModuleRegistrations::~DeferModuleRegistrations() { deferModuleRegistrations = false; }
+
 InviwoModule::InviwoModule(InviwoApplication* app, std::string_view identifier)
     : app_(app)
     , identifier_(identifier)
-    , moduleRoot_{app->getModuleManager().locateModule(*this)} {}
+    , moduleRoot_{app->getModuleManager().locateModule(*this)}
+    , deferRegistrations_{deferModuleRegistrations} {}
 
 InviwoModule::~InviwoModule() {
+    // Remove any potential ModuleCallbackAction associated with this module
+    auto& callbackActions = app_->getCallbackActions();
+    std::erase_if(callbackActions, [&](const auto& a) { return a->getModule() == this; });
+
+    // Deferred registrations that were never committed have not reached the application
+    if (deferRegistrations_) return;
+
     // unregister everything...
     for (auto& elem : cameras_) {
         app_->getCameraFactory()->unRegisterObject(elem.get());
@@ -127,10 +146,6 @@ InviwoModule::~InviwoModule() {
     for (auto& elem : dataVisualizers_) {
         app_->getDataVisualizerManager()->unRegisterObject(elem.get());
     }
-
-    // Remove any potential ModuleCallbackAction associated with this module
-    auto& callbackActions = app_->getCallbackActions();
-    std::erase_if(callbackActions, [&](const auto& a) { return a->getModule() == this; });
 }
 
 const std::string& InviwoModule::getIdentifier() const { return identifier_; }
@@ -234,70 +249,77 @@ std::string InviwoModule::getDescription() const {
     return "No description available";
 }
 
+void InviwoModule::commitRegistrations() {
+    deferRegistrations_ = false;
+    for (auto& registration : std::exchange(deferredRegistrations_, {})) {
+        registration();
+    }
+}
+
+void InviwoModule::registerOrDefer(std::function<void()> registration) {
+    if (deferRegistrations_) {
+        deferredRegistrations_.push_back(std::move(registration));
+    } else {
+        registration();
+    }
+}
+
+template <typename Factory, typename T>
+void InviwoModule::registerOwned(Factory* factory, std::unique_ptr<T> object,
+                                 std::vector<std::unique_ptr<T>>& owned) {
+    auto* ptr = owned.emplace_back(std::move(object)).get();
+    registerOrDefer([factory, ptr, &owned]() {
+        if (!factory->registerObject(ptr)) {
+            std::erase_if(owned, [ptr](const auto& item) { return item.get() == ptr; });
+        }
+    });
+}
+
 void InviwoModule::registerCapabilities(std::unique_ptr<Capabilities> info) {
     capabilities_.push_back(std::move(info));
 }
 
 void InviwoModule::registerCamera(std::unique_ptr<CameraFactoryObject> camera) {
-    if (app_->getCameraFactory()->registerObject(camera.get())) {
-        cameras_.push_back(std::move(camera));
-    }
+    registerOwned(app_->getCameraFactory(), std::move(camera), cameras_);
 }
 
 void InviwoModule::registerDataReader(std::unique_ptr<DataReader> dataReader) {
-    if (app_->getDataReaderFactory()->registerObject(dataReader.get())) {
-        dataReaders_.push_back(std::move(dataReader));
-    }
+    registerOwned(app_->getDataReaderFactory(), std::move(dataReader), dataReaders_);
 }
 void InviwoModule::registerDataWriter(std::unique_ptr<DataWriter> dataWriter) {
-    if (app_->getDataWriterFactory()->registerObject(dataWriter.get())) {
-        dataWriters_.push_back(std::move(dataWriter));
-    }
+    registerOwned(app_->getDataWriterFactory(), std::move(dataWriter), dataWriters_);
 }
 void InviwoModule::registerDialog(std::unique_ptr<DialogFactoryObject> dialog) {
-    if (app_->getDialogFactory()->registerObject(dialog.get())) {
-        dialogs_.push_back(std::move(dialog));
-    }
+    registerOwned(app_->getDialogFactory(), std::move(dialog), dialogs_);
 }
 void InviwoModule::registerDrawer(std::unique_ptr<MeshDrawer> drawer) {
-    if (app_->getMeshDrawerFactory()->registerObject(drawer.get())) {
-        drawers_.push_back(std::move(drawer));
-    }
+    registerOwned(app_->getMeshDrawerFactory(), std::move(drawer), drawers_);
 }
 void InviwoModule::registerMetaData(std::unique_ptr<MetaData> meta) {
-    if (app_->getMetaDataFactory()->registerObject(meta.get())) {
-        metadata_.push_back(std::move(meta));
-    }
+    registerOwned(app_->getMetaDataFactory(), std::move(meta), metadata_);
 }
 void InviwoModule::registerProperty(std::unique_ptr<PropertyFactoryObject> property) {
-    if (app_->getPropertyFactory()->registerObject(property.get())) {
-        properties_.push_back(std::move(property));
-    }
+    registerOwned(app_->getPropertyFactory(), std::move(property), properties_);
 }
 void InviwoModule::registerPropertyWidget(
     std::unique_ptr<PropertyWidgetFactoryObject> propertyWidget) {
-    if (app_->getPropertyWidgetFactory()->registerObject(propertyWidget.get())) {
-        propertyWidgets_.push_back(std::move(propertyWidget));
-    }
+    registerOwned(app_->getPropertyWidgetFactory(), std::move(propertyWidget), propertyWidgets_);
 }
 void InviwoModule::registerPropertyConverter(std::unique_ptr<PropertyConverter> propertyConverter) {
-    if (app_->getPropertyConverterManager()->registerObject(propertyConverter.get())) {
-        propertyConverters_.push_back(std::move(propertyConverter));
-    }
+    registerOwned(app_->getPropertyConverterManager(), std::move(propertyConverter),
+                  propertyConverters_);
 }
 
 void InviwoModule::registerRepresentationFactory(
     std::unique_ptr<BaseRepresentationFactory> representationFactory) {
-    if (app_->getRepresentationMetaFactory()->registerObject(representationFactory.get())) {
-        representationFactories_.push_back(std::move(representationFactory));
-    }
+    registerOwned(app_->getRepresentationMetaFactory(), std::move(representationFactory),
+                  representationFactories_);
 }
 
 void InviwoModule::registerRepresentationConverterFactory(
     std::unique_ptr<BaseRepresentationConverterFactory> converterFactory) {
-    if (app_->getRepresentationConverterMetaFactory()->registerObject(converterFactory.get())) {
-        representationConverterFactories_.push_back(std::move(converterFactory));
-    }
+    registerOwned(app_->getRepresentationConverterMetaFactory(), std::move(converterFactory),
+                  representationConverterFactories_);
 }
 
 void InviwoModule::registerSettings(std::unique_ptr<Settings> settings) {
@@ -310,49 +332,39 @@ void InviwoModule::registerSettings(Settings* settings) { settings_.push_back(se
 InviwoApplication* InviwoModule::getInviwoApplication() const { return app_; }
 
 void InviwoModule::registerProcessor(std::unique_ptr<ProcessorFactoryObject> pfo) {
-    if (app_->getProcessorFactory()->registerObject(pfo.get())) {
-        processors_.push_back(std::move(pfo));
-    }
+    registerOwned(app_->getProcessorFactory(), std::move(pfo), processors_);
 }
 
 void InviwoModule::registerCompositeProcessor(const std::filesystem::path& file) {
-    auto processor = std::make_unique<CompositeProcessorFactoryObject>(file);
-    if (app_->getProcessorFactory()->registerObject(processor.get())) {
-        processors_.push_back(std::move(processor));
-    }
+    std::unique_ptr<ProcessorFactoryObject> processor =
+        std::make_unique<CompositeProcessorFactoryObject>(file);
+    registerOwned(app_->getProcessorFactory(), std::move(processor), processors_);
 }
 
 void InviwoModule::registerProcessorWidget(std::unique_ptr<ProcessorWidgetFactoryObject> widget) {
-    if (app_->getProcessorWidgetFactory()->registerObject(widget.get())) {
-        processorWidgets_.push_back(std::move(widget));
-    }
+    registerOwned(app_->getProcessorWidgetFactory(), std::move(widget), processorWidgets_);
 }
 
 void InviwoModule::registerPortInspector(std::string_view portClassIdentifier,
                                          const std::filesystem::path& inspectorPath) {
     auto portInspector =
         std::make_unique<PortInspectorFactoryObject>(portClassIdentifier, inspectorPath);
-
-    if (app_->getPortInspectorFactory()->registerObject(portInspector.get())) {
-        portInspectors_.push_back(std::move(portInspector));
-    }
+    registerOwned(app_->getPortInspectorFactory(), std::move(portInspector), portInspectors_);
 }
 
 void InviwoModule::registerDataVisualizer(std::unique_ptr<DataVisualizer> visualizer) {
-    app_->getDataVisualizerManager()->registerObject(visualizer.get());
+    registerOrDefer([manager = app_->getDataVisualizerManager(), visualizer = visualizer.get()]() {
+        manager->registerObject(visualizer);
+    });
     dataVisualizers_.push_back(std::move(visualizer));
 }
 
 void InviwoModule::registerInport(std::unique_ptr<InportFactoryObject> inport) {
-    if (app_->getInportFactory()->registerObject(inport.get())) {
-        inports_.push_back(std::move(inport));
-    }
+    registerOwned(app_->getInportFactory(), std::move(inport), inports_);
 }
 
 void InviwoModule::registerOutport(std::unique_ptr<OutportFactoryObject> outport) {
-    if (app_->getOutportFactory()->registerObject(outport.get())) {
-        outports_.push_back(std::move(outport));
-    }
+    registerOwned(app_->getOutportFactory(), std::move(outport), outports_);
 }
 
 }  // namespace inviwo
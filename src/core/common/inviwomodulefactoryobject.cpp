@@ -41,7 +41,7 @@ InviwoModuleFactoryObject::InviwoModuleFactoryObject(
     const std::filesystem::path& aSrcPath, Version aInviwoCoreVersion,
     std::vector<std::string> someDependencies, std::vector<Version> someDependenciesVersion,
     std::vector<std::string> someAliases, std::vector<LicenseInfo> someLicenses,
-    ProtectedModule aProtectedModule)
+    ProtectedModule aProtectedModule, ThreadSafeModule aThreadSafeModule)
     : name(aName)
     , version(aVersion)
     , description(aDescription)
@@ -59,7 +59,8 @@ InviwoModuleFactoryObject::InviwoModuleFactoryObject(
     }())
     , aliases(std::move(someAliases))
     , licenses(std::move(someLicenses))
-    , protectedModule(aProtectedModule) {}
+    , protectedModule(aProtectedModule)
+    , threadSafeModule(aThreadSafeModule) {}
 
 /**
  * \brief Sorts modules according to their dependencies.
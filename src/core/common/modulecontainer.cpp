@@ -41,6 +41,7 @@
 #include <fmt/format.h>
 #include <fmt/std.h>
 
+#include <chrono>
 #include <ranges>
 
 namespace inviwo {
@@ -145,6 +146,7 @@ void ModuleContainer::unload() {
     }
 }
 void ModuleContainer::load(bool runtimeReload) {
+    const auto start = std::chrono::steady_clock::now();
     if (runtimeReload && !isLoaded(libFile_)) {
         auto tmpFile = getTmpDir() / libFile_.filename();
         // Load a copy of the file to make sure that we can overwrite the
@@ -174,6 +176,7 @@ void ModuleContainer::load(bool runtimeReload) {
     identifier_ = toLower(factoryObject_->name);
     protectedModule_ = factoryObject_->protectedModule == ProtectedModule::on;
     protectedLibrary_ = protectedModule_;
+    loadTime_ = std::chrono::steady_clock::now() - start;
 }
 
 ModuleContainer::ModuleContainer(ModuleContainer&&) = default;
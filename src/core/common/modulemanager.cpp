@@ -37,12 +37,17 @@
 #include <inviwo/core/util/vectoroperations.h>
 #include <inviwo/core/util/utilities.h>
 #include <inviwo/core/util/capabilities.h>
+#include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/common/inviwocommondefines.h>
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <functional>
+#include <future>
 #include <ranges>
+#include <span>
 
 #include <fmt/std.h>
 
@@ -50,6 +55,10 @@ namespace inviwo {
 
 namespace {
 
+// Set by ModuleContainer::createModule for the module being constructed on this thread, modules
+// might be constructed concurrently, see registerModules.
+thread_local std::function<std::filesystem::path(const InviwoModule&)> moduleLocator;
+
 void topologicalSort(std::vector<ModuleContainer>& containers) {
 
     auto helper = [](auto& self, std::vector<ModuleContainer>& containers, const std::string& lname,
@@ -89,6 +98,42 @@ void topologicalSort(std::vector<ModuleContainer>& containers) {
     });
 }
 
+void logTimings(std::span<const ModuleTiming> timings, std::chrono::nanoseconds registration) {
+    using ms = std::chrono::duration<double, std::milli>;
+
+    ModuleTiming sum;
+    for (const auto& timing : timings) {
+        sum.load += timing.load;
+        sum.construction += timing.construction;
+        sum.capabilities += timing.capabilities;
+    }
+
+    std::vector<const ModuleTiming*> slowest;
+    for (const auto& timing : timings) slowest.push_back(&timing);
+    const auto count = std::min<size_t>(slowest.size(), 5);
+    std::partial_sort(slowest.begin(), slowest.begin() + count, slowest.end(),
+                      [](auto* a, auto* b) { return a->total() > b->total(); });
+
+    auto buff = fmt::memory_buffer();
+    for (const auto* timing : std::span{slowest}.first(count)) {
+        fmt::format_to(std::back_inserter(buff), "\n  {:<20} {:8.1f} ms (library {:.1f} ms, "
+                       "construction {:.1f} ms, capabilities {:.1f} ms)",
+                       timing->identifier, ms{timing->total()}.count(),
+                       ms{timing->load}.count(), ms{timing->construction}.count(),
+                       ms{timing->capabilities}.count());
+    }
+
+    // The libraries are loaded one at a time before the registration starts, the constructions
+    // might overlap, hence the summed construction time can exceed the registration time.
+    util::logInfo(IVW_CONTEXT_CUSTOM("ModuleManager"),
+                  "Registered {} modules in {:.1f} ms (library loading {:.1f} ms, registration "
+                  "{:.1f} ms). Summed over the modules: construction {:.1f} ms, capabilities "
+                  "{:.1f} ms. Slowest modules:{}",
+                  timings.size(), ms{sum.load + registration}.count(), ms{sum.load}.count(),
+                  ms{registration}.count(), ms{sum.construction}.count(),
+                  ms{sum.capabilities}.count(), fmt::string_view(buff.data(), buff.size()));
+}
+
 }  // namespace
 
 ModuleManager::ModuleManager(InviwoApplication* app)
@@ -114,16 +159,33 @@ void ModuleManager::registerModules(std::vector<std::unique_ptr<InviwoModuleFact
 }
 
 void ModuleManager::registerModules(std::vector<ModuleContainer> inviwoModules) {
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+
     // Topological sort to make sure that we load modules in correct order
     topologicalSort(inviwoModules);
 
+    std::vector<ModuleContainer*> pending;
     for (auto& cont : inviwoModules) {
-        app_->postProgress("Loading module: " + cont.name());
         if (getModuleByIdentifier(cont.identifier())) continue;  // already loaded
-        if (!checkDependencies(cont.factoryObject())) continue;
+        if (std::ranges::find(pending, cont.identifier(), &ModuleContainer::identifier) !=
+            pending.end()) {
+            continue;
+        }
+        pending.push_back(&cont);
+    }
 
+    std::vector<std::string> registered;
+    // Commits the registrations of a constructed module and takes ownership of it, the
+    // construction is run in the try block to log failures in the same way for all modules.
+    const auto finish = [&](ModuleContainer& cont, auto&& construct) {
         try {
-            cont.createModule(app_);
+            const std::chrono::nanoseconds construction = construct();
+            cont.getModule()->commitRegistrations();
+            recordTiming({.identifier = cont.identifier(),
+                          .load = cont.loadTime(),
+                          .construction = construction});
+            registered.push_back(cont.identifier());
             cont.setReloadCallback(app_, [this](ModuleContainer&) { reloadModules(); });
             inviwoModules_.push_back(std::move(cont));
 
@@ -142,6 +204,57 @@ void ModuleManager::registerModules(std::vector<ModuleContainer> inviwoModules)
             util::logError(IVW_CONTEXT, "Failed to register module: {}. Reason:\n{}", cont.name(),
                            e.what());
         }
+    };
+
+    while (!pending.empty()) {
+        // Thread safe modules that do not depend on any pending module are constructed
+        // concurrently on the pool, all other modules one at a time in topological order.
+        std::vector<ModuleContainer*> batch;
+        for (auto* cont : pending) {
+            if (cont->factoryObject().threadSafeModule == ThreadSafeModule::on &&
+                std::ranges::none_of(pending, [&](const ModuleContainer* other) {
+                    return cont->dependsOn(other->identifier());
+                })) {
+                batch.push_back(cont);
+            }
+        }
+        if (batch.size() < 2 || app_->getPoolSize() == 0) {
+            batch.assign(1, pending.front());
+        }
+        std::erase_if(pending, [&](ModuleContainer* cont) { return util::contains(batch, cont); });
+
+        for (auto* cont : batch) {
+            app_->postProgress("Loading module: " + cont->name());
+        }
+        std::erase_if(batch, [&](const ModuleContainer* cont) {
+            return !checkDependencies(cont->factoryObject());
+        });
+
+        if (batch.size() == 1) {
+            auto& cont = *batch.front();
+            finish(cont, [&]() {
+                const auto constructionStart = clock::now();
+                cont.createModule(app_);
+                return clock::now() - constructionStart;
+            });
+        } else if (batch.size() > 1) {
+            std::vector<std::future<std::chrono::nanoseconds>> constructions;
+            for (auto* cont : batch) {
+                constructions.push_back(
+                    util::dispatchPool(app_, [app = app_, cont]() -> std::chrono::nanoseconds {
+                        const DeferModuleRegistrations defer;
+                        const auto constructionStart = clock::now();
+                        cont->createModule(app);
+                        return clock::now() - constructionStart;
+                    }));
+            }
+            // The constructors might look up registered modules, wait for all of them before
+            // modifying inviwoModules_.
+            for (auto& construction : constructions) construction.wait();
+            for (size_t i = 0; i < batch.size(); ++i) {
+                finish(*batch[i], [&]() { return constructions[i].get(); });
+            }
+        }
     }
 
     ModuleContainer::updateGraph(inviwoModules_);
@@ -149,11 +262,23 @@ void ModuleManager::registerModules(std::vector<ModuleContainer> inviwoModules)
     app_->postProgress("Loading Capabilities");
     for (auto& cont : inviwoModules_) {
         if (auto* inviwoModule = cont.getModule()) {
+            const auto capabilitiesStart = clock::now();
             for (auto& capability : inviwoModule->getCapabilities()) {
                 capability->retrieveStaticInfo();
                 capability->printInfo();
             }
+            if (util::contains(registered, cont.identifier())) {
+                findTiming(cont.identifier())->capabilities = clock::now() - capabilitiesStart;
+            }
+        }
+    }
+
+    if (!registered.empty()) {
+        std::vector<ModuleTiming> added;
+        for (const auto& identifier : registered) {
+            added.push_back(*findTiming(identifier));
         }
+        logTimings(added, clock::now() - start);
     }
 
     onModulesDidRegister_.invoke();
@@ -218,6 +343,7 @@ void ModuleManager::reloadModules() {
     for (auto& cont : inviwoModules_ | std::views::reverse) {
         if (!cont.isProtectedModule()) {
             cont.resetModule();
+            eraseTiming(cont.identifier());
         }
     }
 
@@ -235,7 +361,12 @@ void ModuleManager::reloadModules() {
     for (auto& cont : inviwoModules_) {
         if (!cont.isProtectedModule()) {
             try {
+                using clock = std::chrono::steady_clock;
+                const auto constructionStart = clock::now();
                 cont.createModule(app_);
+                recordTiming({.identifier = cont.identifier(),
+                              .load = cont.loadTime(),
+                              .construction = clock::now() - constructionStart});
             } catch (const ModuleInitException& e) {
                 const auto dereg = deregisterDependentModules(e.getModulesToDeregister());
 
@@ -464,19 +595,37 @@ std::vector<std::string> ModuleManager::deregisterDependentModules(
         if (deregister.contains(cont.identifier())) {
             deregistered.push_back(cont.identifier());
             cont.resetModule();
+            eraseTiming(cont.identifier());
         }
     }
 
     return deregistered;
 }
 
+ModuleTiming* ModuleManager::findTiming(std::string_view identifier) {
+    auto it = std::ranges::find(timings_, identifier, &ModuleTiming::identifier);
+    return it != timings_.end() ? &*it : nullptr;
+}
+
+void ModuleManager::recordTiming(ModuleTiming timing) {
+    if (auto* existing = findTiming(timing.identifier)) {
+        *existing = std::move(timing);
+    } else {
+        timings_.push_back(std::move(timing));
+    }
+}
+
+void ModuleManager::eraseTiming(std::string_view identifier) {
+    std::erase_if(timings_, [&](const ModuleTiming& t) { return t.identifier == identifier; });
+}
+
 void ModuleManager::setModuleLocator(
-    std::function<std::filesystem::path(const InviwoModule&)> moduleLocator) {
-    moduleLocator_ = moduleLocator;
+    std::function<std::filesystem::path(const InviwoModule&)> locator) {
+    moduleLocator = std::move(locator);
 }
 std::filesystem::path ModuleManager::locateModule(const InviwoModule& m) const {
-    if (moduleLocator_) {
-        return moduleLocator_(m);
+    if (moduleLocator) {
+        return moduleLocator(m);
     } else {
         auto path = filesystem::findBasePath() / "modules" / toLower(m.getIdentifier());
         return path.lexically_normal();
@@ -76,4 +76,15 @@ Statistics util::calculateHistogramStats(const std::vector<size_t>& hist) {
             .percentiles = std::move(percentiles)};
 }
 
+std::vector<size_t> util::progressiveHistogramStrides(size_t size, size_t minSamples) {
+    constexpr size_t factor = 7;
+    minSamples = std::max(minSamples, size_t{1});
+    std::vector<size_t> strides{1};
+    while (size / (strides.back() * factor) >= minSamples) {
+        strides.push_back(strides.back() * factor);
+    }
+    std::reverse(strides.begin(), strides.end());
+    return strides;
+}
+
 }  // namespace inviwo
@@ -63,6 +63,12 @@ HistogramCache& HistogramCache::operator=(HistogramCache&& that) noexcept {
 auto HistogramCache::calculateHistograms(
     const std::function<std::vector<Histogram1D>()>& calculate,
     const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const -> Result {
+    return calculateHistograms([calculate](size_t) { return calculate(); }, {1}, whenDone);
+}
+
+auto HistogramCache::calculateHistograms(
+    const std::function<ProgressiveCalculate>& calculate, const std::vector<size_t>& strides,
+    const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const -> Result {
     const std::scoped_lock lock{state_->mutex};
 
     Result result;
@@ -70,6 +76,10 @@ auto HistogramCache::calculateHistograms(
     if (state_->status == Status::Valid && whenDone) {
         whenDone(state_->histograms);
         result.progress = Progress::Done;
+    } else if (state_->status == Status::Approximate && whenDone) {
+        whenDone(state_->histograms);
+        result.handle = state_->callbacks.add(whenDone);
+        result.progress = Progress::Approximate;
     } else if (state_->status != Status::Valid && whenDone) {
         result.handle = state_->callbacks.add(whenDone);
         result.progress = Progress::Calculating;
@@ -78,15 +88,21 @@ auto HistogramCache::calculateHistograms(
     if (state_->status == Status::NotSet) {
         result.progress = Progress::Calculating;
         state_->status = Status::Calculating;
-        dispatchPool([calculate, weakState = std::weak_ptr<State>(state_)]() {
-            if (auto state = weakState.lock()) {
-                auto newHistograms = calculate();
-                dispatchFrontAndForget([weakState = std::weak_ptr<State>(state),
+        dispatchPool([calculate, strides = strides.empty() ? std::vector<size_t>{1} : strides,
+                      weakState = std::weak_ptr<State>(state_)]() {
+            for (auto&& [pass, stride] : util::enumerate(strides)) {
+                auto state = weakState.lock();
+                if (!state) return;
+
+                auto newHistograms = calculate(stride);
+                const auto status =
+                    pass + 1 == strides.size() ? Status::Valid : Status::Approximate;
+                dispatchFrontAndForget([weakState = std::weak_ptr<State>(state), status,
                                         newHistograms = std::move(newHistograms)]() mutable {
                     if (auto state = weakState.lock()) {
                         const std::scoped_lock lock{state->mutex};
                         state->histograms = std::move(newHistograms);
-                        state->status = Status::Valid;
+                        state->status = status;
                         state->callbacks.invoke(state->histograms);
                     }
                 });
@@ -106,6 +122,11 @@ void HistogramCache::forEach(
 }
 
 void HistogramCache::discard(const std::function<std::vector<Histogram1D>()>& calculate) {
+    discard([calculate](size_t) { return calculate(); }, {1});
+}
+
+void HistogramCache::discard(const std::function<ProgressiveCalculate>& calculate,
+                             const std::vector<size_t>& strides) {
     bool reCalculate = false;
     std::shared_ptr<State> newState;
     {
@@ -116,7 +137,8 @@ void HistogramCache::discard(const std::function<std::vector<Histogram1D>()>& ca
         } else if (state_->status == Status::Valid) {
             state_->status = Status::NotSet;
             reCalculate = true;
-        } else if (state_->status == Status::Calculating) {
+        } else if (state_->status == Status::Calculating ||
+                   state_->status == Status::Approximate) {
             newState = std::make_shared<State>();
             newState->callbacks = std::move(state_->callbacks);
             reCalculate = true;
@@ -126,7 +148,7 @@ void HistogramCache::discard(const std::function<std::vector<Histogram1D>()>& ca
         state_ = std::move(newState);
     }
     if (reCalculate) {
-        calculateHistograms(calculate, nullptr);
+        calculateHistograms(calculate, strides, nullptr);
     }
 }
 
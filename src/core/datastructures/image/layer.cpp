@@ -35,6 +35,8 @@
 #include <inviwo/core/io/datawriterfactory.h>
 #include <inviwo/core/io/datawriterexception.h>
 
+#include <glm/gtx/component_wise.hpp>
+
 namespace inviwo {
 
 Layer::Layer(size2_t defaultDimensions, const DataFormatBase* defaultFormat, LayerType type,
@@ -238,21 +240,28 @@ LayerConfig Layer::config() const {
 namespace {
 
 auto histCalc(const Layer& v) {
-    return [dataMap = v.dataMap, repr = v.getRepresentationShared<LayerRAM>()]() {
+    // The LayerRAM representation is captured up front, the background passes can not refer back
+    // to the layer since it might be destroyed while they run. Hence the first approximate pass
+    // is only published once all the data is loaded, the strides only shorten the binning.
+    return [dataMap = v.dataMap, repr = v.getRepresentationShared<LayerRAM>()](size_t stride) {
         return repr->dispatch<std::vector<Histogram1D>>(
             [&]<typename T>(const LayerRAMPrecision<T>* rp) {
-                return util::calculateHistograms(rp->getView(), dataMap, 2048);
+                return util::calculateHistograms(rp->getView(), dataMap, 2048, stride);
             });
     };
 }
 
+auto histStrides(const Layer& v) {
+    return util::progressiveHistogramStrides(glm::compMul(v.getDimensions()));
+}
+
 }  // namespace
 
-void Layer::discardHistograms() { histograms_.discard(histCalc(*this)); }
+void Layer::discardHistograms() { histograms_.discard(histCalc(*this), histStrides(*this)); }
 
 HistogramCache::Result Layer::calculateHistograms(
     const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const {
-    return histograms_.calculateHistograms(histCalc(*this), whenDone);
+    return histograms_.calculateHistograms(histCalc(*this), histStrides(*this), whenDone);
 }
 
 template class IVW_CORE_TMPL_INST DataReaderType<Layer>;
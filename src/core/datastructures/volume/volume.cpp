@@ -31,6 +31,8 @@
 #include <inviwo/core/datastructures/volume/volumeram.h>
 #include <inviwo/core/util/document.h>
 
+#include <glm/gtx/component_wise.hpp>
+
 #include <fmt/format.h>
 
 namespace inviwo {
@@ -243,21 +245,28 @@ const std::string Volume::dataName = "Volume";
 namespace {
 
 auto histCalc(const Volume& v) {
-    return [dataMap = v.dataMap, repr = v.getRepresentationShared<VolumeRAM>()]() {
+    // The VolumeRAM representation is captured up front, the background passes can not refer back
+    // to the volume since it might be destroyed while they run. Hence the first approximate pass
+    // is only published once all the data is loaded, the strides only shorten the binning.
+    return [dataMap = v.dataMap, repr = v.getRepresentationShared<VolumeRAM>()](size_t stride) {
         return repr->dispatch<std::vector<Histogram1D>>(
             [&]<typename T>(const VolumeRAMPrecision<T>* rp) {
-                return util::calculateHistograms(rp->getView(), dataMap, 2048);
+                return util::calculateHistograms(rp->getView(), dataMap, 2048, stride);
             });
     };
 }
 
+auto histStrides(const Volume& v) {
+    return util::progressiveHistogramStrides(glm::compMul(v.getDimensions()));
+}
+
 }  // namespace
 
-void Volume::discardHistograms() { histograms_.discard(histCalc(*this)); }
+void Volume::discardHistograms() { histograms_.discard(histCalc(*this), histStrides(*this)); }
 
 HistogramCache::Result Volume::calculateHistograms(
     const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const {
-    return histograms_.calculateHistograms(histCalc(*this), whenDone);
+    return histograms_.calculateHistograms(histCalc(*this), histStrides(*this), whenDone);
 }
 
 template class IVW_CORE_TMPL_INST DataReaderType<Volume>;
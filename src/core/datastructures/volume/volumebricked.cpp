@@ -0,0 +1,262 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/assertion.h>
+
+namespace inviwo {
+
+VolumeBricked::VolumeBricked(std::shared_ptr<const VolumeBrickSource> source, size3_t brickSize,
+                             size_t memoryBudget, const SwizzleMask& swizzleMask,
+                             InterpolationType interpolation, const Wrapping3D& wrapping)
+    : VolumeRepresentation{}
+    , source_{std::move(source)}
+    , dimensions_{source_ ? source_->getDimensions() : size3_t{0}}
+    , brickSize_{glm::max(glm::min(brickSize, dimensions_), size3_t{1})}
+    , numBricks_{(dimensions_ + brickSize_ - size3_t{1}) / brickSize_}
+    , swizzleMask_{swizzleMask}
+    , interpolation_{interpolation}
+    , wrapping_{wrapping}
+    , memoryBudget_{memoryBudget} {
+
+    if (!source_) {
+        throw Exception("VolumeBricked requires a brick source", IVW_CONTEXT);
+    }
+}
+
+VolumeBricked::VolumeBricked(const VolumeBricked& rhs)
+    : VolumeRepresentation{rhs}
+    , source_{rhs.source_}
+    , dimensions_{rhs.dimensions_}
+    , brickSize_{rhs.brickSize_}
+    , numBricks_{rhs.numBricks_}
+    , swizzleMask_{rhs.swizzleMask_}
+    , interpolation_{rhs.interpolation_}
+    , wrapping_{rhs.wrapping_}
+    , memoryBudget_{rhs.getMemoryBudget()} {}
+
+VolumeBricked& VolumeBricked::operator=(const VolumeBricked& that) {
+    if (this != &that) {
+        VolumeRepresentation::operator=(that);
+        const auto budget = that.getMemoryBudget();
+
+        std::scoped_lock lock{mutex_};
+        source_ = that.source_;
+        dimensions_ = that.dimensions_;
+        brickSize_ = that.brickSize_;
+        numBricks_ = that.numBricks_;
+        swizzleMask_ = that.swizzleMask_;
+        interpolation_ = that.interpolation_;
+        wrapping_ = that.wrapping_;
+        memoryBudget_ = budget;
+        lru_.clear();
+        bricks_.clear();
+        residentBytes_ = 0;
+        stats_ = CacheStats{};
+    }
+    return *this;
+}
+
+VolumeBricked* VolumeBricked::clone() const { return new VolumeBricked(*this); }
+
+VolumeBricked::~VolumeBricked() = default;
+
+std::type_index VolumeBricked::getTypeIndex() const {
+    return std::type_index(typeid(VolumeBricked));
+}
+
+const DataFormatBase* VolumeBricked::getDataFormat() const { return source_->getDataFormat(); }
+
+void VolumeBricked::setDimensions(size3_t) {
+    throw Exception("Can not set dimension of a bricked Volume", IVW_CONTEXT);
+}
+
+const size3_t& VolumeBricked::getDimensions() const { return dimensions_; }
+
+void VolumeBricked::setSwizzleMask(const SwizzleMask& mask) { swizzleMask_ = mask; }
+
+SwizzleMask VolumeBricked::getSwizzleMask() const { return swizzleMask_; }
+
+void VolumeBricked::setInterpolation(InterpolationType interpolation) {
+    interpolation_ = interpolation;
+}
+
+InterpolationType VolumeBricked::getInterpolation() const { return interpolation_; }
+
+void VolumeBricked::setWrapping(const Wrapping3D& wrapping) { wrapping_ = wrapping; }
+
+Wrapping3D VolumeBricked::getWrapping() const { return wrapping_; }
+
+const std::shared_ptr<const VolumeBrickSource>& VolumeBricked::getSource() const {
+    return source_;
+}
+
+size3_t VolumeBricked::getBrickSize() const { return brickSize_; }
+
+size3_t VolumeBricked::getNumberOfBricks() const { return numBricks_; }
+
+size3_t VolumeBricked::getBrickIndex(const size3_t& pos) const { return pos / brickSize_; }
+
+size3_t VolumeBricked::getBrickOffset(const size3_t& brick) const { return brick * brickSize_; }
+
+size3_t VolumeBricked::getBrickExtent(const size3_t& brick) const {
+    const auto offset = getBrickOffset(brick);
+    return glm::min(brickSize_, dimensions_ - offset);
+}
+
+std::shared_ptr<const VolumeRAM> VolumeBricked::findBrick(size_t index) const {
+    if (auto it = bricks_.find(index); it != bricks_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second.lru);
+        return it->second.brick;
+    }
+    return nullptr;
+}
+
+void VolumeBricked::evict(size_t keep) const {
+    while (residentBytes_ > memoryBudget_ && !lru_.empty() && lru_.back() != keep) {
+        const auto it = bricks_.find(lru_.back());
+        residentBytes_ -= it->second.brick->getNumberOfBytes();
+        bricks_.erase(it);
+        lru_.pop_back();
+        ++stats_.evictions;
+    }
+}
+
+std::shared_ptr<const VolumeRAM> VolumeBricked::getBrick(const size3_t& brick) const {
+    IVW_ASSERT(glm::all(glm::lessThan(brick, numBricks_)), "Brick index out of range");
+    const auto index = util::IndexMapper3D{numBricks_}(brick);
+    {
+        std::scoped_lock lock{mutex_};
+        if (auto ram = findBrick(index)) {
+            ++stats_.hits;
+            return ram;
+        }
+    }
+
+    // Load without holding the lock, to not block access to resident bricks
+    const auto extent = getBrickExtent(brick);
+    auto ram = createVolumeRAM(extent, source_->getDataFormat(), nullptr, swizzleMask_,
+                               interpolation_, wrapping_);
+    source_->read(getBrickOffset(brick), extent, ram->getData());
+
+    std::scoped_lock lock{mutex_};
+    ++stats_.misses;
+    if (auto existing = findBrick(index)) {  // Loaded concurrently by another thread
+        return existing;
+    }
+    lru_.push_front(index);
+    bricks_.emplace(index, Entry{ram, lru_.begin()});
+    residentBytes_ += ram->getNumberOfBytes();
+    evict(index);
+    return ram;
+}
+
+VolumeBricked::Cursor::Cursor(const VolumeBricked& volume) : volume_{&volume} {}
+
+std::pair<const VolumeRAM*, size3_t> VolumeBricked::Cursor::locate(const size3_t& pos) {
+    const auto brick = volume_->getBrickIndex(pos);
+    for (size_t i = 0; i < slots; ++i) {
+        if (bricks_[i] && index_[i] == brick) {
+            return {bricks_[i].get(), pos - volume_->getBrickOffset(brick)};
+        }
+    }
+    const auto slot = next_;
+    next_ = (next_ + 1) % slots;
+    index_[slot] = brick;
+    bricks_[slot] = volume_->getBrick(brick);
+    return {bricks_[slot].get(), pos - volume_->getBrickOffset(brick)};
+}
+
+double VolumeBricked::getAsDouble(const size3_t& pos) const {
+    const auto brick = getBrickIndex(pos);
+    return getBrick(brick)->getAsDouble(pos - getBrickOffset(brick));
+}
+dvec2 VolumeBricked::getAsDVec2(const size3_t& pos) const {
+    const auto brick = getBrickIndex(pos);
+    return getBrick(brick)->getAsDVec2(pos - getBrickOffset(brick));
+}
+dvec3 VolumeBricked::getAsDVec3(const size3_t& pos) const {
+    const auto brick = getBrickIndex(pos);
+    return getBrick(brick)->getAsDVec3(pos - getBrickOffset(brick));
+}
+dvec4 VolumeBricked::getAsDVec4(const size3_t& pos) const {
+    const auto brick = getBrickIndex(pos);
+    return getBrick(brick)->getAsDVec4(pos - getBrickOffset(brick));
+}
+
+double VolumeBricked::getAsNormalizedDouble(const size3_t& pos) const {
+    const auto brick = getBrickIndex(pos);
+    return getBrick(brick)->getAsNormalizedDouble(pos - getBrickOffset(brick));
+}
+dvec2 VolumeBricked::getAsNormalizedDVec2(const size3_t& pos) const {
+    const auto brick = getBrickIndex(pos);
+    return getBrick(brick)->getAsNormalizedDVec2(pos - getBrickOffset(brick));
+}
+dvec3 VolumeBricked::getAsNormalizedDVec3(const size3_t& pos) const {
+    const auto brick = getBrickIndex(pos);
+    return getBrick(brick)->getAsNormalizedDVec3(pos - getBrickOffset(brick));
+}
+dvec4 VolumeBricked::getAsNormalizedDVec4(const size3_t& pos) const {
+    const auto brick = getBrickIndex(pos);
+    return getBrick(brick)->getAsNormalizedDVec4(pos - getBrickOffset(brick));
+}
+
+void VolumeBricked::setMemoryBudget(size_t bytes) {
+    std::scoped_lock lock{mutex_};
+    memoryBudget_ = bytes;
+    evict(lru_.empty() ? 0 : lru_.front());
+}
+
+size_t VolumeBricked::getMemoryBudget() const {
+    std::scoped_lock lock{mutex_};
+    return memoryBudget_;
+}
+
+size_t VolumeBricked::getResidentBytes() const {
+    std::scoped_lock lock{mutex_};
+    return residentBytes_;
+}
+
+void VolumeBricked::clearCache() {
+    std::scoped_lock lock{mutex_};
+    stats_.evictions += bricks_.size();
+    lru_.clear();
+    bricks_.clear();
+    residentBytes_ = 0;
+}
+
+auto VolumeBricked::getCacheStats() const -> CacheStats {
+    std::scoped_lock lock{mutex_};
+    return stats_;
+}
+
+}  // namespace inviwo
@@ -35,8 +35,66 @@
 #include <fmt/format.h>
 #include <fmt/std.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
 namespace inviwo {
 
+namespace {
+
+template <typename U>
+constexpr U byteswap(U v) noexcept {
+    if constexpr (sizeof(U) == 2) {
+        return static_cast<U>((v >> 8) | (v << 8));
+    } else if constexpr (sizeof(U) == 4) {
+        return ((v & 0x000000FFu) << 24) | ((v & 0x0000FF00u) << 8) | ((v & 0x00FF0000u) >> 8) |
+               ((v & 0xFF000000u) >> 24);
+    } else {
+        return ((v & 0x00000000000000FFull) << 56) | ((v & 0x000000000000FF00ull) << 40) |
+               ((v & 0x0000000000FF0000ull) << 24) | ((v & 0x00000000FF000000ull) << 8) |
+               ((v & 0x000000FF00000000ull) >> 8) | ((v & 0x0000FF0000000000ull) >> 24) |
+               ((v & 0x00FF000000000000ull) >> 40) | ((v & 0xFF00000000000000ull) >> 56);
+    }
+}
+
+// Written as a plain loop over unsigned integers so that the compiler can vectorize it
+template <typename U>
+void swapInPlace(std::byte* data, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        U value;
+        std::memcpy(&value, data + i * sizeof(U), sizeof(U));
+        value = byteswap(value);
+        std::memcpy(data + i * sizeof(U), &value, sizeof(U));
+    }
+}
+
+}  // namespace
+
+void util::swapEndianInPlace(void* data, size_t bytes, size_t elementSize) {
+    auto* ptr = static_cast<std::byte*>(data);
+    switch (elementSize) {
+        case 0:
+        case 1:
+            return;
+        case 2:
+            swapInPlace<std::uint16_t>(ptr, bytes / 2);
+            return;
+        case 4:
+            swapInPlace<std::uint32_t>(ptr, bytes / 4);
+            return;
+        case 8:
+            swapInPlace<std::uint64_t>(ptr, bytes / 8);
+            return;
+        default:
+            for (size_t i = 0; i + elementSize <= bytes; i += elementSize) {
+                std::reverse(ptr + i, ptr + i + elementSize);
+            }
+            return;
+    }
+}
+
 void util::readBytesIntoBuffer(const std::filesystem::path& file, size_t offset, size_t bytes,
                                bool littleEndian, size_t elementSize, void* dest) {
     auto fin = std::ifstream(file, std::ios::in | std::ios::binary);
@@ -47,17 +105,7 @@ void util::readBytesIntoBuffer(const std::filesystem::path& file, size_t offset,
         fin.read(static_cast<char*>(dest), bytes);
 
         if (!littleEndian && elementSize > 1) {
-            char* temp = new char[elementSize];
-
-            for (std::size_t i = 0; i < bytes; i += elementSize) {
-                for (std::size_t j = 0; j < elementSize; j++)
-                    temp[j] = static_cast<char*>(dest)[i + j];
-
-                for (std::size_t j = 0; j < elementSize; j++)
-                    static_cast<char*>(dest)[i + j] = temp[elementSize - j - 1];
-            }
-
-            delete[] temp;
+            swapEndianInPlace(dest, bytes, elementSize);
         }
     } else {
         throw DataReaderException(IVW_CONTEXT_CUSTOM("readBytesIntoBuffer"),
@@ -0,0 +1,163 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/util/exception.h>
+
+#include <fmt/std.h>
+
+#include <system_error>
+#include <utility>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace inviwo {
+
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& file, size_t offset, size_t size) {
+    std::error_code ec;
+    const auto fileSize = static_cast<size_t>(std::filesystem::file_size(file, ec));
+    if (ec) {
+        throw FileException(IVW_CONTEXT, "Could not get the size of file {}: {}", file,
+                            ec.message());
+    }
+    if (offset > fileSize || (size != 0 && offset + size > fileSize)) {
+        throw FileException(IVW_CONTEXT,
+                            "Could not map {} bytes at offset {} of file {} with size {}", size,
+                            offset, file, fileSize);
+    }
+    if (size == 0) size = fileSize - offset;
+    if (size == 0) return;
+
+#ifdef WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const size_t granularity = info.dwAllocationGranularity;
+    const size_t alignedOffset = offset - offset % granularity;
+
+    fileHandle_ = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle_ == INVALID_HANDLE_VALUE) {
+        fileHandle_ = nullptr;
+        throw FileException(IVW_CONTEXT, "Could not open file {}", file);
+    }
+    mappingHandle_ = CreateFileMappingW(fileHandle_, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (!mappingHandle_) {
+        unmap();
+        throw FileException(IVW_CONTEXT, "Could not create a file mapping for {}", file);
+    }
+    mappingSize_ = size + (offset - alignedOffset);
+    mapping_ = MapViewOfFile(mappingHandle_, FILE_MAP_COPY,
+                             static_cast<DWORD>(static_cast<uint64_t>(alignedOffset) >> 32),
+                             static_cast<DWORD>(alignedOffset & 0xFFFFFFFF), mappingSize_);
+    if (!mapping_) {
+        unmap();
+        throw FileException(IVW_CONTEXT, "Could not map file {}", file);
+    }
+#else
+    const auto granularity = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t alignedOffset = offset - offset % granularity;
+
+    const int fd = ::open(file.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw FileException(IVW_CONTEXT, "Could not open file {}", file);
+    }
+    mappingSize_ = size + (offset - alignedOffset);
+    void* mapping = ::mmap(nullptr, mappingSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd,
+                           static_cast<off_t>(alignedOffset));
+    // the mapping keeps a reference to the file
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw FileException(IVW_CONTEXT, "Could not map file {}", file);
+    }
+    mapping_ = mapping;
+#endif
+
+    data_ = static_cast<std::byte*>(mapping_) + (offset - alignedOffset);
+    size_ = size;
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& rhs) noexcept
+    : mapping_{std::exchange(rhs.mapping_, nullptr)}
+    , mappingSize_{std::exchange(rhs.mappingSize_, 0)}
+    , data_{std::exchange(rhs.data_, nullptr)}
+    , size_{std::exchange(rhs.size_, 0)}
+#ifdef WIN32
+    , fileHandle_{std::exchange(rhs.fileHandle_, nullptr)}
+    , mappingHandle_{std::exchange(rhs.mappingHandle_, nullptr)}
+#endif
+{
+}
+
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& rhs) noexcept {
+    if (this != &rhs) {
+        unmap();
+        mapping_ = std::exchange(rhs.mapping_, nullptr);
+        mappingSize_ = std::exchange(rhs.mappingSize_, 0);
+        data_ = std::exchange(rhs.data_, nullptr);
+        size_ = std::exchange(rhs.size_, 0);
+#ifdef WIN32
+        fileHandle_ = std::exchange(rhs.fileHandle_, nullptr);
+        mappingHandle_ = std::exchange(rhs.mappingHandle_, nullptr);
+#endif
+    }
+    return *this;
+}
+
+MemoryMappedFile::~MemoryMappedFile() { unmap(); }
+
+void MemoryMappedFile::adviseSequential() const {
+#ifndef WIN32
+    if (mapping_) ::madvise(mapping_, mappingSize_, MADV_SEQUENTIAL);
+#endif
+}
+
+void MemoryMappedFile::unmap() noexcept {
+#ifdef WIN32
+    if (mapping_) UnmapViewOfFile(mapping_);
+    if (mappingHandle_) CloseHandle(mappingHandle_);
+    if (fileHandle_) CloseHandle(fileHandle_);
+    mappingHandle_ = nullptr;
+    fileHandle_ = nullptr;
+#else
+    if (mapping_) ::munmap(mapping_, mappingSize_);
+#endif
+    mapping_ = nullptr;
+    mappingSize_ = 0;
+    data_ = nullptr;
+    size_ = 0;
+}
+
+}  // namespace inviwo
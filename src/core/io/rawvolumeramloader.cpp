@@ -30,24 +30,83 @@
 #include <inviwo/core/io/rawvolumeramloader.h>
 
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/glmfmt.h>
 
 #include <glm/gtx/component_wise.hpp>
 
+#include <bit>
+#include <cstdint>
+#include <fstream>
+
 namespace inviwo {
 
+namespace {
+
+/**
+ * A VolumeRAMPrecision that uses the memory of a MemoryMappedFile instead of owning its data.
+ */
+template <typename T>
+class VolumeRAMMapped : public VolumeRAMPrecision<T> {
+public:
+    VolumeRAMMapped(std::shared_ptr<MemoryMappedFile> file, const VolumeRepresentation& src)
+        : VolumeRAMPrecision<T>(static_cast<T*>(file->data()), src.getDimensions(),
+                                src.getSwizzleMask(), src.getInterpolation(), src.getWrapping())
+        , file_{std::move(file)} {
+        this->removeDataOwnership();
+    }
+    virtual ~VolumeRAMMapped() = default;
+
+private:
+    std::shared_ptr<MemoryMappedFile> file_;
+};
+
+std::shared_ptr<VolumeRAM> createMappedVolumeRAM(const std::filesystem::path& rawFile,
+                                                 size_t offset, size_t size,
+                                                 const VolumeRepresentation& src) {
+    std::shared_ptr<MemoryMappedFile> file;
+    try {
+        file = std::make_shared<MemoryMappedFile>(rawFile, offset, size);
+    } catch (const FileException&) {
+        return nullptr;
+    }
+
+    return dispatching::singleDispatch<std::shared_ptr<VolumeRAM>, dispatching::filter::All>(
+        src.getDataFormat()->getId(), [&]<typename T>() -> std::shared_ptr<VolumeRAM> {
+            if (reinterpret_cast<std::uintptr_t>(file->data()) % alignof(T) != 0) {
+                return nullptr;
+            }
+            return std::make_shared<VolumeRAMMapped<T>>(std::move(file), src);
+        });
+}
+
+}  // namespace
+
 RawVolumeRAMLoader::RawVolumeRAMLoader(const std::filesystem::path& rawFile, size_t offset,
-                                       bool littleEndian)
-    : rawFile_(rawFile), offset_(offset), littleEndian_(littleEndian) {}
+                                       bool littleEndian, bool memoryMap)
+    : rawFile_(rawFile), offset_(offset), littleEndian_(littleEndian), memoryMap_(memoryMap) {}
 
 RawVolumeRAMLoader* RawVolumeRAMLoader::clone() const { return new RawVolumeRAMLoader(*this); }
 
 std::shared_ptr<VolumeRepresentation> RawVolumeRAMLoader::createRepresentation(
     const VolumeRepresentation& src) const {
 
-    const auto size = glm::compMul(src.getDimensions()) * src.getDataFormat()->getSizeInBytes();
+    const auto elementSize = src.getDataFormat()->getSizeInBytes();
+    const auto size = glm::compMul(src.getDimensions()) * elementSize;
+
+    const bool nativeEndian =
+        elementSize == 1 || littleEndian_ == (std::endian::native == std::endian::little);
+    if (memoryMap_ && nativeEndian && size > 0) {
+        if (auto volumeRAM = createMappedVolumeRAM(rawFile_, offset_, size, src)) {
+            return volumeRAM;
+        }
+    }
+
     auto data = std::make_unique<char[]>(size);
-    util::readBytesIntoBuffer(rawFile_, offset_, size, littleEndian_,
-                              src.getDataFormat()->getSizeInBytes(), data.get());
+    util::readBytesIntoBuffer(rawFile_, offset_, size, littleEndian_, elementSize, data.get());
 
     auto volumeRAM =
         createVolumeRAM(src.getDimensions(), src.getDataFormat(), data.get(), src.getSwizzleMask(),
@@ -74,4 +133,64 @@ void RawVolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentati
     volumeDst->setInterpolation(src.getInterpolation());
     volumeDst->setWrapping(src.getWrapping());
 }
+
+std::shared_ptr<VolumeBrickSource> RawVolumeRAMLoader::createBrickSource(
+    const VolumeRepresentation& src) const {
+    return std::make_shared<RawVolumeBrickSource>(rawFile_, offset_, src.getDimensions(),
+                                                  src.getDataFormat(), littleEndian_);
+}
+
+std::shared_ptr<VolumeBricked> RawVolumeRAMLoader::createBricked(
+    const VolumeRepresentation& src) const {
+    return std::make_shared<VolumeBricked>(createBrickSource(src), VolumeBricked::defaultBrickSize,
+                                           VolumeBricked::defaultMemoryBudget,
+                                           src.getSwizzleMask(), src.getInterpolation(),
+                                           src.getWrapping());
+}
+
+RawVolumeBrickSource::RawVolumeBrickSource(const std::filesystem::path& rawFile, size_t offset,
+                                           size3_t dimensions, const DataFormatBase* format,
+                                           bool littleEndian)
+    : rawFile_{rawFile}
+    , offset_{offset}
+    , dimensions_{dimensions}
+    , format_{format}
+    , littleEndian_{littleEndian} {}
+
+size3_t RawVolumeBrickSource::getDimensions() const { return dimensions_; }
+
+const DataFormatBase* RawVolumeBrickSource::getDataFormat() const { return format_; }
+
+void RawVolumeBrickSource::read(size3_t offset, size3_t extent, void* dest) const {
+    std::ifstream fin(rawFile_, std::ios::in | std::ios::binary);
+    if (!fin.good()) {
+        throw DataReaderException(IVW_CONTEXT, "Could not open file: {}", rawFile_);
+    }
+
+    // Read the brick in as few contiguous runs as possible
+    const size3_t run{extent.x, extent.x == dimensions_.x ? extent.y : 1,
+                      extent.x == dimensions_.x && extent.y == dimensions_.y ? extent.z : 1};
+    const auto elementSize = format_->getSizeInBytes();
+    const auto runBytes = glm::compMul(run) * elementSize;
+    const util::IndexMapper3D im{dimensions_};
+
+    auto* out = static_cast<char*>(dest);
+    for (size_t z = 0; z < extent.z; z += run.z) {
+        for (size_t y = 0; y < extent.y; y += run.y) {
+            const auto pos = offset + size3_t{0, y, z};
+            fin.seekg(static_cast<std::streamoff>(offset_ + im(pos) * elementSize));
+            fin.read(out, static_cast<std::streamsize>(runBytes));
+            out += runBytes;
+        }
+    }
+    if (!fin) {
+        throw DataReaderException(IVW_CONTEXT, "Could not read brick at {} of size {} from: {}",
+                                  offset, extent, rawFile_);
+    }
+
+    if (!littleEndian_ && elementSize > 1) {
+        util::swapEndianInPlace(dest, glm::compMul(extent) * elementSize, elementSize);
+    }
+}
+
 }  // namespace inviwo
@@ -49,7 +49,9 @@ RawVolumeReader::RawVolumeReader()
     , spacing_(0.01f)
     , format_(nullptr)
     , byteOffset_(0u)
-    , parametersSet_(false) {
+    , parametersSet_(false)
+    , memoryMap_(false)
+    , bricked_(false) {
     addExtension(FileExtension("raw", "Raw binary file"));
 }
 
@@ -61,7 +63,9 @@ RawVolumeReader::RawVolumeReader(const RawVolumeReader& rhs)
     , spacing_(rhs.spacing_)
     , format_(rhs.format_)
     , byteOffset_(rhs.byteOffset_)
-    , parametersSet_(false) {}
+    , parametersSet_(false)
+    , memoryMap_(rhs.memoryMap_)
+    , bricked_(rhs.bricked_) {}
 
 RawVolumeReader& RawVolumeReader::operator=(const RawVolumeReader& that) {
     if (this != &that) {
@@ -72,6 +76,8 @@ RawVolumeReader& RawVolumeReader::operator=(const RawVolumeReader& that) {
         format_ = that.format_;
         dataMapper_ = that.dataMapper_;
         byteOffset_ = that.byteOffset_;
+        memoryMap_ = that.memoryMap_;
+        bricked_ = that.bricked_;
         DataReaderType<Volume>::operator=(that);
     }
 
@@ -90,6 +96,26 @@ void RawVolumeReader::setParameters(const DataFormatBase* format, ivec3 dimensio
     byteOffset_ = byteOffset;
 }
 
+bool RawVolumeReader::setOption(std::string_view key, std::any value) {
+    if (auto* memoryMap = std::any_cast<bool>(&value); memoryMap && key == "MemoryMap") {
+        memoryMap_ = *memoryMap;
+        return true;
+    } else if (auto* bricked = std::any_cast<bool>(&value); bricked && key == "Bricked") {
+        bricked_ = *bricked;
+        return true;
+    }
+    return false;
+}
+
+std::any RawVolumeReader::getOption(std::string_view key) {
+    if (key == "MemoryMap") {
+        return memoryMap_;
+    } else if (key == "Bricked") {
+        return bricked_;
+    }
+    return std::any{};
+}
+
 std::shared_ptr<Volume> RawVolumeReader::readData(const std::filesystem::path& filePath) {
     return readData(filePath, nullptr);
 }
@@ -180,7 +206,11 @@ std::shared_ptr<Volume> RawVolumeReader::readData(const std::filesystem::path& f
         volume->setOffset(offset);
         volume->setWorldMatrix(wtm);
         auto vd = std::make_shared<VolumeDisk>(filePath, dimensions_, format_);
-        auto loader = std::make_unique<RawVolumeRAMLoader>(rawFile_, byteOffset_, littleEndian_);
+        auto loader = std::make_unique<RawVolumeRAMLoader>(rawFile_, byteOffset_, littleEndian_,
+                                                           memoryMap_);
+        if (bricked_) {
+            volume->addRepresentation(loader->createBricked(*vd));
+        }
         vd->setLoader(loader.release());
         volume->addRepresentation(vd);
 
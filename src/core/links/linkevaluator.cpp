@@ -33,6 +33,7 @@
 #include <inviwo/core/properties/propertyconverter.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/tracerecorder.h>
 #include <inviwo/core/properties/property.h>
 #include <inviwo/core/processors/processor.h>
 #include <inviwo/core/network/processornetwork.h>
@@ -212,6 +213,7 @@ void LinkEvaluator::evaluateLinksFromProperty(Property* modifiedProperty) {
 
     const NetworkLock lock(network_);
 
+    IVW_TRACE_SCOPE("link", modifiedProperty->getIdentifier());
     auto& links = getTriggeredLinksForProperty(modifiedProperty);
     const VisitedHelper helper(visited_, links);
 
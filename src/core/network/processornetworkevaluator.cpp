@@ -35,15 +35,51 @@
 #include <inviwo/core/network/networkutils.h>
 #include <inviwo/core/network/networklock.h>
 #include <inviwo/core/util/clock.h>
+#include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/tracerecorder.h>
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace inviwo {
 
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+double toMilliseconds(clock_type::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // namespace
+
+EvaluationSample& EvaluationSample::operator+=(const EvaluationSample& rhs) {
+    process += rhs.process;
+    onChange += rhs.onChange;
+    initializeResources += rhs.initializeResources;
+    invalid += rhs.invalid;
+    return *this;
+}
+
 ProcessorNetworkEvaluator::ProcessorNetworkEvaluator(ProcessorNetwork* processorNetwork)
     : processorNetwork_(processorNetwork)
     , processorsSorted_(util::topologicalSortFiltered(processorNetwork_))
+    , successors_{}
+    , predecessorCount_{}
     , needsSorting_(true)
     , evaluationQueued_(false)
-    , exceptionHandler_(StandardEvaluationErrorHandler()) {
+    , evaluationMode_(EvaluationMode::Serial)
+    , exceptionHandler_(StandardEvaluationErrorHandler())
+    , metricsEnabled_(true)
+    , metricsHistorySize_(100)
+    , metrics_{}
+    , pending_{}
+    , invalidSince_{} {
 
     processorNetwork_->addObserver(this);
 }
@@ -52,6 +88,46 @@ void ProcessorNetworkEvaluator::setExceptionHandler(EvaluationErrorHandler handl
     exceptionHandler_ = handler;
 }
 
+void ProcessorNetworkEvaluator::setEvaluationMode(EvaluationMode mode) {
+    evaluationMode_ = mode;
+}
+
+EvaluationMode ProcessorNetworkEvaluator::getEvaluationMode() const { return evaluationMode_; }
+
+void ProcessorNetworkEvaluator::setMetricsEnabled(bool enabled) {
+    metricsEnabled_ = enabled;
+    if (!metricsEnabled_) {
+        pending_.clear();
+        std::scoped_lock lock{invalidSinceMutex_};
+        invalidSince_.clear();
+    }
+}
+
+bool ProcessorNetworkEvaluator::getMetricsEnabled() const { return metricsEnabled_; }
+
+void ProcessorNetworkEvaluator::setMetricsHistorySize(size_t size) {
+    metricsHistorySize_ = size;
+    for (auto& [processor, metrics] : metrics_) {
+        while (metrics.history.size() > metricsHistorySize_) metrics.history.pop_front();
+    }
+}
+
+size_t ProcessorNetworkEvaluator::getMetricsHistorySize() const { return metricsHistorySize_; }
+
+const ProcessorMetrics* ProcessorNetworkEvaluator::getMetrics(const Processor* processor) const {
+    if (auto it = metrics_.find(processor); it != metrics_.end()) {
+        return &it->second;
+    }
+    return nullptr;
+}
+
+const std::unordered_map<const Processor*, ProcessorMetrics>&
+ProcessorNetworkEvaluator::getMetrics() const {
+    return metrics_;
+}
+
+void ProcessorNetworkEvaluator::clearMetrics() { metrics_.clear(); }
+
 void ProcessorNetworkEvaluator::onProcessorNetworkEvaluateRequest() {
     // Direct request, thus we don't want to queue the evaluation anymore
     evaluationQueued_ = false;
@@ -100,65 +176,275 @@ void ProcessorNetworkEvaluator::evaluate() {
 
     if (needsSorting_) {
         processorsSorted_ = util::topologicalSortFiltered(processorNetwork_);
+        updateDependencies();
         needsSorting_ = false;
     }
 
     notifyObserversProcessorNetworkEvaluationBegin();
 
     IVW_CPU_PROFILING_IF(500, "Evaluated Processor Network");
+    IVW_TRACE_SCOPE("network", "Evaluate");
+
+    if (evaluationMode_ == EvaluationMode::Concurrent) {
+        evaluateConcurrent();
+    } else {
+        evaluateSerial();
+    }
+
+    notifyObserversProcessorNetworkEvaluationEnd();
+}
+
+bool ProcessorNetworkEvaluator::beforeProcess(Processor* processor) {
+    if (!processor->isReady()) {
+        if (metricsEnabled_) ++metrics_[processor].skippedNotReady;
+        try {
+            processor->doIfNotReady();
+        } catch (...) {
+            exceptionHandler_(processor, EvaluationType::NotReady, IVW_CONTEXT);
+        }
+        return false;
+    }
+
+    EvaluationSample sample;
+    try {
+        // re-initialize resources (e.g., shaders) if necessary
+        if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
+            IVW_TRACE_SCOPE("initializeResources", processor->getIdentifier());
+            const auto start = clock_type::now();
+            processor->initializeResources();
+            sample.initializeResources = toMilliseconds(clock_type::now() - start);
+        }
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::InitResource, IVW_CONTEXT);
+        return false;
+    }
+
+    try {
+        // call onChange for all invalid inports
+        const auto start = clock_type::now();
+        for (auto inport : processor->getInports()) {
+            inport->callOnChangeIfChanged();
+        }
+        sample.onChange = toMilliseconds(clock_type::now() - start);
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::PortOnChange, IVW_CONTEXT);
+        return false;
+    }
+
+    if (metricsEnabled_) pending_[processor] = sample;
+    processor->notifyObserversAboutToProcess(processor);
+    return true;
+}
+
+void ProcessorNetworkEvaluator::afterProcess(Processor* processor,
+                                             std::chrono::nanoseconds processTime) {
+    // Set processor as valid only if we still are ready.
+    // Callbacks might have made our inports invalid, if so abort
+    // the evaluation by not setting the processor valid.
+    if (processor->isReady()) processor->setValid();
+
+    if (!metricsEnabled_) return;
+
+    EvaluationSample sample;
+    if (auto node = pending_.extract(processor)) sample = node.mapped();
+    sample.process = toMilliseconds(processTime);
+    if (processor->isValid()) {
+        std::scoped_lock lock{invalidSinceMutex_};
+        if (auto node = invalidSince_.extract(processor)) {
+            sample.invalid = toMilliseconds(clock_type::now() - node.mapped());
+        }
+    }
+    recordMetrics(processor, sample);
+}
 
+void ProcessorNetworkEvaluator::recordMetrics(Processor* processor, EvaluationSample sample) {
+    auto& metrics = metrics_[processor];
+    ++metrics.evaluations;
+    metrics.total += sample;
+    if (metricsHistorySize_ == 0) return;
+    if (metrics.history.size() == metricsHistorySize_) metrics.history.pop_front();
+    metrics.history.push_back(sample);
+}
+
+void ProcessorNetworkEvaluator::evaluateSerial() {
     for (auto processor : processorsSorted_) {
-        if (!processor->isValid()) {
-            if (processor->isReady()) {
-                try {
-                    // re-initialize resources (e.g., shaders) if necessary
-                    if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
-                        processor->initializeResources();
-                    }
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::InitResource, IVW_CONTEXT);
-                    continue;
-                }
+        if (processor->isValid() || !beforeProcess(processor)) continue;
+
+        try {
+            IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
+            IVW_TRACE_SCOPE("process", processor->getIdentifier());
+            // do the actual processing
+            const auto start = clock_type::now();
+            processor->process();
+            afterProcess(processor, clock_type::now() - start);
+        } catch (...) {
+            pending_.erase(processor);
+            exceptionHandler_(processor, EvaluationType::Process, IVW_CONTEXT);
+        }
 
-                try {
-                    // call onChange for all invalid inports
-                    for (auto inport : processor->getInports()) {
-                        inport->callOnChangeIfChanged();
-                    }
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::PortOnChange, IVW_CONTEXT);
-                    continue;
-                }
+        processor->notifyObserversFinishedProcess(processor);
+    }
+}
+
+void ProcessorNetworkEvaluator::evaluateConcurrent() {
+    auto& pool = util::getThreadPool(processorNetwork_->getApplication());
+    if (pool.getSize() == 0) {
+        evaluateSerial();
+        return;
+    }
 
-                processor->notifyObserversAboutToProcess(processor);
+    // Processors finished on the pool, handed back to the main thread for setValid and
+    // notifications
+    struct Item {
+        size_t index;
+        std::exception_ptr error;
+        std::chrono::nanoseconds processTime;
+    };
+    struct {
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::vector<Item> items;
+        size_t outstanding = 0;  // Tasks dispatched to the pool that have not yet finished
+    } finished;
+
+    // The pool tasks reference the local state above. If an exception escapes, for example one
+    // rethrown by the exception handler, wait for the outstanding tasks before unwinding.
+    util::OnScopeExit waitForOutstanding{[&finished]() {
+        std::unique_lock lock{finished.mutex};
+        finished.condition.wait(lock, [&]() { return finished.outstanding == 0; });
+    }};
+
+    std::vector<size_t> remaining = predecessorCount_;
+    std::deque<size_t> ready;
+    std::deque<size_t> readyMainThread;
+    for (size_t i = 0; i < remaining.size(); ++i) {
+        if (remaining[i] == 0) ready.push_back(i);
+    }
 
+    size_t done = 0;
+    size_t running = 0;
+    const auto complete = [&](size_t i) {
+        ++done;
+        for (auto successor : successors_[i]) {
+            if (--remaining[successor] == 0) ready.push_back(successor);
+        }
+    };
+
+    const auto finish = [&](std::vector<Item>& items) {
+        for (auto& [i, error, processTime] : items) {
+            --running;
+            auto processor = processorsSorted_[i];
+            try {
+                if (error) std::rethrow_exception(error);
+                afterProcess(processor, processTime);
+            } catch (...) {
+                pending_.erase(processor);
+                exceptionHandler_(processor, EvaluationType::Process, IVW_CONTEXT);
+            }
+            processor->notifyObserversFinishedProcess(processor);
+            complete(i);
+        }
+        items.clear();
+    };
+
+    std::vector<Item> items;
+    while (done < processorsSorted_.size()) {
+        // Dispatch everything that can run on the pool first, to overlap it with main thread work
+        while (!ready.empty()) {
+            const auto i = ready.front();
+            ready.pop_front();
+            auto processor = processorsSorted_[i];
+
+            if (processor->isValid()) {
+                complete(i);
+            } else if (processor->isMainThreadBound()) {
+                readyMainThread.push_back(i);
+            } else if (!beforeProcess(processor)) {
+                complete(i);
+            } else {
+                ++running;
+                {
+                    std::scoped_lock lock{finished.mutex};
+                    ++finished.outstanding;
+                }
+                pool.enqueueRaw([processor, i, &finished]() {
+                    std::exception_ptr error;
+                    const auto start = clock_type::now();
+                    try {
+                        IVW_CPU_PROFILING_IF_CUSTOM(500, "ProcessorNetworkEvaluator",
+                                                    "Processed " << processor->getIdentifier());
+                        IVW_TRACE_SCOPE("process", processor->getIdentifier());
+                        processor->process();
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                    const std::chrono::nanoseconds processTime = clock_type::now() - start;
+                    // notify while holding the lock, the main thread might return as soon as it
+                    // has seen the last item
+                    std::scoped_lock lock{finished.mutex};
+                    finished.items.push_back(Item{i, error, processTime});
+                    --finished.outstanding;
+                    finished.condition.notify_all();
+                });
+            }
+        }
+
+        if (!readyMainThread.empty()) {
+            const auto i = readyMainThread.front();
+            readyMainThread.pop_front();
+            auto processor = processorsSorted_[i];
+            if (beforeProcess(processor)) {
                 try {
                     IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
-                    // do the actual processing
+                    IVW_TRACE_SCOPE("process", processor->getIdentifier());
+                    const auto start = clock_type::now();
                     processor->process();
-
-                    // Set processor as valid only if we still are ready.
-                    // Callbacks might have made our inports invalid, if so abort
-                    // the evaluation by not setting the processor valid.
-                    if (processor->isReady()) processor->setValid();
-
+                    afterProcess(processor, clock_type::now() - start);
                 } catch (...) {
+                    pending_.erase(processor);
                     exceptionHandler_(processor, EvaluationType::Process, IVW_CONTEXT);
                 }
-
                 processor->notifyObserversFinishedProcess(processor);
+            }
+            complete(i);
+
+            std::unique_lock lock{finished.mutex};
+            std::swap(items, finished.items);
+        } else if (running > 0) {
+            std::unique_lock lock{finished.mutex};
+            finished.condition.wait(lock, [&]() { return !finished.items.empty(); });
+            std::swap(items, finished.items);
+        } else {
+            break;
+        }
+        finish(items);
+    }
+}
 
-            } else {
-                try {
-                    processor->doIfNotReady();
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::NotReady, IVW_CONTEXT);
+void ProcessorNetworkEvaluator::updateDependencies() {
+    std::unordered_map<Processor*, size_t> indices;
+    for (size_t i = 0; i < processorsSorted_.size(); ++i) {
+        indices[processorsSorted_[i]] = i;
+    }
+
+    successors_.assign(processorsSorted_.size(), {});
+    predecessorCount_.assign(processorsSorted_.size(), 0);
+    for (size_t i = 0; i < processorsSorted_.size(); ++i) {
+        auto processor = processorsSorted_[i];
+        std::unordered_set<size_t> predecessors;
+        for (auto inport : processor->getInports()) {
+            for (auto outport : inport->getConnectedOutports()) {
+                if (!processor->isConnectionActive(inport, outport)) continue;
+                if (auto it = indices.find(outport->getProcessor()); it != indices.end()) {
+                    predecessors.insert(it->second);
                 }
             }
         }
+        predecessorCount_[i] = predecessors.size();
+        for (auto predecessor : predecessors) {
+            successors_[predecessor].push_back(i);
+        }
     }
-
-    notifyObserversProcessorNetworkEvaluationEnd();
 }
 
 void ProcessorNetworkEvaluator::onProcessorSinkChanged(Processor*) { needsSorting_ = true; }
@@ -167,6 +453,13 @@ void ProcessorNetworkEvaluator::onProcessorActiveConnectionsChanged(Processor*)
     needsSorting_ = true;
 }
 
+void ProcessorNetworkEvaluator::onProcessorInvalidationEnd(Processor* p) {
+    if (metricsEnabled_ && !p->isValid()) {
+        std::scoped_lock lock{invalidSinceMutex_};
+        invalidSince_.try_emplace(p, clock_type::now());
+    }
+}
+
 void ProcessorNetworkEvaluator::onProcessorNetworkDidAddProcessor(Processor* p) {
     p->ProcessorObservable::addObserver(this);
     needsSorting_ = true;
@@ -174,6 +467,12 @@ void ProcessorNetworkEvaluator::onProcessorNetworkDidAddProcessor(Processor* p)
 
 void ProcessorNetworkEvaluator::onProcessorNetworkDidRemoveProcessor(Processor* p) {
     p->ProcessorObservable::removeObserver(this);
+    metrics_.erase(p);
+    pending_.erase(p);
+    {
+        std::scoped_lock lock{invalidSinceMutex_};
+        invalidSince_.erase(p);
+    }
     needsSorting_ = true;
 }
 
@@ -210,4 +210,11 @@ bool Inport::circularConnection(const Port* port) const {
     return pd.find(getProcessor()) != pd.end();
 }
 
+bool detail::canBecomeReady(const Inport& inport) {
+    const auto* processor = inport.getProcessor();
+    return processor && util::all_of(processor->getInports(), [](const Inport* port) {
+               return port->isOptional() || port->isConnected();
+           });
+}
+
 }  // namespace inviwo
@@ -319,6 +319,8 @@ bool Processor::isReady() const { return isReady_.get(); }
 
 const ProcessorStatus& Processor::status() const { return isReady_.get(); }
 
+bool Processor::isMainThreadBound() const { return true; }
+
 bool Processor::allInportsAreReady() const {
     return util::all_of(inports_, [](Inport* p) { return p->isReady() || p->isOptional(); });
 }
@@ -86,6 +86,7 @@ std::shared_ptr<Processor> ProcessorFactory::createShared(std::string_view key)
 };
 std::shared_ptr<Processor> ProcessorFactory::createShared(std::string_view key,
                                                           InviwoApplication* app) const {
+    registerDeferred();
     auto it = this->map_.find(key);
     if (it != end(this->map_)) {
         return it->second->create(app);
@@ -94,6 +95,25 @@ std::shared_ptr<Processor> ProcessorFactory::createShared(std::string_view key,
     }
 };
 
-bool ProcessorFactory::hasKey(std::string_view key) const { return Register::hasKey(key); }
+bool ProcessorFactory::hasKey(std::string_view key) const {
+    registerDeferred();
+    return Register::hasKey(key);
+}
+
+std::vector<std::string> ProcessorFactory::getKeys() const {
+    registerDeferred();
+    return Register::getKeys();
+}
+
+ProcessorFactoryObject* ProcessorFactory::getFactoryObject(std::string_view key) const {
+    registerDeferred();
+    return Register::getFactoryObject(key);
+}
+
+DispatcherHandle<void()> ProcessorFactory::deferRegistration(std::function<void()> registration) {
+    return deferredRegistrations_.add(std::move(registration));
+}
+
+void ProcessorFactory::registerDeferred() const { deferredRegistrations_.invoke(); }
 
 }  // namespace inviwo
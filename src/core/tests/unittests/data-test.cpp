@@ -0,0 +1,123 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/volumeramutils.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <numeric>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size3_t dims{10, 7, 5};
+
+// Creates a RAM representation with increasing values and counts how often it is called
+class CountingLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+public:
+    explicit CountingLoader(std::shared_ptr<std::atomic<int>> loads) : loads_{std::move(loads)} {}
+
+    virtual CountingLoader* clone() const override { return new CountingLoader(*this); }
+
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override {
+        ++*loads_;
+        auto ram = std::make_shared<VolumeRAMPrecision<std::uint16_t>>(src.getDimensions());
+        std::iota(ram->getDataTyped(), ram->getDataTyped() + glm::compMul(src.getDimensions()),
+                  std::uint16_t{0});
+        return ram;
+    }
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation>,
+                                      const VolumeRepresentation&) const override {
+        ++*loads_;
+    }
+
+private:
+    std::shared_ptr<std::atomic<int>> loads_;
+};
+
+std::shared_ptr<Volume> createDiskVolume(std::shared_ptr<std::atomic<int>> loads) {
+    auto disk = std::make_shared<VolumeDisk>(dims, DataUInt16::get());
+    disk->setLoader(new CountingLoader(std::move(loads)));
+    return std::make_shared<Volume>(disk);
+}
+
+}  // namespace
+
+TEST(Data, RequestRepresentation) {
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    const auto volume = createDiskVolume(loads);
+    EXPECT_FALSE(volume->hasValidRepresentation<VolumeRAM>());
+
+    auto request = volume->requestRepresentation<VolumeRAM>();
+    const auto ram = request.get();
+    ASSERT_NE(ram, nullptr);
+    EXPECT_EQ(ram.get(), volume->getRepresentation<VolumeRAM>());
+    EXPECT_TRUE(volume->hasValidRepresentation<VolumeRAM>());
+    EXPECT_EQ(1, *loads);
+
+    const util::IndexMapper3D im{dims};
+    util::forEachVoxel(dims, [&](const size3_t& pos) {
+        EXPECT_EQ(ram->getAsDouble(pos), static_cast<double>(im(pos)));
+    });
+
+    // A valid representation is returned right away
+    auto again = volume->requestRepresentation<VolumeRAM>();
+    EXPECT_EQ(again.wait_for(std::chrono::seconds{0}), std::future_status::ready);
+    EXPECT_EQ(again.get(), ram);
+    EXPECT_EQ(1, *loads);
+}
+
+TEST(Data, GetRepresentationDuringRequest) {
+    auto loads = std::make_shared<std::atomic<int>>(0);
+    const auto volume = createDiskVolume(loads);
+
+    // Whichever runs first converts, the other one uses the result
+    auto request = volume->requestRepresentation<VolumeRAM>();
+    const auto* ram = volume->getRepresentation<VolumeRAM>();
+    EXPECT_EQ(ram, request.get().get());
+    EXPECT_EQ(1, *loads);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,197 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/histogram.h>
+#include <inviwo/core/datastructures/histogramtools.h>
+#include <inviwo/core/util/raiiutils.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+bool sameBits(double a, double b) {
+    return std::bit_cast<std::uint64_t>(a) == std::bit_cast<std::uint64_t>(b);
+}
+
+std::vector<float> testData(size_t size) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-10.0f, 110.0f);
+    std::vector<float> data(size);
+    for (auto& v : data) v = dist(gen);
+
+    data[17] = std::numeric_limits<float>::quiet_NaN();
+    data[size / 2] = std::numeric_limits<float>::quiet_NaN();
+    data[size / 3] = std::numeric_limits<float>::infinity();
+    data[size - 5] = -std::numeric_limits<float>::infinity();
+    return data;
+}
+
+}  // namespace
+
+TEST(Histogram, ParallelMatchesSerial) {
+    // Large enough to be split into several chunks
+    const auto data = testData((size_t{1} << 22) + 123);
+    const DataMapper dataMap{dvec2{0.0, 100.0}};
+    const size_t bins = 100;
+
+    auto* app = InviwoApplication::getPtr();
+    const auto poolSize = app->getPoolSize();
+    util::OnScopeExit restore{[&]() { app->resizePool(poolSize); }};
+
+    app->resizePool(4);
+    ASSERT_GT(app->getPoolSize(), 0);
+    const auto parallel = util::calculateHistograms(std::span<const float>{data}, dataMap, bins);
+    app->resizePool(0);
+    ASSERT_EQ(app->getPoolSize(), 0);
+    const auto serial = util::calculateHistograms(std::span<const float>{data}, dataMap, bins);
+
+    ASSERT_EQ(parallel.size(), 1);
+    ASSERT_EQ(serial.size(), 1);
+    const auto& p = parallel.front();
+    const auto& s = serial.front();
+
+    EXPECT_EQ(p.counts, s.counts);
+    EXPECT_EQ(p.totalCounts, s.totalCounts);
+    EXPECT_EQ(p.maxCount, s.maxCount);
+    EXPECT_EQ(p.underflow, s.underflow);
+    EXPECT_EQ(p.overflow, s.overflow);
+    EXPECT_TRUE(sameBits(p.dataStats.min, s.dataStats.min));
+    EXPECT_TRUE(sameBits(p.dataStats.max, s.dataStats.max));
+    EXPECT_TRUE(sameBits(p.dataStats.mean, s.dataStats.mean));
+    EXPECT_TRUE(sameBits(p.dataStats.standardDeviation, s.dataStats.standardDeviation));
+    ASSERT_EQ(p.dataStats.percentiles.size(), s.dataStats.percentiles.size());
+    for (size_t i = 0; i < p.dataStats.percentiles.size(); ++i) {
+        EXPECT_TRUE(sameBits(p.dataStats.percentiles[i], s.dataStats.percentiles[i]));
+    }
+
+    // Compare with a straightforward calculation, NaN is ignored and infinities end up in the
+    // under- and overflow
+    std::vector<size_t> counts(bins, 0);
+    size_t underflow = 0;
+    size_t overflow = 0;
+    double min = std::numeric_limits<double>::max();
+    double max = std::numeric_limits<double>::lowest();
+    for (const auto v : data) {
+        if (std::isnan(v)) continue;
+        min = std::min(min, static_cast<double>(v));
+        max = std::max(max, static_cast<double>(v));
+        const auto pos = static_cast<double>(v) * (static_cast<double>(bins - 1) / 100.0);
+        if (pos <= -1.0) {
+            ++underflow;
+        } else if (pos < static_cast<double>(bins)) {
+            ++counts[static_cast<size_t>(pos)];
+        } else {
+            ++overflow;
+        }
+    }
+    EXPECT_EQ(p.counts, counts);
+    EXPECT_EQ(p.underflow, underflow);
+    EXPECT_EQ(p.overflow, overflow);
+    EXPECT_EQ(p.totalCounts, data.size());
+    EXPECT_EQ(p.dataStats.min, -std::numeric_limits<double>::infinity());
+    EXPECT_EQ(p.dataStats.max, std::numeric_limits<double>::infinity());
+    EXPECT_EQ(p.dataStats.min, min);
+    EXPECT_EQ(p.dataStats.max, max);
+    EXPECT_TRUE(std::isnan(p.dataStats.mean));
+}
+
+TEST(Histogram, ProgressiveStrides) {
+    EXPECT_EQ(util::progressiveHistogramStrides(1000, 1000), std::vector<size_t>{1});
+    EXPECT_EQ(util::progressiveHistogramStrides(7000, 1000), (std::vector<size_t>{7, 1}));
+    EXPECT_EQ(util::progressiveHistogramStrides(6999, 1000), std::vector<size_t>{1});
+    EXPECT_EQ(util::progressiveHistogramStrides(49 * 1000 + 1, 1000),
+              (std::vector<size_t>{49, 7, 1}));
+}
+
+TEST(Histogram, Stride) {
+    const auto data = testData(10000);
+    const DataMapper dataMap{dvec2{0.0, 100.0}};
+    const auto histograms =
+        util::calculateHistograms(std::span<const float>{data}, dataMap, 100, 7);
+    ASSERT_EQ(histograms.size(), 1);
+    EXPECT_EQ(histograms.front().totalCounts, (data.size() + 6) / 7);
+    EXPECT_DOUBLE_EQ(histograms.front().coverage,
+                     static_cast<double>((data.size() + 6) / 7) / data.size());
+}
+
+TEST(HistogramCache, ProgressiveCallbacks) {
+    const std::vector<size_t> strides{49, 7, 1};
+
+    std::mutex mutex;
+    std::vector<size_t> calculated;
+    const auto calculate = [&](size_t stride) {
+        {
+            const std::scoped_lock lock{mutex};
+            calculated.push_back(stride);
+        }
+        Histogram1D histogram;
+        histogram.coverage = 1.0 / static_cast<double>(stride);
+        return std::vector<Histogram1D>{histogram};
+    };
+
+    HistogramCache cache;
+    std::vector<double> published;
+    const auto first = cache.calculateHistograms(
+        calculate, strides,
+        [&](const std::vector<Histogram1D>& h) { published.push_back(h.front().coverage); });
+    EXPECT_EQ(first.progress, HistogramCache::Progress::Calculating);
+
+    // Run all the passes and the callbacks they dispatch to the main thread
+    util::waitForPool();
+
+    EXPECT_EQ(calculated, strides);
+    EXPECT_EQ(published, (std::vector<double>{1.0 / 49.0, 1.0 / 7.0, 1.0}));
+
+    // The exact histograms are cached and published right away
+    std::vector<double> cached;
+    const auto second = cache.calculateHistograms(
+        calculate, strides,
+        [&](const std::vector<Histogram1D>& h) { cached.push_back(h.front().coverage); });
+    EXPECT_EQ(second.progress, HistogramCache::Progress::Done);
+    EXPECT_EQ(cached, std::vector<double>{1.0});
+    EXPECT_EQ(calculated.size(), strides.size());
+}
+
+}  // namespace inviwo
@@ -0,0 +1,149 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/io/bytereaderutil.h>
+#include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/exception.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <numeric>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+template <typename T>
+util::TempFileHandle writeTestFile(const std::vector<T>& data) {
+    util::TempFileHandle file("", ".raw");
+    std::fwrite(data.data(), sizeof(T), data.size(), file.getHandle());
+    std::fflush(file.getHandle());
+    return file;
+}
+
+}  // namespace
+
+TEST(MemoryMappedFile, Map) {
+    std::vector<std::uint8_t> data(10000);
+    std::iota(data.begin(), data.end(), std::uint8_t{0});
+    const auto tmpFile = writeTestFile(data);
+    const auto& path = tmpFile.getFileName();
+
+    {
+        const MemoryMappedFile file(path);
+        ASSERT_EQ(file.size(), data.size());
+        EXPECT_EQ(std::memcmp(file.data(), data.data(), data.size()), 0);
+    }
+    {
+        // offsets that are not page aligned
+        MemoryMappedFile file(path, 4099, 100);
+        ASSERT_EQ(file.size(), 100);
+        EXPECT_EQ(std::memcmp(file.data(), data.data() + 4099, 100), 0);
+
+        // private mapping, changes are not written to the file
+        static_cast<std::uint8_t*>(file.data())[0] = 42;
+        const MemoryMappedFile other(path, 4099, 100);
+        EXPECT_EQ(static_cast<const std::uint8_t*>(other.data())[0], data[4099]);
+    }
+
+    EXPECT_THROW(MemoryMappedFile(path, 9000, 2000), FileException);
+    // a FileException, not a filesystem_error, so callers can fall back to reading the file
+    EXPECT_THROW(MemoryMappedFile(std::filesystem::path{path}.replace_extension(".missing")),
+                 FileException);
+}
+
+TEST(MemoryMappedFile, SwapEndian) {
+    std::array<std::uint16_t, 3> u16{0x0102, 0x0304, 0x0506};
+    util::swapEndianInPlace(u16.data(), sizeof(u16), 2);
+    EXPECT_EQ(u16, (std::array<std::uint16_t, 3>{0x0201, 0x0403, 0x0605}));
+
+    std::array<std::uint32_t, 2> u32{0x01020304, 0x05060708};
+    util::swapEndianInPlace(u32.data(), sizeof(u32), 4);
+    EXPECT_EQ(u32, (std::array<std::uint32_t, 2>{0x04030201, 0x08070605}));
+
+    std::array<std::uint64_t, 1> u64{0x0102030405060708};
+    util::swapEndianInPlace(u64.data(), sizeof(u64), 8);
+    EXPECT_EQ(u64[0], 0x0807060504030201);
+
+    std::array<std::uint8_t, 6> u24{1, 2, 3, 4, 5, 6};
+    util::swapEndianInPlace(u24.data(), sizeof(u24), 3);
+    EXPECT_EQ(u24, (std::array<std::uint8_t, 6>{3, 2, 1, 6, 5, 4}));
+}
+
+TEST(MemoryMappedFile, RawVolumeRAMLoader) {
+    const size3_t dims{16, 8, 4};
+    const size_t offset = 64;
+    std::vector<std::uint16_t> data(offset / sizeof(std::uint16_t) + glm::compMul(dims));
+    std::iota(data.begin(), data.end(), std::uint16_t{0});
+    const auto tmpFile = writeTestFile(data);
+
+    const VolumeDisk disk(tmpFile.getFileName(), dims, DataUInt16::get());
+    const bool littleEndian = std::endian::native == std::endian::little;
+    for (const bool memoryMap : {false, true}) {
+        const RawVolumeRAMLoader loader(tmpFile.getFileName(), offset, littleEndian, memoryMap);
+        auto repr = loader.createRepresentation(disk);
+        auto ram = std::dynamic_pointer_cast<VolumeRAMPrecision<std::uint16_t>>(repr);
+        ASSERT_TRUE(ram) << "memoryMap: " << memoryMap;
+        ASSERT_EQ(ram->getDimensions(), dims);
+        EXPECT_EQ(std::memcmp(ram->getDataTyped(), data.data() + offset / sizeof(std::uint16_t),
+                              glm::compMul(dims) * sizeof(std::uint16_t)),
+                  0)
+            << "memoryMap: " << memoryMap;
+
+        // modifications are never written back to the file
+        ram->getDataTyped()[0] = 4242;
+        const MemoryMappedFile file(tmpFile.getFileName(), offset, sizeof(std::uint16_t));
+        EXPECT_EQ(*static_cast<const std::uint16_t*>(file.data()), data[offset / 2]);
+
+        // copies own their data, independent of the mapping
+        auto copy = std::shared_ptr<VolumeRAM>(ram->clone());
+        ram.reset();
+        repr.reset();
+        EXPECT_EQ(static_cast<const std::uint16_t*>(copy->getData())[0], 4242);
+        EXPECT_EQ(static_cast<const std::uint16_t*>(copy->getData())[1], data[offset / 2 + 1]);
+    }
+}
+
+}  // namespace inviwo
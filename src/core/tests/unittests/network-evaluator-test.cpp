@@ -38,11 +38,14 @@
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/network/processornetworkevaluator.h>
 #include <inviwo/core/network/networklock.h>
+#include <inviwo/core/util/raiiutils.h>
 
 #include <inviwo/core/ports/datainport.h>
 #include <inviwo/core/ports/dataoutport.h>
 
 #include <functional>
+#include <atomic>
+#include <thread>
 
 namespace inviwo {
 
@@ -64,7 +67,9 @@ struct TestProcessor : Processor {
     virtual void doIfNotReady() override {
         if (onDoIfNotReady) onDoIfNotReady(*this);
     }
+    virtual bool isMainThreadBound() const override { return mainThreadBound; }
 
+    bool mainThreadBound = true;
     std::function<void(TestProcessor&)> onInitializeResources;
     std::function<void(TestProcessor&)> onProcess;
     std::function<void(TestProcessor&)> onDoIfNotReady;
@@ -256,4 +261,151 @@ TEST(NetworkEvaluator, Error) {
     }
 }
 
+TEST(NetworkEvaluator, Concurrent) {
+    // Without any pool threads the tasks would run inline on the main thread
+    auto* app = InviwoApplication::getPtr();
+    const auto poolSize = app->getPoolSize();
+    util::OnScopeExit restore{[&]() { app->resizePool(poolSize); }};
+    app->resizePool(4);
+    ASSERT_GT(app->getPoolSize(), 0);
+
+    const auto mainThread = std::this_thread::get_id();
+
+    ProcessorNetwork network{app};
+    ProcessorNetworkEvaluator evaluator{&network};
+    evaluator.setEvaluationMode(EvaluationMode::Concurrent);
+    EXPECT_EQ(evaluator.getEvaluationMode(), EvaluationMode::Concurrent);
+
+    std::atomic<int> order{0};
+    int aOrder = -1;
+
+    auto at = createA();
+    auto a = at.get();
+    Instrument ai(*a);
+    std::thread::id aThread;
+    a->onProcess = [func = a->onProcess, &order, &aOrder, &aThread](TestProcessor& p) {
+        func(p);
+        aOrder = order++;
+        aThread = std::this_thread::get_id();
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(0));
+    };
+
+    // b and c opt in to being processed on the pool, a stays on the main thread
+    auto bt = createB();
+    auto b = bt.get();
+    b->mainThreadBound = false;
+    Instrument bi(*b);
+    int bOrder = -1;
+    std::thread::id bThread;
+    b->onProcess = [func = b->onProcess, &order, &bOrder, &bThread](TestProcessor& p) {
+        func(p);
+        bOrder = order++;
+        bThread = std::this_thread::get_id();
+    };
+
+    auto ct = createB();
+    ct->setIdentifier("c");
+    auto c = ct.get();
+    c->mainThreadBound = false;
+    Instrument ci(*c);
+    int cOrder = -1;
+    std::thread::id cThread;
+    c->onProcess = [func = c->onProcess, &order, &cOrder, &cThread](TestProcessor& p) {
+        func(p);
+        cOrder = order++;
+        cThread = std::this_thread::get_id();
+    };
+
+    {
+        SCOPED_TRACE("Add processors");
+        NetworkLock lock(&network);
+        network.addProcessor(std::move(at));
+        network.addProcessor(std::move(bt));
+        network.addProcessor(std::move(ct));
+        network.addConnection(a->getOutports()[0], b->getInports()[0]);
+        network.addConnection(a->getOutports()[0], c->getInports()[0]);
+    }
+    ai.checkAndReset(1, 1, 0);
+    bi.checkAndReset(1, 1, 0);
+    ci.checkAndReset(1, 1, 0);
+    EXPECT_LT(aOrder, bOrder);
+    EXPECT_LT(aOrder, cOrder);
+    EXPECT_EQ(aThread, mainThread);
+    EXPECT_NE(bThread, mainThread);
+    EXPECT_NE(cThread, mainThread);
+    EXPECT_TRUE(a->isValid());
+    EXPECT_TRUE(b->isValid());
+    EXPECT_TRUE(c->isValid());
+
+    {
+        SCOPED_TRACE("Invalid output");
+        a->invalidate(InvalidationLevel::InvalidOutput);
+        ai.checkAndReset(0, 1, 0);
+        bi.checkAndReset(0, 1, 0);
+        ci.checkAndReset(0, 1, 0);
+        EXPECT_LT(aOrder, bOrder);
+        EXPECT_LT(aOrder, cOrder);
+        EXPECT_EQ(aThread, mainThread);
+        EXPECT_NE(bThread, mainThread);
+        EXPECT_NE(cThread, mainThread);
+    }
+}
+
+TEST(NetworkEvaluator, Metrics) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+    evaluator.setMetricsHistorySize(2);
+
+    auto at = createA();
+    auto a = at.get();
+    a->onProcess = [](TestProcessor& p) {
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(0));
+    };
+    auto bt = createB();
+    auto b = bt.get();
+
+    network.addProcessor(std::move(at));
+    network.addProcessor(std::move(bt));
+    {
+        SCOPED_TRACE("Not ready");
+        const auto* metrics = evaluator.getMetrics(b);
+        ASSERT_NE(metrics, nullptr);
+        EXPECT_EQ(metrics->evaluations, 0u);
+        EXPECT_EQ(metrics->skippedNotReady, 1u);
+        EXPECT_TRUE(metrics->history.empty());
+    }
+
+    network.addConnection(a->getOutports()[0], b->getInports()[0]);
+    a->invalidate(InvalidationLevel::InvalidOutput);
+    a->invalidate(InvalidationLevel::InvalidOutput);
+    {
+        SCOPED_TRACE("Evaluated");
+        const auto* metrics = evaluator.getMetrics(a);
+        ASSERT_NE(metrics, nullptr);
+        EXPECT_EQ(metrics->evaluations, 3u);
+        EXPECT_EQ(metrics->skippedNotReady, 0u);
+        ASSERT_EQ(metrics->history.size(), 2u);
+        EXPECT_GE(metrics->history.back().process, 0.0);
+        EXPECT_GE(metrics->history.back().invalid, metrics->history.back().process);
+        EXPECT_GE(metrics->total.process, metrics->history.back().process);
+        EXPECT_EQ(evaluator.getMetrics().size(), 2u);
+    }
+    {
+        SCOPED_TRACE("Cleared");
+        evaluator.clearMetrics();
+        EXPECT_EQ(evaluator.getMetrics(a), nullptr);
+        evaluator.setMetricsEnabled(false);
+        a->invalidate(InvalidationLevel::InvalidOutput);
+        EXPECT_EQ(evaluator.getMetrics(a), nullptr);
+    }
+    {
+        SCOPED_TRACE("Removed");
+        evaluator.setMetricsEnabled(true);
+        a->invalidate(InvalidationLevel::InvalidOutput);
+        EXPECT_NE(evaluator.getMetrics(b), nullptr);
+        network.removeProcessor(b);
+        EXPECT_EQ(evaluator.getMetrics(b), nullptr);
+    }
+}
+
 }  // namespace inviwo
@@ -41,6 +41,10 @@
 
 #include <inviwo/core/ports/datainport.h>
 #include <inviwo/core/ports/dataoutport.h>
+#include <inviwo/core/ports/volumeport.h>
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/util/zip.h>
 
 #include <inviwo/testutil/zipmatcher.h>
@@ -158,6 +162,70 @@ const ProcessorInfo FlatMultiInportTestProcessor::processorInfo_{
 
 #include <warn/pop>
 
+class ZeroVolumeLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+public:
+    virtual ZeroVolumeLoader* clone() const override { return new ZeroVolumeLoader(*this); }
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override {
+        return std::make_shared<VolumeRAMPrecision<float>>(src.getDimensions());
+    }
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation>,
+                                      const VolumeRepresentation&) const override {}
+};
+
+struct VolumeOutportTestProcessor : Processor {
+    VolumeOutportTestProcessor(std::string_view id) : Processor(id, id), outport{"outport"} {
+        addPort(outport);
+        auto disk = std::make_shared<VolumeDisk>(size3_t{8, 8, 8}, DataFloat32::get());
+        disk->setLoader(new ZeroVolumeLoader());
+        volume = std::make_shared<Volume>(disk);
+    }
+
+    virtual const ProcessorInfo getProcessorInfo() const override { return processorInfo_; }
+
+    static const ProcessorInfo processorInfo_;
+
+    virtual void process() override { outport.setData(volume); }
+
+    VolumeOutport outport;
+    std::shared_ptr<Volume> volume;
+};
+
+const ProcessorInfo VolumeOutportTestProcessor::processorInfo_{
+    "org.inviwo.VolumeOutportTestProcessor",  // Class identifier
+    "VolumeOutportTestProcessor",             // Display name
+    "Testing",                                // Category
+    CodeState::Stable,                        // Code state
+    Tags::CPU,                                // Tags
+};
+
+// Hints VolumeRAM but never asks for it, any RAM representation is created by the hint
+struct VolumeHintTestProcessor : Processor {
+    VolumeHintTestProcessor(std::string_view id, bool otherOptional)
+        : Processor(id, id), inport{"inport"}, other{"other"} {
+        addPorts(inport, other);
+        inport.addRepresentationHint<VolumeRAM>();
+        other.setOptional(otherOptional);
+    }
+
+    virtual const ProcessorInfo getProcessorInfo() const override { return processorInfo_; }
+
+    static const ProcessorInfo processorInfo_;
+
+    virtual void process() override {}
+
+    VolumeInport inport;
+    DataInport<int> other;
+};
+
+const ProcessorInfo VolumeHintTestProcessor::processorInfo_{
+    "org.inviwo.VolumeHintTestProcessor",  // Class identifier
+    "VolumeHintTestProcessor",             // Display name
+    "Testing",                             // Category
+    CodeState::Stable,                     // Code state
+    Tags::CPU,                             // Tags
+};
+
 }  // namespace
 
 using ::testing::ElementsAre;
@@ -365,4 +433,27 @@ TEST(PortTests, FlatMultiInportOutport) {
     EXPECT_FALSE(sink.inport.isChanged());
 }
 
+TEST(PortTests, RepresentationHint) {
+    auto* app = InviwoApplication::getPtr();
+    ProcessorNetwork network{app};
+    ProcessorNetworkEvaluator evaluator{&network};
+
+    network.lock();
+    auto& source1 = *network.emplaceProcessor<VolumeOutportTestProcessor>("source1");
+    auto& source2 = *network.emplaceProcessor<VolumeOutportTestProcessor>("source2");
+    auto& sink = *network.emplaceProcessor<VolumeHintTestProcessor>("sink", true);
+    // This sink is missing a required connection and will not be processed
+    auto& inactive = *network.emplaceProcessor<VolumeHintTestProcessor>("inactive", false);
+    network.addConnection(&source1.outport, &sink.inport);
+    network.addConnection(&source2.outport, &inactive.inport);
+    network.unlock();
+
+    app->waitForPool();
+
+    EXPECT_TRUE(sink.isValid());
+    EXPECT_TRUE(source1.volume->hasValidRepresentation<VolumeRAM>());
+    EXPECT_FALSE(inactive.isValid());
+    EXPECT_FALSE(source2.volume->hasRepresentation<VolumeRAM>());
+}
+
 }  // namespace inviwo
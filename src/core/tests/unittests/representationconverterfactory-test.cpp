@@ -0,0 +1,142 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/representationconverter.h>
+#include <inviwo/core/datastructures/representationconverterfactory.h>
+
+#include <chrono>
+#include <memory>
+
+namespace inviwo {
+
+namespace {
+
+struct TestRepr {
+    virtual ~TestRepr() = default;
+};
+struct ReprA : TestRepr {};
+struct ReprB : TestRepr {};
+struct ReprC : TestRepr {};
+
+template <typename From, typename To>
+class TestConverter : public RepresentationConverterType<TestRepr, From, To> {
+public:
+    explicit TestConverter(ConversionCost cost) : cost_{cost} {}
+
+    virtual std::shared_ptr<To> createFrom(std::shared_ptr<const From>) const override {
+        return std::make_shared<To>();
+    }
+    virtual void update(std::shared_ptr<const From>, std::shared_ptr<To>) const override {}
+    virtual ConversionCost getCost() const override { return cost_; }
+
+private:
+    ConversionCost cost_;
+};
+
+}  // namespace
+
+TEST(RepresentationConverterFactory, CheapestPathIsUsed) {
+    TestConverter<ReprA, ReprC> direct{ConversionCost::transfer()};
+    TestConverter<ReprA, ReprB> first{ConversionCost::copy()};
+    TestConverter<ReprB, ReprC> second{ConversionCost::copy()};
+
+    RepresentationConverterFactory<TestRepr> factory;
+    factory.registerObject(&direct);
+    factory.registerObject(&first);
+    factory.registerObject(&second);
+
+    const auto* package = factory.getRepresentationConverter(typeid(ReprA), typeid(ReprC));
+    ASSERT_NE(package, nullptr);
+    EXPECT_EQ(package->steps(), 2);
+    EXPECT_DOUBLE_EQ(package->cost(), 2.0 * ConversionCost::copy().total());
+
+    // The package is cached
+    EXPECT_EQ(package, factory.getRepresentationConverter(typeid(ReprA), typeid(ReprC)));
+
+    // Removing a converter removes the packages using it
+    factory.unRegisterObject(&second);
+    package = factory.getRepresentationConverter(typeid(ReprA), typeid(ReprC));
+    ASSERT_NE(package, nullptr);
+    EXPECT_EQ(package->steps(), 1);
+    EXPECT_DOUBLE_EQ(package->cost(), ConversionCost::transfer().total());
+}
+
+TEST(RepresentationConverterFactory, FewestStepsOnEqualCost) {
+    TestConverter<ReprA, ReprC> direct{ConversionCost::copy()};
+    TestConverter<ReprA, ReprB> first{ConversionCost::shared()};
+    TestConverter<ReprB, ReprC> second{ConversionCost::copy()};
+
+    RepresentationConverterFactory<TestRepr> factory;
+    factory.registerObject(&direct);
+    factory.registerObject(&first);
+    factory.registerObject(&second);
+
+    const auto* package = factory.getRepresentationConverter(typeid(ReprA), typeid(ReprC));
+    ASSERT_NE(package, nullptr);
+    EXPECT_EQ(package->steps(), 1);
+}
+
+TEST(RepresentationConverterFactory, NoPath) {
+    TestConverter<ReprA, ReprB> first{ConversionCost::copy()};
+
+    RepresentationConverterFactory<TestRepr> factory;
+    factory.registerObject(&first);
+
+    EXPECT_EQ(factory.getRepresentationConverter(typeid(ReprB), typeid(ReprA)), nullptr);
+    EXPECT_EQ(factory.getRepresentationConverter(typeid(ReprA), typeid(ReprC)), nullptr);
+}
+
+TEST(RepresentationConverterFactory, Statistics) {
+    TestConverter<ReprA, ReprB> first{ConversionCost::copy()};
+    const auto id = first.getConverterID();
+
+    RepresentationConverterFactory<TestRepr> factory;
+    factory.registerObject(&first);
+
+    using namespace std::chrono_literals;
+    factory.addStatistics(id, true, 100, 5ms);
+    factory.addStatistics(id, false, 50, 2ms);
+
+    auto stats = factory.getStatistics();
+    ASSERT_EQ(stats.count(id), 1);
+    EXPECT_EQ(stats[id].created, 1);
+    EXPECT_EQ(stats[id].updated, 1);
+    EXPECT_EQ(stats[id].bytes, 150);
+    EXPECT_EQ(stats[id].time, 7ms);
+
+    factory.resetStatistics();
+    EXPECT_TRUE(factory.getStatistics().empty());
+}
+
+}  // namespace inviwo
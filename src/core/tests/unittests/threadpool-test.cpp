@@ -0,0 +1,127 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/threadpool.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+TEST(ThreadPool, Enqueue) {
+    ThreadPool pool(4);
+
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 1000; ++i) {
+        futures.push_back(pool.enqueue([](int x) { return 2 * x; }, i));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(futures[i].get(), 2 * i);
+    }
+
+    const std::string large(100, 'a');
+    auto future = pool.enqueue([large]() { return large.size(); });
+    EXPECT_EQ(future.get(), 100);
+}
+
+TEST(ThreadPool, Exception) {
+    ThreadPool pool(2);
+    auto future = pool.enqueue([]() -> int { throw std::runtime_error("error"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(ThreadPool, NestedTasks) {
+    ThreadPool pool(2);
+
+    std::vector<std::future<int>> outer;
+    for (int i = 0; i < 16; ++i) {
+        outer.push_back(pool.enqueue([&pool]() {
+            std::vector<std::future<int>> inner;
+            for (int j = 0; j < 16; ++j) {
+                inner.push_back(pool.enqueue([j]() { return j; }));
+            }
+            int sum = 0;
+            for (auto& f : inner) {
+                pool.wait(f);
+                sum += f.get();
+            }
+            return sum;
+        }));
+    }
+    for (auto& f : outer) {
+        EXPECT_EQ(f.get(), 15 * 16 / 2);
+    }
+}
+
+TEST(ThreadPool, Resize) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.getSize(), 4);
+
+    while (pool.trySetSize(1) != 1) std::this_thread::yield();
+    EXPECT_EQ(pool.enqueue([]() { return 1; }).get(), 1);
+
+    while (pool.trySetSize(0) != 0) std::this_thread::yield();
+    std::atomic<int> count{0};
+    pool.enqueueRaw([&count]() { ++count; });
+    EXPECT_EQ(count, 1);
+
+    EXPECT_EQ(pool.trySetSize(3), 3);
+    EXPECT_EQ(pool.enqueue([]() { return 3; }).get(), 3);
+}
+
+TEST(ThreadPool, QueueSize) {
+    ThreadPool pool(4);
+    constexpr size_t tasks = 10000;
+    for (size_t i = 0; i < tasks; ++i) {
+        pool.enqueueRaw([]() {});
+        EXPECT_LE(pool.getQueueSize(), i + 1);
+    }
+    while (pool.trySetSize(0) != 0) std::this_thread::yield();
+    EXPECT_EQ(pool.getQueueSize(), 0);
+}
+
+TEST(ThreadPool, ShrinkToZeroRunsQueuedTasks) {
+    ThreadPool pool(4);
+    std::atomic<int> count{0};
+    for (int i = 0; i < 1000; ++i) {
+        pool.enqueueRaw([&count]() { ++count; });
+    }
+    while (pool.trySetSize(0) != 0) std::this_thread::yield();
+    EXPECT_EQ(count, 1000);
+    EXPECT_EQ(pool.getQueueSize(), 0);
+}
+
+}  // namespace inviwo
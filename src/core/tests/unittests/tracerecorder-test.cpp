@@ -0,0 +1,130 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/tracerecorder.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+std::vector<TraceEvent> eventsNamed(const std::string& threadName) {
+    for (auto& thread : TraceRecorder::instance().getEvents()) {
+        if (thread.name == threadName) return thread.events;
+    }
+    return {};
+}
+
+}  // namespace
+
+TEST(TraceRecorder, DisabledRecordsNothing) {
+    auto& recorder = TraceRecorder::instance();
+    recorder.setEnabled(false);
+    std::thread{[]() {
+        TraceRecorder::instance().setThreadName("disabled");
+        IVW_TRACE_SCOPE("test", "scope");
+    }}.join();
+    EXPECT_TRUE(eventsNamed("disabled").empty());
+    recorder.clear();
+}
+
+TEST(TraceRecorder, RecordScopes) {
+    auto& recorder = TraceRecorder::instance();
+    recorder.setEnabled(true);
+    std::thread{[]() {
+        TraceRecorder::instance().setThreadName("record");
+        IVW_TRACE_SCOPE("test", "outer");
+        { IVW_TRACE_SCOPE("test", std::string(100, 'x')); }
+    }}.join();
+    recorder.setEnabled(false);
+
+    const auto events = eventsNamed("record");
+    ASSERT_EQ(events.size(), 2);
+    // Inner scopes finish first
+    EXPECT_EQ(events[0].getName(), std::string(TraceEvent::maxNameLength, 'x'));
+    EXPECT_EQ(events[1].getName(), "outer");
+    EXPECT_STREQ(events[1].category, "test");
+    EXPECT_LE(events[1].start, events[0].start);
+    EXPECT_GE(events[1].duration, events[0].duration);
+    recorder.clear();
+}
+
+TEST(TraceRecorder, RingBufferKeepsLatest) {
+    auto& recorder = TraceRecorder::instance();
+    const auto capacity = recorder.getCapacity();
+    recorder.setCapacity(8);
+    recorder.setEnabled(true);
+    std::thread{[]() {
+        TraceRecorder::instance().setThreadName("ring");
+        const auto now = TraceRecorder::clock::now();
+        for (int i = 0; i < 20; ++i) {
+            TraceRecorder::instance().record("test", std::to_string(i), now, now);
+        }
+    }}.join();
+    recorder.setEnabled(false);
+    recorder.setCapacity(capacity);
+
+    const auto events = eventsNamed("ring");
+    ASSERT_EQ(events.size(), 8);
+    for (size_t i = 0; i < events.size(); ++i) {
+        EXPECT_EQ(events[i].getName(), std::to_string(12 + i));
+    }
+    recorder.clear();
+    EXPECT_TRUE(eventsNamed("ring").empty());
+}
+
+TEST(TraceRecorder, ExportChromeTrace) {
+    auto& recorder = TraceRecorder::instance();
+    recorder.setEnabled(true);
+    std::thread{[]() {
+        TraceRecorder::instance().setThreadName("export");
+        IVW_TRACE_SCOPE("test", "a \"quoted\" name");
+    }}.join();
+    recorder.setEnabled(false);
+
+    std::stringstream ss;
+    recorder.exportChromeTrace(ss);
+    const auto json = ss.str();
+    EXPECT_NE(json.find(R"("traceEvents":[)"), std::string::npos);
+    EXPECT_NE(json.find(R"("args":{"name":"export"})"), std::string::npos);
+    EXPECT_NE(json.find(R"({"name":"a \"quoted\" name","cat":"test","ph":"X")"), std::string::npos);
+    recorder.clear();
+}
+
+}  // namespace inviwo
@@ -0,0 +1,204 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/io/rawvolumereader.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/volumeramutils.h>
+#include <inviwo/core/util/volumesampler.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size3_t dims{10, 7, 5};
+
+util::TempFileHandle writeTestVolume() {
+    std::vector<std::uint16_t> data(glm::compMul(dims));
+    std::iota(data.begin(), data.end(), std::uint16_t{0});
+
+    util::TempFileHandle file("", ".raw");
+    std::fwrite(data.data(), sizeof(std::uint16_t), data.size(), file.getHandle());
+    std::fflush(file.getHandle());
+    return file;
+}
+
+}  // namespace
+
+TEST(VolumeBricked, Bricks) {
+    const auto tmpFile = writeTestVolume();
+    const auto& path = tmpFile.getFileName();
+    auto source =
+        std::make_shared<RawVolumeBrickSource>(path, 0, dims, DataUInt16::get(), true);
+    const VolumeBricked bricked{source, size3_t{4, 4, 4}};
+
+    EXPECT_EQ(bricked.getDimensions(), dims);
+    EXPECT_EQ(bricked.getNumberOfBricks(), size3_t(3, 2, 2));
+    EXPECT_EQ(bricked.getBrickExtent(size3_t(2, 1, 1)), size3_t(2, 3, 1));
+
+    const util::IndexMapper3D im{dims};
+    util::forEachVoxel(dims, [&](const size3_t& pos) {
+        EXPECT_EQ(bricked.getAsDouble(pos), static_cast<double>(im(pos)));
+    });
+
+    const auto stats = bricked.getCacheStats();
+    EXPECT_EQ(stats.misses, size_t{12});
+    EXPECT_EQ(stats.evictions, size_t{0});
+}
+
+TEST(VolumeBricked, MemoryBudget) {
+    const auto tmpFile = writeTestVolume();
+    const auto& path = tmpFile.getFileName();
+    auto source =
+        std::make_shared<RawVolumeBrickSource>(path, 0, dims, DataUInt16::get(), true);
+    const size_t brickBytes = 4 * 4 * 4 * sizeof(std::uint16_t);
+    VolumeBricked bricked{source, size3_t{4, 4, 4}, 2 * brickBytes};
+
+    const util::IndexMapper3D im{dims};
+    size_t count = 0;
+    util::forEachVoxel(bricked, [&](const size3_t& pos) {
+        EXPECT_EQ(bricked.getAsDouble(pos), static_cast<double>(im(pos)));
+        EXPECT_LE(bricked.getResidentBytes(), 2 * brickBytes);
+        ++count;
+    });
+    EXPECT_EQ(count, glm::compMul(dims));
+
+    const auto stats = bricked.getCacheStats();
+    EXPECT_EQ(stats.misses, size_t{12});
+    EXPECT_GT(stats.evictions, size_t{0});
+
+    bricked.setMemoryBudget(0);
+    EXPECT_LE(bricked.getResidentBytes(), brickBytes);
+    bricked.clearCache();
+    EXPECT_EQ(bricked.getResidentBytes(), size_t{0});
+}
+
+TEST(VolumeBricked, Cursor) {
+    const auto tmpFile = writeTestVolume();
+    auto source = std::make_shared<RawVolumeBrickSource>(tmpFile.getFileName(), 0, dims,
+                                                         DataUInt16::get(), true);
+    const VolumeBricked bricked{source, size3_t{4, 4, 4}};
+
+    const util::IndexMapper3D im{dims};
+    VolumeBricked::Cursor cursor{bricked};
+    util::forEachVoxel(dims, [&](const size3_t& pos) {
+        const auto [brick, local] = cursor.locate(pos);
+        ASSERT_NE(brick, nullptr);
+        EXPECT_EQ(brick->getAsDouble(local), static_cast<double>(im(pos)));
+    });
+
+    // Each brick is loaded once, and the volume is only queried when the cursor changes brick
+    const auto stats = bricked.getCacheStats();
+    EXPECT_EQ(stats.misses, size_t{12});
+    EXPECT_LT(stats.hits + stats.misses, glm::compMul(dims));
+}
+
+TEST(VolumeBricked, Sampler) {
+    const auto tmpFile = writeTestVolume();
+    auto source = std::make_shared<RawVolumeBrickSource>(tmpFile.getFileName(), 0, dims,
+                                                         DataUInt16::get(), true);
+    const Volume bricked{std::make_shared<VolumeBricked>(source, size3_t{4, 4, 4})};
+    auto ramRepr = std::make_shared<VolumeRAMPrecision<std::uint16_t>>(dims);
+    std::iota(ramRepr->getDataTyped(), ramRepr->getDataTyped() + glm::compMul(dims),
+              std::uint16_t{0});
+    const Volume ram{ramRepr};
+
+    const VolumeSampler<dvec4> brickedSampler{bricked};
+    const VolumeSampler<dvec4> ramSampler{ram};
+
+    std::vector<dvec3> positions;
+    for (double z = 0.0; z <= 1.0; z += 0.13) {
+        for (double y = 0.0; y <= 1.0; y += 0.11) {
+            for (double x = 0.0; x <= 1.0; x += 0.07) {
+                positions.emplace_back(x, y, z);
+            }
+        }
+    }
+    std::vector<dvec4> brickedResult(positions.size());
+    std::vector<dvec4> ramResult(positions.size());
+    brickedSampler.sample(positions, brickedResult);
+    ramSampler.sample(positions, ramResult);
+
+    for (size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_EQ(brickedResult[i], ramResult[i]) << "at " << i;
+        EXPECT_EQ(brickedSampler.sample(positions[i]), ramResult[i]) << "at " << i;
+    }
+}
+
+TEST(VolumeBricked, ReaderOption) {
+    const auto tmpFile = writeTestVolume();
+
+    RawVolumeReader reader;
+    reader.setParameters(DataUInt16::get(), ivec3{dims}, true, DataMapper{DataUInt16::get()});
+    EXPECT_FALSE(std::any_cast<bool>(reader.getOption("Bricked")));
+    EXPECT_TRUE(reader.setOption("Bricked", true));
+    EXPECT_TRUE(std::any_cast<bool>(reader.getOption("Bricked")));
+
+    const auto volume = reader.readData(tmpFile.getFileName());
+    ASSERT_TRUE(volume->hasRepresentation<VolumeBricked>());
+    EXPECT_FALSE(volume->hasRepresentation<VolumeRAM>());
+
+    const auto* bricked = volume->getRepresentation<VolumeBricked>();
+    const util::IndexMapper3D im{dims};
+    util::forEachVoxel(*bricked, [&](const size3_t& pos) {
+        EXPECT_EQ(bricked->getAsDouble(pos), static_cast<double>(im(pos)));
+    });
+}
+
+TEST(VolumeBricked, ConvertToRAM) {
+    const auto tmpFile = writeTestVolume();
+    const auto& path = tmpFile.getFileName();
+    auto source =
+        std::make_shared<RawVolumeBrickSource>(path, 0, dims, DataUInt16::get(), true);
+    const Volume volume{std::make_shared<VolumeBricked>(source, size3_t{4, 4, 4})};
+
+    const auto* ram = volume.getRepresentation<VolumeRAM>();
+    ASSERT_NE(ram, nullptr);
+    const auto* bricked = volume.getRepresentation<VolumeBricked>();
+    util::forEachVoxel(dims, [&](const size3_t& pos) {
+        EXPECT_EQ(ram->getAsDouble(pos), bricked->getAsDouble(pos));
+    });
+}
+
+}  // namespace inviwo
@@ -0,0 +1,114 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/templatesampler.h>
+#include <inviwo/core/util/volumesampler.h>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+std::shared_ptr<Volume> createVolume() {
+    const size3_t dims{7, 5, 4};
+    auto ram = std::make_shared<VolumeRAMPrecision<vec3>>(dims);
+    auto data = ram->getDataTyped();
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        data[i] = vec3{static_cast<float>(i), static_cast<float>(i % 7) * 0.5f,
+                       -static_cast<float>(i % 3)};
+    }
+    auto volume = std::make_shared<Volume>(ram);
+    volume->setBasis(mat3{2.0f, 0.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 0.0f, 1.5f});
+    volume->setOffset(vec3{-1.0f, 0.5f, 0.0f});
+    return volume;
+}
+
+std::vector<dvec3> randomPositions(const dvec3& min, const dvec3& max, size_t count) {
+    std::mt19937 gen{42};
+    std::uniform_real_distribution<double> dist{0.0, 1.0};
+    std::vector<dvec3> positions(count);
+    for (auto& p : positions) {
+        p = min + dvec3{dist(gen), dist(gen), dist(gen)} * (max - min);
+    }
+    return positions;
+}
+
+template <typename Sampler>
+void expectBatchMatches(const Sampler& sampler, const std::vector<dvec3>& positions,
+                        CoordinateSpace space) {
+    using ReturnType = typename Sampler::type;
+    std::vector<ReturnType> result(positions.size());
+    sampler.sample(positions, result, space);
+    for (size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_EQ(sampler.sample(positions[i], space), result[i]) << "position " << i;
+    }
+}
+
+}  // namespace
+
+TEST(VolumeSampler, BatchDataSpace) {
+    const auto volume = createVolume();
+    // includes positions outside of the volume
+    const auto positions = randomPositions(dvec3{-0.1}, dvec3{1.1}, 200);
+
+    expectBatchMatches(VolumeSampler<dvec3>{volume}, positions, CoordinateSpace::Data);
+    expectBatchMatches(VolumeSampler<dvec4>{volume}, positions, CoordinateSpace::Data);
+    expectBatchMatches(VolumeSampler<double>{volume}, positions, CoordinateSpace::Data);
+    expectBatchMatches(TemplateVolumeSampler<dvec3, vec3>{volume}, positions,
+                       CoordinateSpace::Data);
+}
+
+TEST(VolumeSampler, BatchWorldSpace) {
+    const auto volume = createVolume();
+    const auto positions = randomPositions(dvec3{-1.5, 0.0, -0.5}, dvec3{1.5, 4.0, 2.0}, 200);
+
+    const VolumeSampler<dvec3> sampler{volume, CoordinateSpace::World};
+    std::vector<dvec3> result(positions.size());
+    sampler.sample(positions, result);
+    for (size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_EQ(sampler.sample(positions[i]), result[i]) << "position " << i;
+    }
+
+    expectBatchMatches(VolumeSampler<dvec3>{volume}, positions, CoordinateSpace::World);
+    expectBatchMatches(TemplateVolumeSampler<dvec3, vec3>{volume}, positions,
+                       CoordinateSpace::World);
+}
+
+}  // namespace inviwo
@@ -62,6 +62,10 @@ CommandLineParser::CommandLineParser(int argc, char** argv)
     , workspace_("w", "workspace", "Specify workspace to open", false, "", "workspace file")
     , outputPath_("o", "output", "Specify output path", false, "", "output path")
     , logfile_("l", "logfile", "Write log messages to file.", false, "", "logfile")
+    , traceFile_("", "trace",
+                 "Record processor evaluation, property linking, and thread pool tasks and write "
+                 "them to file in the Chrome trace event format on exit.",
+                 false, "", "trace file")
     , moduleSearchPaths_("m", "module-search-path", "Specify additional module search paths", false,
                          "module search path")
     , logConsole_("c", "logconsole", "Write log messages to console (cout)", false)
@@ -94,6 +98,7 @@ void CommandLineParser::parseInternal(std::vector<std::string> args, Mode mode)
     cmd.add(quitAfterStartup_);
     cmd.add(noSplashScreen_);
     cmd.add(logfile_);
+    cmd.add(traceFile_);
     cmd.add(moduleSearchPaths_);
     cmd.add(logConsole_);
     cmd.add(help_);
@@ -147,6 +152,11 @@ std::filesystem::path CommandLineParser::getLogToFileFileName() const {
         return {};
 }
 
+std::filesystem::path CommandLineParser::getTraceFileName() const {
+    if (traceFile_.isSet()) return traceFile_.getValue();
+    return {};
+}
+
 std::vector<std::filesystem::path> CommandLineParser::getModuleSearchPaths() const {
     if (moduleSearchPaths_.isSet()) {
         std::vector<std::filesystem::path> paths;
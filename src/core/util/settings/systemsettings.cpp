@@ -40,6 +40,11 @@ namespace inviwo {
 SystemSettings::SystemSettings(InviwoApplication* app)
     : Settings("System Settings", app)
     , poolSize_("poolSize", "Pool Size", defaultPoolSize(), 0, 32)
+    , concurrentEvaluation_{"concurrentEvaluation", "Concurrent Network Evaluation",
+                            "Process independent processors of the network concurrently on the "
+                            "thread pool. Only processors that are not main thread bound, i.e. "
+                            "pure CPU processors, are processed on the pool."_help,
+                            false}
     , enablePortInspectors_("enablePortInspectors", "Enable port inspectors", true)
     , portInspectorSize_("portInspectorSize", "Port inspector size", 128, 1, 1024)
 #if __APPLE__
@@ -80,11 +85,11 @@ SystemSettings::SystemSettings(InviwoApplication* app)
           "This does not work when console logging is enabled with --logconsole or -c"_help,
           false} {
 
-    addProperties(poolSize_, enablePortInspectors_, portInspectorSize_, enableTouchProperty_,
-                  enableGesturesProperty_, enablePickingProperty_, enableSoundProperty_,
-                  logStackTraceProperty_, moduleSearchPaths_, runtimeModuleReloading_,
-                  breakOnMessage_, breakOnException_, stackTraceInException_,
-                  enableResurceTracking_, redirectCout_, redirectCerr_);
+    addProperties(poolSize_, concurrentEvaluation_, enablePortInspectors_, portInspectorSize_,
+                  enableTouchProperty_, enableGesturesProperty_, enablePickingProperty_,
+                  enableSoundProperty_, logStackTraceProperty_, moduleSearchPaths_,
+                  runtimeModuleReloading_, breakOnMessage_, breakOnException_,
+                  stackTraceInException_, enableResurceTracking_, redirectCout_, redirectCerr_);
 
     logStackTraceProperty_.onChange(
         [this]() { LogCentral::getPtr()->setLogStacktrace(logStackTraceProperty_.get()); });
@@ -31,94 +31,258 @@
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/tracerecorder.h>
+
+#include <algorithm>
+#include <iterator>
 
 namespace inviwo {
 
 // the constructor just launches some amount of workers
 ThreadPool::ThreadPool(size_t threads, std::function<void()> onThreadStart,
                        std::function<void()> onThreadStop)
-    : onThreadStart_{std::move(onThreadStart)}, onThreadStop_{std::move(onThreadStop)} {
-    while (workers.size() < threads) {
-        workers.push_back(std::make_unique<Worker>(*this));
-    }
+    : pending{0}
+    , sleeping{0}
+    , next{0}
+    , onThreadStart_{std::move(onThreadStart)}
+    , onThreadStop_{std::move(onThreadStop)} {
+    trySetSize(threads);
 }
 
 size_t ThreadPool::trySetSize(size_t size) {
-    while (workers.size() < size) {
-        workers.push_back(std::make_unique<Worker>(*this));
-    }
-
-    if (workers.size() > size) {
-        auto active = workers.size();
-        for (auto& worker : workers) {
-            auto exprected = State::Free;
-            if (worker->state.compare_exchange_strong(exprected, State::Stop)) {
-                --active;
-            } else if (exprected == State::Stop || exprected == State::Done) {
-                --active;
-            }
-            if (active <= size) break;
+    {
+        std::unique_lock lock{workersMutex};
+        while (workers.size() < size) {
+            workers.push_back(std::make_unique<Worker>(*this));
         }
+    }
 
-        condition.notify_all();
+    std::vector<std::unique_ptr<Worker>> done;
+    {
+        std::unique_lock lock{workersMutex};
+        if (workers.size() > size) {
+            auto active = workers.size();
+            for (auto& worker : workers) {
+                auto exprected = State::Free;
+                if (worker->state.compare_exchange_strong(exprected, State::Stop)) {
+                    --active;
+                } else if (exprected == State::Stop || exprected == State::Done) {
+                    --active;
+                }
+                if (active <= size) break;
+            }
 
-        std::erase_if(workers, [](const std::unique_ptr<Worker>& worker) {
-            return worker->state == State::Done;
-        });
+            {
+                std::scoped_lock sleepLock{sleepMutex};
+                condition.notify_all();
+            }
+
+            for (auto& worker : workers) {
+                if (worker->state == State::Done) done.push_back(std::move(worker));
+            }
+            std::erase(workers, nullptr);
+        }
+    }
+    done.clear();  // this will join the stopped threads.
+
+    // Stopped workers hand over their remaining tasks to the shared queue, with no workers left
+    // nobody would run them, run them here instead.
+    std::deque<Task> orphaned;
+    {
+        std::shared_lock lock{workersMutex};
+        if (workers.empty()) {
+            std::scoped_lock queueLock{queueMutex};
+            std::swap(orphaned, tasks);
+        }
+    }
+    pending -= orphaned.size();
+    for (auto& task : orphaned) {
+        try {
+            task();
+        } catch (...) {  // Make sure we don't leak any exceptions.
+        }
     }
+
+    std::shared_lock lock{workersMutex};
     return workers.size();
 }
 
-size_t ThreadPool::getSize() const { return workers.size(); }
-
-size_t ThreadPool::getQueueSize() {
-    std::unique_lock<std::mutex> lock(queue_mutex);
-    return tasks.size();
+size_t ThreadPool::getSize() const {
+    std::shared_lock lock{workersMutex};
+    return workers.size();
 }
 
+size_t ThreadPool::getQueueSize() { return pending; }
+
 ThreadPool::~ThreadPool() {
-    for (auto& worker : workers) worker->state = State::Abort;
-    condition.notify_all();
-    workers.clear();  // this will join all threads.
+    std::vector<std::unique_ptr<Worker>> toJoin;
+    {
+        std::unique_lock lock{workersMutex};
+        for (auto& worker : workers) worker->state = State::Abort;
+        {
+            std::scoped_lock sleepLock{sleepMutex};
+            condition.notify_all();
+        }
+        toJoin = std::move(workers);
+        workers.clear();
+    }
+    toJoin.clear();  // this will join all threads.
 }
 
 ThreadPool::Worker::~Worker() { thread.join(); }
 
 ThreadPool::Worker::Worker(ThreadPool& pool)
-    : state{State::Free}, thread{[this, &pool]() {
-        util::setThreadDescription("Inviwo Worker Thread");
-        pool.onThreadStart_();
-        util::OnScopeExit cleanup{[&pool]() { pool.onThreadStop_(); }};
-
-        for (;;) {
-            std::function<void()> task;
-            state = State::Free;
-            {
-                std::unique_lock<std::mutex> lock(pool.queue_mutex);
-                pool.condition.wait(lock, [this, &pool] {
-                    return state == State::Abort || state == State::Stop || !pool.tasks.empty();
-                });
-                if (state == State::Abort || (state == State::Stop && pool.tasks.empty())) break;
-                task = std::move(pool.tasks.front());
-                pool.tasks.pop();
-            }
-            state = State::Working;
+    : pool{&pool}, state{State::Free}, thread{[this]() { this->pool->work(*this); }} {}
+
+ThreadPool::Worker*& ThreadPool::currentWorker() {
+    thread_local Worker* worker = nullptr;
+    return worker;
+}
+
+void ThreadPool::work(Worker& self) {
+    util::setThreadDescription("Inviwo Worker Thread");
+    currentWorker() = &self;
+    onThreadStart_();
+    util::OnScopeExit cleanup{[this]() {
+        onThreadStop_();
+        currentWorker() = nullptr;
+    }};
+
+    for (;;) {
+        if (self.state == State::Abort) break;
+
+        if (auto task = pop(self)) {
+            auto expected = State::Free;
+            self.state.compare_exchange_strong(expected, State::Working);
             try {
+                IVW_TRACE_SCOPE("threadpool", "Task");
                 task();
             } catch (...) {  // Make sure we don't leak any exceptions.
             }
+            expected = State::Working;
+            self.state.compare_exchange_strong(expected, State::Free);
+            continue;
+        }
+
+        if (self.state == State::Stop) break;
+
+        std::unique_lock lock{sleepMutex};
+        ++sleeping;
+        condition.wait(lock, [&]() {
+            const auto state = self.state.load();
+            return pending > 0 || state == State::Stop || state == State::Abort;
+        });
+        --sleeping;
+    }
+
+    // Hand over any tasks that were given to this worker while it was stopping
+    bool handedOver = false;
+    {
+        std::scoped_lock lock{self.mutex, queueMutex};
+        self.closed = true;
+        handedOver = !self.tasks.empty();
+        std::move(self.tasks.begin(), self.tasks.end(), std::back_inserter(tasks));
+        self.tasks.clear();
+    }
+    if (handedOver && sleeping > 0) {
+        std::scoped_lock lock{sleepMutex};
+        condition.notify_one();
+    }
+
+    self.state = State::Done;
+}
+
+void ThreadPool::submit(Task task) {
+    {
+        std::shared_lock lock{workersMutex};
+        if (!workers.empty()) {
+            push(std::move(task));
+            return;
+        }
+    }
+    task();  // No worker threads, just run the task.
+}
+
+// Needs to be called with a shared lock on workersMutex held
+void ThreadPool::push(Task task) {
+    auto* worker = currentWorker();
+    if (!worker || worker->pool != this) {
+        worker = workers[next++ % workers.size()].get();
+    }
+
+    // Count the task before publishing it, otherwise a worker could pop it and decrement pending
+    // before the increment, making getQueueSize() wrap around.
+    ++pending;
+    {
+        std::scoped_lock lock{worker->mutex};
+        if (!worker->closed) {
+            worker->tasks.push_back(std::move(task));
+        }
+    }
+    if (task) {
+        std::scoped_lock lock{queueMutex};
+        tasks.push_back(std::move(task));
+    }
+
+    // Pairs with the increment of sleeping in work(), either we see the sleeping worker here, or
+    // the worker sees the pending task before going to sleep.
+    if (sleeping > 0) {
+        std::scoped_lock lock{sleepMutex};
+        condition.notify_one();
+    }
+}
+
+ThreadPool::Task ThreadPool::pop(Worker& self) {
+    if (pending == 0) return {};
+
+    Task task;
+    {
+        std::scoped_lock lock{self.mutex};
+        if (!self.tasks.empty()) {
+            task = std::move(self.tasks.front());
+            self.tasks.pop_front();
+        }
+    }
+    if (!task) {
+        std::scoped_lock lock{queueMutex};
+        if (!tasks.empty()) {
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+    }
+    if (!task) {
+        std::shared_lock lock{workersMutex};
+        const auto size = workers.size();
+        for (size_t i = 0; i < size && !task; ++i) {
+            auto& victim = *workers[(self.victim + i) % size];
+            if (&victim == &self) continue;
+            std::scoped_lock victimLock{victim.mutex};
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.back());
+                victim.tasks.pop_back();
+            }
         }
-        state = State::Done;
-    }} {}
+        ++self.victim;
+    }
+    if (task) --pending;
+    return task;
+}
+
+bool ThreadPool::runPendingTask() {
+    auto* worker = currentWorker();
+    if (!worker || worker->pool != this) return false;
 
-void ThreadPool::enqueueRaw(std::function<void()> task) {
-    if (workers.empty()) {
-        task();  // No worker threads, just run the task.
-    } else {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-        tasks.emplace(std::move(task));
+    if (auto task = pop(*worker)) {
+        try {
+            IVW_TRACE_SCOPE("threadpool", "Task (while waiting)");
+            task();
+        } catch (...) {  // Make sure we don't leak any exceptions.
+        }
+        return true;
     }
-    condition.notify_one();
+    return false;
 }
 
+void ThreadPool::enqueueRaw(std::function<void()> task) { submit(Task{std::move(task)}); }
+
 }  // namespace inviwo
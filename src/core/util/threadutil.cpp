@@ -29,6 +29,7 @@
 
 #include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/util/stringconversion.h>
+#include <inviwo/core/util/tracerecorder.h>
 #include <inviwo/core/common/inviwoapplication.h>
 
 #ifdef WIN32
@@ -42,6 +43,7 @@
 namespace inviwo {
 
 void util::setThreadDescription(const std::string& desc) {
+    TraceRecorder::instance().setThreadName(desc);
 #ifdef WIN32
     typedef HRESULT(WINAPI * SetThreadDescriptionFunc)(HANDLE hThread, PCWSTR threadDescription);
     // SetThreadDescription was introduced with Windows 10, version 1607
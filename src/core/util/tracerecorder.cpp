@@ -0,0 +1,231 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/util/tracerecorder.h>
+
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/sourcecontext.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <fstream>
+#include <iterator>
+#include <ostream>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+namespace inviwo {
+
+namespace {
+
+// Name of the calling thread, kept separately since it is usually set before any event is recorded
+std::string& threadName() {
+    thread_local std::string name;
+    return name;
+}
+
+void writeJsonString(std::ostream& os, std::string_view str) {
+    os << '"';
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    fmt::format_to(std::ostreambuf_iterator<char>(os), "\\u{:04x}", c);
+                } else {
+                    os << c;
+                }
+        }
+    }
+    os << '"';
+}
+
+}  // namespace
+
+struct TraceRecorder::Buffer {
+    // One extra slot for the event currently being written, so that all of the last 'capacity'
+    // events can be read consistently.
+    Buffer(size_t aId, std::string aName, size_t capacity)
+        : id{aId}, name{std::move(aName)}, events(capacity + 1) {}
+
+    const size_t id;
+    std::string name;  // Guarded by the recorder mutex
+    std::vector<TraceEvent> events;
+    std::atomic<size_t> head{0};  // Number of events recorded, only written by the owning thread
+    std::atomic<size_t> tail{0};  // First event not cleared
+};
+
+TraceRecorder& TraceRecorder::instance() {
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+TraceRecorder::TraceRecorder()
+    : enabled_{false}, capacity_{defaultCapacity}, epoch_{clock::now()}, mutex_{}, buffers_{} {}
+
+void TraceRecorder::setEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+void TraceRecorder::setCapacity(size_t eventsPerThread) {
+    capacity_.store(std::max(eventsPerThread, size_t{1}), std::memory_order_relaxed);
+}
+
+size_t TraceRecorder::getCapacity() const { return capacity_.load(std::memory_order_relaxed); }
+
+std::shared_ptr<TraceRecorder::Buffer>& TraceRecorder::localBuffer() {
+    // Shared with buffers_, so the events outlive the thread
+    thread_local std::shared_ptr<Buffer> buffer;
+    return buffer;
+}
+
+TraceRecorder::Buffer& TraceRecorder::threadBuffer() {
+    auto& buffer = localBuffer();
+    if (!buffer) {
+        std::scoped_lock lock{mutex_};
+        const auto id = buffers_.empty() ? size_t{0} : buffers_.back()->id + 1;
+        buffer = std::make_shared<Buffer>(id, threadName(), getCapacity());
+        buffers_.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void TraceRecorder::record(const char* category, std::string_view name, clock::time_point start,
+                           clock::time_point end) {
+    if (!isEnabled()) return;
+
+    auto& buffer = threadBuffer();
+    const auto head = buffer.head.load(std::memory_order_relaxed);
+    auto& event = buffer.events[head % buffer.events.size()];
+    event.category = category;
+    const auto size = std::min(name.size(), TraceEvent::maxNameLength);
+    std::copy_n(name.data(), size, event.name.data());
+    event.name[size] = '\0';
+    event.start = std::chrono::duration_cast<std::chrono::nanoseconds>(start - epoch_).count();
+    event.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void TraceRecorder::setThreadName(std::string_view name) {
+    threadName() = name;
+    if (auto& buffer = localBuffer()) {
+        std::scoped_lock lock{mutex_};
+        buffer->name = name;
+    }
+}
+
+std::vector<TraceRecorder::ThreadEvents> TraceRecorder::getEvents() const {
+    std::vector<ThreadEvents> result;
+    std::scoped_lock lock{mutex_};
+    for (const auto& buffer : buffers_) {
+        const auto slots = buffer->events.size();
+        const auto capacity = slots - 1;
+        const auto head = buffer->head.load(std::memory_order_acquire);
+        const auto first = std::max(buffer->tail.load(), head > capacity ? head - capacity : 0);
+
+        std::vector<TraceEvent> events;
+        events.reserve(head - first);
+        for (auto i = first; i < head; ++i) {
+            events.push_back(buffer->events[i % slots]);
+        }
+
+        // Drop the events that the owning thread might have overwritten while we were copying,
+        // the slot of event 'after' might be in the middle of being written.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto after = buffer->head.load(std::memory_order_relaxed);
+        const auto valid = after > capacity ? after - capacity : 0;
+        if (valid > first) {
+            events.erase(events.begin(),
+                         events.begin() + static_cast<std::ptrdiff_t>(
+                                              std::min(valid - first, events.size())));
+        }
+
+        if (!events.empty() || !buffer->name.empty()) {
+            result.push_back({buffer->id, buffer->name, std::move(events)});
+        }
+    }
+    return result;
+}
+
+void TraceRecorder::clear() {
+    std::scoped_lock lock{mutex_};
+    for (auto& buffer : buffers_) {
+        buffer->tail.store(buffer->head.load());
+    }
+    // Buffers only referenced by us belong to threads that have exited
+    std::erase_if(buffers_, [](const auto& buffer) { return buffer.use_count() == 1; });
+}
+
+void TraceRecorder::exportChromeTrace(std::ostream& os) const {
+    const auto pid = util::getPid();
+    const auto threads = getEvents();
+
+    auto out = std::ostreambuf_iterator<char>(os);
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    const auto separator = [&]() {
+        if (!first) os << ',';
+        first = false;
+        os << '\n';
+    };
+    for (const auto& thread : threads) {
+        if (!thread.name.empty()) {
+            separator();
+            fmt::format_to(out, R"({{"name":"thread_name","ph":"M","pid":{},"tid":{},"args":)",
+                           pid, thread.id);
+            os << "{\"name\":";
+            writeJsonString(os, thread.name);
+            os << "}}";
+        }
+        for (const auto& event : thread.events) {
+            separator();
+            os << "{\"name\":";
+            writeJsonString(os, event.getName());
+            os << ",\"cat\":";
+            writeJsonString(os, event.category ? event.category : "");
+            fmt::format_to(out, R"(,"ph":"X","pid":{},"tid":{},"ts":{:.3f},"dur":{:.3f}}})", pid,
+                           thread.id, static_cast<double>(event.start) / 1000.0,
+                           static_cast<double>(event.duration) / 1000.0);
+        }
+    }
+    os << "\n]}\n";
+}
+
+void TraceRecorder::exportChromeTrace(const std::filesystem::path& file) const {
+    std::ofstream os(file);
+    if (!os) {
+        throw FileException(IVW_CONTEXT, "Could not open file {} for writing", file);
+    }
+    exportChromeTrace(os);
+}
+
+}  // namespace inviwo
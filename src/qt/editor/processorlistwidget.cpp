@@ -278,6 +278,9 @@ ProcessorTreeWidget::ProcessorTreeWidget(InviwoMainWindow* parent, HelpWidget* h
     onModulesDidRegister_ = app_->getModuleManager().onModulesDidRegister([this]() {
         addProcessorsToTree();
         app_->getProcessorFactory()->addObserver(this);
+        // Let the deferred processors, like the python ones, register once the event loop runs
+        app_->dispatchFrontAndForget(
+            [app = app_]() { app->getProcessorFactory()->registerDeferred(); });
     });
     onModulesWillUnregister_ = app_->getModuleManager().onModulesWillUnregister([this]() {
         processorTree_->clear();
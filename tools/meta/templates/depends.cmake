@@ -14,6 +14,12 @@ set(dependencies
 # when using runtime module reloading. 
 #set(protected ON)
 
+# Mark the module as thread safe to let it be constructed on the thread pool,
+# concurrently with other thread safe modules. The module constructor may only
+# register things through the InviwoModule register functions, and may not use
+# OpenGL, Qt, Python, or wait for the main thread.
+#set(threadSafe ON)
+
 # By calling set(EnableByDefault ON) the module will be set to enabled 
 # when initially being added to CMake. Default OFF.
 #set(EnableByDefault OFF)
\ No newline at end of file